@@ -240,6 +240,16 @@ public:
     resetNumBoxes();
   }
 
+  //-----------------------------------------------------------------------------------
+  /** @return true if the leaf boxes process their events in column blocks, one contiguous array per dimension */
+  bool useColumnarEvents() const { return m_columnarEvents; }
+
+  /** Select whether the leaf boxes process their events in column blocks. The events are stored as before: this
+   * selects the kernels used for binning and integrating them.
+   * @param columnar :: true to use the columnar kernels
+   */
+  void setColumnarEvents(const bool columnar) { m_columnarEvents = columnar; }
+
   /// The number of events that triggers box splitting
   size_t getSignificantEventsNumber() const { return m_significantEventsNumber; }
 
@@ -501,6 +511,9 @@ private:
   /// level (e.g. (splitInto ^ ndims) ^ depth )
   std::vector<double> m_maxNumMDBoxes;
 
+  /// True if the leaf boxes process their events in column blocks
+  bool m_columnarEvents{false};
+
   /// Mutex for getting IDs
   std::mutex m_idMutex;
 
@@ -86,6 +86,10 @@ public:
 
   void setFileNeedsUpdating(bool value);
 
+  uint64_t getModificationCount() const;
+
+  void incrementModificationCount();
+
   bool threadSafe() const override;
 
   virtual void setCoordinateSystem(const Mantid::Kernel::SpecialCoordinateSystem coordinateSystem) = 0;
@@ -112,6 +116,8 @@ protected:
   /// Marker set to true when a file-backed workspace needs its back-end file
   /// updated (by calling SaveMD(UpdateFileBackEnd=1) )
   bool m_fileNeedsUpdating;
+  /// Counter increased whenever the boxes are split, refreshed or masked
+  uint64_t m_modificationCount;
 
 private:
   IMDEventWorkspace *doClone() const override = 0;
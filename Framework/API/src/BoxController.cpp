@@ -46,14 +46,14 @@ BoxController::BoxController(const BoxController &other)
       m_addingEvents_eventsPerTask(other.m_addingEvents_eventsPerTask),
       m_addingEvents_numTasksPerBlock(other.m_addingEvents_numTasksPerBlock), m_numMDBoxes(other.m_numMDBoxes),
       m_numMDGridBoxes(other.m_numMDGridBoxes), m_maxNumMDBoxes(other.m_maxNumMDBoxes),
-      m_fileIO(std::shared_ptr<API::IBoxControllerIO>()) {}
+      m_columnarEvents(other.m_columnarEvents), m_fileIO(std::shared_ptr<API::IBoxControllerIO>()) {}
 
 bool BoxController::operator==(const BoxController &other) const {
   if (nd != other.nd || m_maxId != other.m_maxId || m_SplitThreshold != other.m_SplitThreshold ||
       m_maxDepth != other.m_maxDepth || m_numSplit != other.m_numSplit ||
       m_splitInto.size() != other.m_splitInto.size() || m_numMDBoxes.size() != other.m_numMDBoxes.size() ||
       m_numMDGridBoxes.size() != other.m_numMDGridBoxes.size() ||
-      m_maxNumMDBoxes.size() != other.m_maxNumMDBoxes.size())
+      m_maxNumMDBoxes.size() != other.m_maxNumMDBoxes.size() || m_columnarEvents != other.m_columnarEvents)
     return false;
 
   for (size_t i = 0; i < m_splitInto.size(); i++) {
@@ -181,6 +181,11 @@ std::string BoxController::toXMLString() const {
   element->appendChild(text);
   pBoxElement->appendChild(element);
 
+  element = pDoc->createElement("ColumnarEvents");
+  text = pDoc->createTextNode(m_columnarEvents ? "1" : "0");
+  element->appendChild(text);
+  pBoxElement->appendChild(element);
+
   // Create a string representation of the DOM tree.
   std::stringstream xmlstream;
   DOMWriter writer;
@@ -251,6 +256,10 @@ void BoxController::fromXMLString(const std::string &xml) {
   s = pBoxElement->getChildElement("NumMDGridBoxes")->innerText();
   this->m_numMDGridBoxes = splitStringIntoVector<size_t>(s);
 
+  // files written before the columnar kernels were added do not have the element
+  const auto *columnarElement = pBoxElement->getChildElement("ColumnarEvents");
+  this->m_columnarEvents = columnarElement && columnarElement->innerText() == "1";
+
   this->calcNumSplit();
 
   if (m_splitTopInto) {
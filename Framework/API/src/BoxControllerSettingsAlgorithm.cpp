@@ -57,10 +57,15 @@ void BoxControllerSettingsAlgorithm::initBoxControllerProps(const std::string &S
                   "Default " +
                       Strings::toString(MaxRecursionDepth) + ".");
 
+  declareProperty("ColumnarEvents", false,
+                  "If true the events of each box are binned and integrated in blocks with one contiguous array per "
+                  "dimension, which lets the compiler vectorise the coordinate transformations.");
+
   std::string grp = getBoxSettingsGroupName();
   setPropertyGroup("SplitInto", grp);
   setPropertyGroup("SplitThreshold", grp);
   setPropertyGroup("MaxRecursionDepth", grp);
+  setPropertyGroup("ColumnarEvents", grp);
 }
 
 /**
@@ -130,6 +135,8 @@ void BoxControllerSettingsAlgorithm::setBoxController(const BoxController_sptr &
   bc->setSplitThreshold(val);
   val = this->getProperty("MaxRecursionDepth");
   bc->setMaxDepth(val);
+  const bool columnarEvents = this->getProperty("ColumnarEvents");
+  bc->setColumnarEvents(columnarEvents);
 
   // Build MDGridBox
   std::vector<int> splits = getProperty("SplitInto");
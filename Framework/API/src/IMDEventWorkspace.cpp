@@ -17,7 +17,8 @@ namespace Mantid::API {
 
 //-----------------------------------------------------------------------------------------------
 /** Empty constructor */
-IMDEventWorkspace::IMDEventWorkspace() : IMDWorkspace(), MultipleExperimentInfos(), m_fileNeedsUpdating(false) {}
+IMDEventWorkspace::IMDEventWorkspace()
+    : IMDWorkspace(), MultipleExperimentInfos(), m_fileNeedsUpdating(false), m_modificationCount(0) {}
 
 //-----------------------------------------------------------------------------------------------
 /** @return the marker set to true when a file-backed workspace needs its
@@ -32,6 +33,18 @@ bool IMDEventWorkspace::fileNeedsUpdating() const { return m_fileNeedsUpdating;
  */
 void IMDEventWorkspace::setFileNeedsUpdating(bool value) { m_fileNeedsUpdating = value; }
 
+//-----------------------------------------------------------------------------------------------
+/** @return a counter increased whenever the boxes of the workspace are split, refreshed or masked. Anything derived
+ * from the events, such as a cached histogram, is out of date once it changes.
+ */
+uint64_t IMDEventWorkspace::getModificationCount() const { return m_modificationCount; }
+
+//-----------------------------------------------------------------------------------------------
+/** Increase the counter returned by getModificationCount(). This is not thread safe: call it from the thread that
+ * changes the boxes once they are changed.
+ */
+void IMDEventWorkspace::incrementModificationCount() { ++m_modificationCount; }
+
 //-----------------------------------------------------------------------------------------------
 /** Is the workspace thread-safe. For MDEventWorkspaces, this means operations
  * on separate boxes in separate threads. Don't try to write to the
@@ -115,6 +115,17 @@ public:
     TS_ASSERT_EQUALS(bc->getMaxDepth(), 34);
   }
 
+  void test_ColumnarEvents() {
+    BoxControllerSettingsAlgorithmImpl alg;
+    alg.initBoxControllerProps();
+    BoxController_sptr bc(new BoxController(3));
+    alg.setBoxController(bc);
+    TS_ASSERT(!bc->useColumnarEvents());
+    alg.setProperty("ColumnarEvents", true);
+    alg.setBoxController(bc);
+    TS_ASSERT(bc->useColumnarEvents());
+  }
+
   void test_take_instrument_parameters() {
     const int splitInto = 4;
     const int splitThreshold = 16;
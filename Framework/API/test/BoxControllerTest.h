@@ -224,6 +224,7 @@ public:
     TS_ASSERT_EQUALS(a.getNumMDBoxes(), b.getNumMDBoxes());
     TS_ASSERT_EQUALS(a.getNumSplit(), b.getNumSplit());
     TS_ASSERT_EQUALS(a.getMaxNumMDBoxes(), b.getMaxNumMDBoxes());
+    TS_ASSERT_EQUALS(a.useColumnarEvents(), b.useColumnarEvents());
     for (size_t d = 0; d < a.getNDims(); d++) {
       TS_ASSERT_EQUALS(a.getSplitInto(d), b.getSplitInto(d));
     }
@@ -278,6 +279,34 @@ public:
     compareBoxControllers(a, b);
   }
 
+  void test_xmlWithColumnarEvents() {
+    BoxController a(2);
+    a.setSplitInto(10);
+    a.setColumnarEvents(true);
+
+    BoxController b(2);
+    b.fromXMLString(a.toXMLString());
+    TS_ASSERT(b.useColumnarEvents());
+    compareBoxControllers(a, b);
+    TS_ASSERT(a == b);
+  }
+
+  void test_xmlWithoutColumnarEventsIsNotColumnar() {
+    BoxController a(2);
+    a.setSplitInto(10);
+    std::string xml = a.toXMLString();
+    // XML written before the flag existed
+    const auto start = xml.find("<ColumnarEvents>");
+    TS_ASSERT_DIFFERS(start, std::string::npos);
+    const std::string end("</ColumnarEvents>");
+    xml.erase(start, xml.find(end) + end.size() - start);
+
+    BoxController b(2);
+    b.setColumnarEvents(true);
+    b.fromXMLString(xml);
+    TS_ASSERT(!b.useColumnarEvents());
+  }
+
   void test_Clone() {
     BoxController a(2);
     a.setMaxDepth(4);
@@ -346,6 +375,7 @@ public:
     TS_ASSERT_EQUALS(2, box_controller.getNDims());
     TS_ASSERT_EQUALS(1, box_controller.getNumSplit());
     TS_ASSERT_EQUALS(0, box_controller.getMaxId());
+    TS_ASSERT(!box_controller.useColumnarEvents());
   }
 
   void test_openCloseFileBacked() {
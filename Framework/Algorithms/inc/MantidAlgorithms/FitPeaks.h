@@ -7,6 +7,7 @@
 #pragma once
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidAPI/CompositeFunction.h"
 #include "MantidAPI/IBackgroundFunction.h"
 #include "MantidAPI/IPeakFunction.h"
 #include "MantidAPI/ITableWorkspace.h"
@@ -14,6 +15,7 @@
 #include "MantidAPI/MatrixWorkspace_fwd.h"
 #include "MantidAPI/MultiDomainFunction.h"
 #include "MantidAlgorithms/DllConfig.h"
+#include "MantidAlgorithms/PeakFitEngine.h"
 #include "MantidAlgorithms/PeakParameterHelper.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/TableWorkspace.h"
@@ -35,6 +37,21 @@ struct FitFunction {
   API::IBackgroundFunction_sptr bkgdfunction;
 };
 
+/// The functions and the fitter that one thread reuses for all of its peaks when fitting in process
+struct FitContext {
+  FitContext(API::IPeakFunction_sptr peak, API::IBackgroundFunction_sptr bkgd, API::IBackgroundFunction_sptr linearBkgd,
+             const size_t maxIterations);
+  API::IPeakFunction_sptr peakfunction;
+  API::IBackgroundFunction_sptr bkgdfunction;
+  /// the sum of the peak and the background functions
+  API::CompositeFunction_sptr compositefunction;
+  /// linear background that is removed first from data with a high background, may be null
+  API::IBackgroundFunction_sptr linearbkgdfunction;
+  PeakFitEngine engine;
+  /// false if the peak function is cloned for each peak, to set the parameters that the instrument defines
+  bool reusepeakfunction{true};
+};
+
 class PeakFitResult {
 public:
   PeakFitResult(size_t num_peaks, size_t num_params);
@@ -151,32 +168,37 @@ private:
   void fitSpectrumPeaks(size_t wi, const std::vector<double> &expected_peak_centers,
                         const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> &fit_result,
                         std::vector<std::vector<double>> &lastGoodPeakParameters,
-                        const std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> &pre_check_result);
+                        const std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> &pre_check_result,
+                        FitPeaksAlgorithm::FitContext *fit_context);
 
   /// fit background
   bool fitBackground(const size_t &ws_index, const std::pair<double, double> &fit_window,
-                     const double &expected_peak_pos, const API::IBackgroundFunction_sptr &bkgd_func);
+                     const double &expected_peak_pos, const API::IBackgroundFunction_sptr &bkgd_func,
+                     FitPeaksAlgorithm::FitContext *fit_context);
 
   // Peak fitting suite
   double fitIndividualPeak(size_t wi, const API::IAlgorithm_sptr &fitter, const double expected_peak_center,
                            const std::pair<double, double> &fitwindow, const bool estimate_peak_width,
                            const API::IPeakFunction_sptr &peakfunction, const API::IBackgroundFunction_sptr &bkgdfunc,
-                           const std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> &pre_check_result);
+                           const std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> &pre_check_result,
+                           FitPeaksAlgorithm::FitContext *fit_context);
 
   /// Methods to fit functions (general)
   double fitFunctionSD(const API::IAlgorithm_sptr &fit, const API::IPeakFunction_sptr &peak_function,
                        const API::IBackgroundFunction_sptr &bkgd_function, const API::MatrixWorkspace_sptr &dataws,
                        size_t wsindex, const std::pair<double, double> &peak_range, const double &expected_peak_center,
-                       bool estimate_peak_width, bool estimate_background);
+                       bool estimate_peak_width, bool estimate_background, FitPeaksAlgorithm::FitContext *fit_context);
 
   double fitFunctionMD(API::IFunction_sptr fit_function, const API::MatrixWorkspace_sptr &dataws, const size_t wsindex,
-                       const std::pair<double, double> &vec_xmin, const std::pair<double, double> &vec_xmax);
+                       const std::pair<double, double> &vec_xmin, const std::pair<double, double> &vec_xmax,
+                       FitPeaksAlgorithm::FitContext *fit_context);
 
   /// fit a single peak with high background
   double fitFunctionHighBackground(const API::IAlgorithm_sptr &fit, const std::pair<double, double> &fit_window,
                                    const size_t &ws_index, const double &expected_peak_center, bool observe_peak_shape,
                                    const API::IPeakFunction_sptr &peakfunction,
-                                   const API::IBackgroundFunction_sptr &bkgdfunc);
+                                   const API::IBackgroundFunction_sptr &bkgdfunc,
+                                   FitPeaksAlgorithm::FitContext *fit_context);
 
   void setupParameterTableWorkspace(const API::ITableWorkspace_sptr &table_ws,
                                     const std::vector<std::string> &param_names, bool with_chi2);
@@ -273,6 +295,8 @@ private:
   bool m_fitPeaksFromRight;
   /// Fit iterations
   int m_fitIterations;
+  /// Fit in process with a reusable context per thread instead of the Fit algorithm
+  bool m_lightweightFitting;
 
   //-------- Input param init values --------------------------------
   /// input starting parameters' indexes in peak function
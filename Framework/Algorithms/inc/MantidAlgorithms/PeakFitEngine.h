@@ -0,0 +1,101 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/FunctionValues.h"
+#include "MantidAPI/IFunction.h"
+#include "MantidAPI/Jacobian.h"
+#include "MantidAlgorithms/DllConfig.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Algorithms {
+
+/** PeakFitEngine : A reusable least squares fitter for fitting many peaks in a loop without running the Fit
+  algorithm.
+
+  Each call to fit() minimises the weighted sum of squares of a function against slices of a spectrum with the
+  Levenberg-Marquardt method, then sets the fitted parameters and their errors on the function. Points with a
+  non-positive or non-finite error are ignored, as Fit does with IgnoreInvalidData. The buffers for the data, the
+  calculated values, the Jacobian and the normal equations are kept between calls, so once an engine has fitted its
+  largest window no more memory is allocated. An engine is not thread safe: use one per thread.
+*/
+class MANTID_ALGORITHMS_DLL PeakFitEngine {
+public:
+  /// A range of data indices, [first, second)
+  using IndexRange = std::pair<size_t, size_t>;
+
+  explicit PeakFitEngine(const size_t maxIterations = 50);
+
+  double fit(API::IFunction &function, const std::vector<double> &x, const std::vector<double> &y,
+             const std::vector<double> &e, std::initializer_list<IndexRange> ranges);
+
+  void setParameterBounds(const size_t index, const double lower, const double upper);
+  void clearParameterBounds();
+
+  /// @return the number of iterations taken by the last fit
+  size_t iterations() const { return m_iterations; }
+  /// @return true if the last fit converged
+  bool converged() const { return m_converged; }
+
+private:
+  /// Jacobian stored in a flat buffer, indexed by data point and declared parameter
+  class FlatJacobian final : public API::Jacobian {
+  public:
+    void resize(const size_t nData, const size_t nParams);
+    void set(size_t iY, size_t iP, double value) override { m_data[iY * m_nParams + iP] = value; }
+    double get(size_t iY, size_t iP) override { return m_data[iY * m_nParams + iP]; }
+    void zero() override { std::fill(m_data.begin(), m_data.end(), 0.0); }
+
+  private:
+    size_t m_nParams{0};
+    std::vector<double> m_data;
+  };
+
+  double calculateChiSquared(API::IFunction &function);
+  void calculateNormalEquations(API::IFunction &function);
+  void setActiveParameters(API::IFunction &function, const std::vector<double> &parameters);
+  void calculateErrors(API::IFunction &function);
+
+  /// Maximum number of Levenberg-Marquardt iterations
+  const size_t m_maxIterations;
+  /// Declared index and limits of a bounded parameter
+  struct Bounds {
+    size_t index;
+    double lower;
+    double upper;
+  };
+  std::vector<Bounds> m_bounds;
+
+  /// X, Y and weights of the fitted points
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_weights;
+  /// Values calculated by the function
+  API::FunctionValues m_values;
+  FlatJacobian m_jacobian;
+  /// Declared indices of the active parameters
+  std::vector<size_t> m_active;
+  /// Active parameter values: current and trial
+  std::vector<double> m_parameters;
+  std::vector<double> m_trial;
+  /// Normal equations J^T W J and J^T W r, and the damped system solved for a step
+  std::vector<double> m_hessian;
+  std::vector<double> m_gradient;
+  std::vector<double> m_system;
+  std::vector<double> m_step;
+
+  size_t m_iterations{0};
+  bool m_converged{false};
+};
+
+} // namespace Algorithms
+} // namespace Mantid
@@ -10,6 +10,9 @@
 #include "MantidAlgorithms/SampleCorrections/MCInteractionStatistics.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
 
+#include <stdexcept>
+#include <vector>
+
 namespace Mantid {
 namespace Geometry {
 class IObject;
@@ -17,6 +20,7 @@ class Track;
 } // namespace Geometry
 
 namespace Kernel {
+class Material;
 class PseudoRandomNumberGenerator;
 class V3D;
 } // namespace Kernel
@@ -36,9 +40,25 @@ using TrackPair = std::tuple<bool, std::shared_ptr<Geometry::Track>, std::shared
 class MANTID_ALGORITHMS_DLL IMCInteractionVolume {
 public:
   enum class ScatteringPointVicinity { SAMPLEANDENVIRONMENT, SAMPLEONLY, ENVIRONMENTONLY };
+  /// Path lengths through each object of the volume for a batch of scatter points
+  struct ScatterTrackLengths {
+    /// Material of each object
+    std::vector<const Kernel::Material *> materials;
+    /// Length inside each object before scattering, indexed by point * materials.size() + object
+    std::vector<double> before;
+    /// Length inside each object after scattering, indexed like before
+    std::vector<double> after;
+  };
   virtual ~IMCInteractionVolume() = default;
   virtual TrackPair calculateBeforeAfterTrack(Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
                                               const Kernel::V3D &endPos, MCInteractionStatistics &stats) const = 0;
+  /// @return true if calculateTrackLengths is implemented
+  virtual bool canCalculateTrackLengths() const { return false; }
+  /// Calculate the before and after scatter path lengths for a batch of scatter points
+  virtual void calculateTrackLengths(const std::vector<Kernel::V3D> &, const std::vector<ComponentScatterPoint> &,
+                                     const Kernel::V3D &, ScatterTrackLengths &) const {
+    throw std::runtime_error("IMCInteractionVolume::calculateTrackLengths() - not implemented by this volume");
+  }
   virtual ComponentScatterPoint generatePoint(Kernel::PseudoRandomNumberGenerator &rng) const = 0;
   virtual const Geometry::BoundingBox getFullBoundingBox() const = 0;
   virtual void setActiveRegion(const Geometry::BoundingBox &region) = 0;
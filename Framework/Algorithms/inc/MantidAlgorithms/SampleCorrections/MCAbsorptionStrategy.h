@@ -56,6 +56,10 @@ private:
   const Kernel::DeltaEMode::Type m_EMode;
   const bool m_regenerateTracksForEachLambda;
   void setActiveRegion();
+  void accumulateFromTrackLengths(Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &finalPos,
+                                  const std::vector<double> &lambdas, const double lambdaFixed,
+                                  std::vector<double> &attenuationFactors, std::vector<double> &attFactorErrors,
+                                  MCInteractionStatistics &stats);
 };
 
 } // namespace Algorithms
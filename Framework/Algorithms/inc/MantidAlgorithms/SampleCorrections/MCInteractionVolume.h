@@ -35,6 +35,10 @@ public:
   const Geometry::BoundingBox getFullBoundingBox() const override;
   virtual TrackPair calculateBeforeAfterTrack(Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
                                               const Kernel::V3D &endPos, MCInteractionStatistics &stats) const override;
+  bool canCalculateTrackLengths() const override { return true; }
+  void calculateTrackLengths(const std::vector<Kernel::V3D> &startPositions,
+                             const std::vector<ComponentScatterPoint> &scatterPoints, const Kernel::V3D &endPos,
+                             ScatterTrackLengths &lengths) const override;
   ComponentScatterPoint generatePoint(Kernel::PseudoRandomNumberGenerator &rng) const override;
   void setActiveRegion(const Geometry::BoundingBox &region) override;
   Geometry::IObject_sptr getGaugeVolume() const override;
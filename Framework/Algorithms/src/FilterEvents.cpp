@@ -992,19 +992,23 @@ void FilterEvents::filterEvents(double progressamount) {
   size_t numberOfSpectra = m_eventWS->getNumberHistograms();
   g_log.debug() << "Number of spectra in input/source EventWorkspace = " << numberOfSpectra << ".\n";
 
+  // the workspace receiving the unfiltered events is not an output unless requested, so skip copying its events
+  const bool outputUnfiltered = getProperty("OutputUnfilteredEvents");
+
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int64_t iws = 0; iws < int64_t(numberOfSpectra); ++iws) {
     PARALLEL_START_INTERRUPT_REGION
     if (!m_vecSkip[iws]) {                                                        // Filter the non-skipped
       const DataObjects::EventList &inputEventList = m_eventWS->getSpectrum(iws); // input event list
-      if (!inputEventList.empty()) {                              // nothing to split if there aren't events
-        std::map<int, DataObjects::EventList *> partialEvenLists; // event lists receiving the events from input list
-        for (auto &ws : m_outputWorkspacesMap) {
-          const int index = ws.first;
-          auto &partialEventList = ws.second->getSpectrum(iws);
-          partialEvenLists.emplace(index, &partialEventList);
-        }
-        m_timeSplitter.splitEventList(inputEventList, partialEvenLists, pulseTof, tofCorrect, m_detTofFactors[iws],
+      if (!inputEventList.empty()) { // nothing to split if there aren't events
+        // event lists receiving the events from input list, only looked up for the targets that receive events
+        const auto getPartial = [&](const int index) -> DataObjects::EventList * {
+          if (index == TimeSplitter::NO_TARGET && !outputUnfiltered)
+            return nullptr;
+          const auto ws = m_outputWorkspacesMap.find(index);
+          return ws == m_outputWorkspacesMap.end() ? nullptr : &ws->second->getSpectrum(iws);
+        };
+        m_timeSplitter.splitEventList(inputEventList, getPartial, pulseTof, tofCorrect, m_detTofFactors[iws],
                                       m_detTofOffsets[iws]);
       }
     }
@@ -24,6 +24,8 @@
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/FitParameter.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidHistogramData/EstimatePolynomial.h"
 #include "MantidHistogramData/Histogram.h"
 #include "MantidHistogramData/HistogramBuilder.h"
@@ -73,6 +75,7 @@ const std::string FIT_FROM_RIGHT("FitFromRight");
 const std::string MINIMIZER("Minimizer");
 const std::string COST_FUNC("CostFunction");
 const std::string MAX_FIT_ITER("MaxFitIterations");
+const std::string LIGHTWEIGHT_FITTING("LightweightFitting");
 const std::string BACKGROUND_Z_SCORE("FindBackgroundSigma");
 const std::string HIGH_BACKGROUND("HighBackground");
 const std::string POSITION_TOL("PositionTolerance");
@@ -256,12 +259,28 @@ std::string PeakFitPreCheckResult::getReport() const {
 
   return os.str();
 }
+
+//----------------------------------------------------------------------------------------------
+/** Set up the functions one thread reuses for fitting its peaks
+ * @param peak :: peak function, owned by the context
+ * @param bkgd :: background function, owned by the context
+ * @param linearBkgd :: linear background function for data with a high background, may be null
+ * @param maxIterations :: maximum number of iterations of each fit
+ */
+FitContext::FitContext(API::IPeakFunction_sptr peak, API::IBackgroundFunction_sptr bkgd,
+                       API::IBackgroundFunction_sptr linearBkgd, const size_t maxIterations)
+    : peakfunction(std::move(peak)), bkgdfunction(std::move(bkgd)),
+      compositefunction(std::make_shared<API::CompositeFunction>()), linearbkgdfunction(std::move(linearBkgd)),
+      engine(maxIterations) {
+  compositefunction->addFunction(peakfunction);
+  compositefunction->addFunction(bkgdfunction);
+}
 } // namespace FitPeaksAlgorithm
 
 //----------------------------------------------------------------------------------------------
 FitPeaks::FitPeaks()
-    : m_fitPeaksFromRight(true), m_fitIterations(50), m_numPeaksToFit(0), m_minPeakHeight(0.),
-      m_minSignalToNoiseRatio(0.), m_minPeakTotalCount(0.), m_peakPosTolCase234(false) {}
+    : m_fitPeaksFromRight(true), m_fitIterations(50), m_lightweightFitting(false), m_numPeaksToFit(0),
+      m_minPeakHeight(0.), m_minSignalToNoiseRatio(0.), m_minPeakTotalCount(0.), m_peakPosTolCase234(false) {}
 
 //----------------------------------------------------------------------------------------------
 /** initialize the properties
@@ -375,9 +394,15 @@ void FitPeaks::init() {
   min_max_iter->setLower(49);
   declareProperty(PropertyNames::MAX_FIT_ITER, 50, min_max_iter, "Maximum number of function fitting iterations.");
 
+  declareProperty(PropertyNames::LIGHTWEIGHT_FITTING, false,
+                  "If true each thread fits its peaks in process with one reusable set of functions and a "
+                  "Levenberg-Marquardt least squares fitter, instead of running the Fit algorithm for every peak. "
+                  "This requires the Levenberg-Marquardt minimizer and the Least squares cost function.");
+
   const std::string optimizergrp("Optimization Setup");
   setPropertyGroup(PropertyNames::MINIMIZER, optimizergrp);
   setPropertyGroup(PropertyNames::COST_FUNC, optimizergrp);
+  setPropertyGroup(PropertyNames::LIGHTWEIGHT_FITTING, optimizergrp);
 
   // other helping information
   std::ostringstream os;
@@ -463,6 +488,18 @@ std::map<std::string, std::string> FitPeaks::validateInputs() {
     }
   }
 
+  // the lightweight fitter only implements one minimizer and cost function
+  const bool lightweightFitting = getProperty(PropertyNames::LIGHTWEIGHT_FITTING);
+  if (lightweightFitting) {
+    const std::string minimizer = getPropertyValue(PropertyNames::MINIMIZER);
+    if (!boost::algorithm::starts_with(minimizer, "Levenberg-Marquardt"))
+      issues[PropertyNames::MINIMIZER] =
+          "Only the Levenberg-Marquardt minimizer can be used with " + PropertyNames::LIGHTWEIGHT_FITTING;
+    if (getPropertyValue(PropertyNames::COST_FUNC) != "Least squares")
+      issues[PropertyNames::COST_FUNC] =
+          "Only the Least squares cost function can be used with " + PropertyNames::LIGHTWEIGHT_FITTING;
+  }
+
   // check that the peak parameters are in parallel properties
   bool haveCommonPeakParameters(false);
   std::vector<string> suppliedParameterNames = getProperty(PropertyNames::PEAK_PARAM_NAMES);
@@ -585,6 +622,7 @@ void FitPeaks::processInputs() {
   m_fitPeaksFromRight = getProperty(PropertyNames::FIT_FROM_RIGHT);
   m_constrainPeaksPosition = getProperty(PropertyNames::CONSTRAIN_PEAK_POS);
   m_fitIterations = getProperty(PropertyNames::MAX_FIT_ITER);
+  m_lightweightFitting = getProperty(PropertyNames::LIGHTWEIGHT_FITTING);
 
   // Peak centers, tolerance and fitting range
   processInputPeakCenters();
@@ -972,6 +1010,36 @@ void FitPeaks::convertParametersNameToIndex() {
   return;
 }
 
+namespace {
+/// @return true if the instrument of the workspace sets parameters of the named fit function
+bool hasInstrumentFittingParameters(const API::MatrixWorkspace &workspace, const std::string &function_name) {
+  const auto &param_map = workspace.constInstrumentParameters();
+  return std::any_of(param_map.begin(), param_map.end(), [&function_name](const auto &item) {
+    return item.second->type() == "fitting" &&
+           item.second->template value<Geometry::FitParameter>().getFunction() == function_name;
+  });
+}
+
+/// Reset the values, errors and fixes of a reused peak function to those of the function it was cloned from
+void resetPeakFunction(const API::IPeakFunction &source, API::IPeakFunction &peak_function) {
+  for (size_t i = 0; i < source.nParams(); ++i) {
+    peak_function.setParameter(i, source.getParameter(i));
+    peak_function.setError(i, source.getError(i));
+    if (source.isFixed(i))
+      peak_function.fix(i);
+    else if (peak_function.isFixed(i))
+      peak_function.unfix(i);
+  }
+}
+
+/// @return the range of indices of the points within [xmin, xmax]
+PeakFitEngine::IndexRange pointIndexRange(const std::vector<double> &points, const double xmin, const double xmax) {
+  const auto first = std::lower_bound(points.cbegin(), points.cend(), xmin);
+  const auto last = std::upper_bound(first, points.cend(), xmax);
+  return {static_cast<size_t>(first - points.cbegin()), static_cast<size_t>(last - points.cbegin())};
+}
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** main method to fit peaks among all
  */
@@ -988,6 +1056,10 @@ std::vector<std::shared_ptr<FitPeaksAlgorithm::PeakFitResult>> FitPeaks::fitPeak
   std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> pre_check_result =
       std::make_shared<FitPeaksAlgorithm::PeakFitPreCheckResult>();
 
+  // parameters set from the instrument differ between spectra and peaks, so the peak function is cloned for each peak
+  const bool reuse_peak_function =
+      m_lightweightFitting && !hasInstrumentFittingParameters(*m_inputMatrixWS, m_peakFunction->name());
+
   PRAGMA_OMP(parallel for schedule(dynamic, 1) )
   for (int ithread = 0; ithread < nThreads; ithread++) {
     PARALLEL_START_INTERRUPT_REGION
@@ -998,6 +1070,19 @@ std::vector<std::shared_ptr<FitPeaksAlgorithm::PeakFitResult>> FitPeaks::fitPeak
     std::vector<std::vector<double>> lastGoodPeakParameters(m_numPeaksToFit,
                                                             std::vector<double>(m_peakFunction->nParams(), 0.0));
 
+    // functions and fitter reused for all the peaks of this thread
+    std::unique_ptr<FitPeaksAlgorithm::FitContext> fit_context;
+    if (m_lightweightFitting) {
+      fit_context = std::make_unique<FitPeaksAlgorithm::FitContext>(
+          std::dynamic_pointer_cast<IPeakFunction>(m_peakFunction->clone()),
+          std::dynamic_pointer_cast<IBackgroundFunction>(m_bkgdFunction->clone()),
+          m_linearBackgroundFunction
+              ? std::dynamic_pointer_cast<IBackgroundFunction>(m_linearBackgroundFunction->clone())
+              : nullptr,
+          static_cast<size_t>(m_fitIterations));
+      fit_context->reusepeakfunction = reuse_peak_function;
+    }
+
     for (auto wi = iws_begin; wi < iws_end; ++wi) {
       // peaks to fit
       std::vector<double> expected_peak_centers = m_getExpectedPeakPositions(static_cast<size_t>(wi));
@@ -1011,7 +1096,7 @@ std::vector<std::shared_ptr<FitPeaksAlgorithm::PeakFitResult>> FitPeaks::fitPeak
           std::make_shared<FitPeaksAlgorithm::PeakFitPreCheckResult>();
 
       fitSpectrumPeaks(static_cast<size_t>(wi), expected_peak_centers, fit_result, lastGoodPeakParameters,
-                       spectrum_pre_check_result);
+                       spectrum_pre_check_result, fit_context.get());
 
       PARALLEL_CRITICAL(FindPeaks_WriteOutput) {
         writeFitResult(static_cast<size_t>(wi), expected_peak_centers, fit_result);
@@ -1139,7 +1224,8 @@ private:
 void FitPeaks::fitSpectrumPeaks(size_t wi, const std::vector<double> &expected_peak_centers,
                                 const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> &fit_result,
                                 std::vector<std::vector<double>> &lastGoodPeakParameters,
-                                const std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> &pre_check_result) {
+                                const std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> &pre_check_result,
+                                FitPeaksAlgorithm::FitContext *fit_context) {
   assert(fit_result->getNumberPeaks() == m_numPeaksToFit);
   pre_check_result->setNumberOfSubmittedSpectrumPeaks(m_numPeaksToFit);
   // if the whole spectrum has low count, do not fit any peaks for that spectrum
@@ -1150,24 +1236,32 @@ void FitPeaks::fitSpectrumPeaks(size_t wi, const std::vector<double> &expected_p
     return;
   }
 
-  // Set up sub algorithm Fit for peak and background
   IAlgorithm_sptr peak_fitter; // both peak and background (combo)
-  try {
-    peak_fitter = createChildAlgorithm("Fit", -1, -1, false);
-  } catch (Exception::NotFoundError &) {
-    std::stringstream errss;
-    errss << "The FitPeak algorithm requires the CurveFitting library";
-    g_log.error(errss.str());
-    throw std::runtime_error(errss.str());
-  }
+  IBackgroundFunction_sptr bkgdfunction;
+  if (fit_context) {
+    // the functions of the fitting context are fitted in process
+    bkgdfunction = fit_context->bkgdfunction;
+    for (size_t i = 0; i < bkgdfunction->nParams(); ++i)
+      bkgdfunction->setError(i, 0.);
+  } else {
+    // Set up sub algorithm Fit for peak and background
+    try {
+      peak_fitter = createChildAlgorithm("Fit", -1, -1, false);
+    } catch (Exception::NotFoundError &) {
+      std::stringstream errss;
+      errss << "The FitPeak algorithm requires the CurveFitting library";
+      g_log.error(errss.str());
+      throw std::runtime_error(errss.str());
+    }
 
-  // Clone background function
-  IBackgroundFunction_sptr bkgdfunction = std::dynamic_pointer_cast<API::IBackgroundFunction>(m_bkgdFunction->clone());
+    // Clone background function
+    bkgdfunction = std::dynamic_pointer_cast<API::IBackgroundFunction>(m_bkgdFunction->clone());
 
-  // set up properties of algorithm (reference) 'Fit'
-  peak_fitter->setProperty("Minimizer", m_minimizer);
-  peak_fitter->setProperty("CostFunction", m_costFunction);
-  peak_fitter->setProperty("CalcErrors", true);
+    // set up properties of algorithm (reference) 'Fit'
+    peak_fitter->setProperty("Minimizer", m_minimizer);
+    peak_fitter->setProperty("CostFunction", m_costFunction);
+    peak_fitter->setProperty("CalcErrors", true);
+  }
 
   const double x0 = m_inputMatrixWS->histogram(wi).x().front();
   const double xf = m_inputMatrixWS->histogram(wi).x().back();
@@ -1188,11 +1282,21 @@ void FitPeaks::fitSpectrumPeaks(size_t wi, const std::vector<double> &expected_p
 
     double expected_peak_pos = expected_peak_centers[peak_index];
 
-    // clone peak function for each peak (need to do this so can
-    // set center and calc any parameters from xml)
-    auto peakfunction = std::dynamic_pointer_cast<API::IPeakFunction>(m_peakFunction->clone());
-    peakfunction->setCentre(expected_peak_pos);
-    peakfunction->setMatrixWorkspace(m_inputMatrixWS, wi, 0.0, 0.0);
+    API::IPeakFunction_sptr peakfunction;
+    if (fit_context && fit_context->reusepeakfunction) {
+      // there are no parameters to calculate from xml so the function is only reset
+      peakfunction = fit_context->peakfunction;
+      resetPeakFunction(*m_peakFunction, *peakfunction);
+      peakfunction->setCentre(expected_peak_pos);
+    } else {
+      // clone peak function for each peak (need to do this so can
+      // set center and calc any parameters from xml)
+      peakfunction = std::dynamic_pointer_cast<API::IPeakFunction>(m_peakFunction->clone());
+      peakfunction->setCentre(expected_peak_pos);
+      peakfunction->setMatrixWorkspace(m_inputMatrixWS, wi, 0.0, 0.0);
+      if (fit_context)
+        fit_context->compositefunction->replaceFunction(0, peakfunction);
+    }
 
     std::map<size_t, double> keep_values;
     for (size_t ipar = 0; ipar < peakfunction->nParams(); ++ipar) {
@@ -1291,7 +1395,7 @@ void FitPeaks::fitSpectrumPeaks(size_t wi, const std::vector<double> &expected_p
       std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> peak_pre_check_result =
           std::make_shared<FitPeaksAlgorithm::PeakFitPreCheckResult>();
       cost = fitIndividualPeak(wi, peak_fitter, expected_peak_pos, peak_window_i, observe_peak_width, peakfunction,
-                               bkgdfunction, peak_pre_check_result);
+                               bkgdfunction, peak_pre_check_result, fit_context);
       if (peak_pre_check_result->isIndividualPeakRejected())
         fit_result->setBadRecord(peak_index, -1.);
 
@@ -1633,7 +1737,8 @@ bool FitPeaks::isObservablePeakProfile(const std::string &peakprofile) {
 /** Fit background function
  */
 bool FitPeaks::fitBackground(const size_t &ws_index, const std::pair<double, double> &fit_window,
-                             const double &expected_peak_pos, const API::IBackgroundFunction_sptr &bkgd_func) {
+                             const double &expected_peak_pos, const API::IBackgroundFunction_sptr &bkgd_func,
+                             FitPeaksAlgorithm::FitContext *fit_context) {
   constexpr size_t MIN_POINTS{10}; // TODO explain why 10
 
   // find out how to fit background
@@ -1654,7 +1759,7 @@ bool FitPeaks::fitBackground(const size_t &ws_index, const std::pair<double, dou
     for (size_t n = 0; n < bkgd_func->nParams(); ++n)
       bkgd_func->setParameter(n, 0);
 
-    double chi2 = fitFunctionMD(bkgd_func, m_inputMatrixWS, ws_index, vec_min, vec_max);
+    double chi2 = fitFunctionMD(bkgd_func, m_inputMatrixWS, ws_index, vec_min, vec_max, fit_context);
 
     // process
     if (chi2 < DBL_MAX - 1) {
@@ -1680,7 +1785,8 @@ double FitPeaks::fitIndividualPeak(size_t wi, const API::IAlgorithm_sptr &fitter
                                    const std::pair<double, double> &fitwindow, const bool estimate_peak_width,
                                    const API::IPeakFunction_sptr &peakfunction,
                                    const API::IBackgroundFunction_sptr &bkgdfunc,
-                                   const std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> &pre_check_result) {
+                                   const std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> &pre_check_result,
+                                   FitPeaksAlgorithm::FitContext *fit_context) {
   pre_check_result->setNumberOfSubmittedIndividualPeaks(1);
   double cost(DBL_MAX);
 
@@ -1707,11 +1813,11 @@ double FitPeaks::fitIndividualPeak(size_t wi, const API::IAlgorithm_sptr &fitter
   if (m_highBackground) {
     // fit peak with high background!
     cost = fitFunctionHighBackground(fitter, fitwindow, wi, expected_peak_center, estimate_peak_width, peakfunction,
-                                     bkgdfunc);
+                                     bkgdfunc, fit_context);
   } else {
     // fit peak and background
     cost = fitFunctionSD(fitter, peakfunction, bkgdfunc, m_inputMatrixWS, wi, fitwindow, expected_peak_center,
-                         estimate_peak_width, true);
+                         estimate_peak_width, true, fit_context);
   }
 
   return cost;
@@ -1727,7 +1833,8 @@ double FitPeaks::fitFunctionSD(const IAlgorithm_sptr &fit, const API::IPeakFunct
                                const API::IBackgroundFunction_sptr &bkgd_function,
                                const API::MatrixWorkspace_sptr &dataws, size_t wsindex,
                                const std::pair<double, double> &peak_range, const double &expected_peak_center,
-                               bool estimate_peak_width, bool estimate_background) {
+                               bool estimate_peak_width, bool estimate_background,
+                               FitPeaksAlgorithm::FitContext *fit_context) {
   std::stringstream errorid;
   errorid << "(WorkspaceIndex=" << wsindex << " PeakCentre=" << expected_peak_center << ")";
 
@@ -1766,6 +1873,22 @@ double FitPeaks::fitFunctionSD(const IAlgorithm_sptr &fit, const API::IPeakFunct
     }
   }
 
+  if (fit_context) {
+    // the composite function of the context already holds the peak and the background functions
+    auto &engine = fit_context->engine;
+    engine.clearParameterBounds();
+    if (m_constrainPeaksPosition) {
+      const double peak_center = peak_function->centre();
+      const double peak_width = peak_function->fwhm();
+      // the peak is the first function of the composite so its parameters keep their indices
+      engine.setParameterBounds(peak_function->parameterIndex(peak_function->getCentreParameterName()),
+                                peak_center - 0.5 * peak_width, peak_center + 0.5 * peak_width);
+    }
+    const auto &points = vector_x.rawData();
+    return engine.fit(*fit_context->compositefunction, points, histogram.y().rawData(), histogram.e().rawData(),
+                      {pointIndexRange(points, peak_range.first, peak_range.second)});
+  }
+
   // Create the composition function
   CompositeFunction_sptr comp_func = std::make_shared<API::CompositeFunction>();
   comp_func->addFunction(peak_function);
@@ -1821,7 +1944,19 @@ double FitPeaks::fitFunctionSD(const IAlgorithm_sptr &fit, const API::IPeakFunct
 //----------------------------------------------------------------------------------------------
 double FitPeaks::fitFunctionMD(API::IFunction_sptr fit_function, const API::MatrixWorkspace_sptr &dataws,
                                const size_t wsindex, const std::pair<double, double> &vec_xmin,
-                               const std::pair<double, double> &vec_xmax) {
+                               const std::pair<double, double> &vec_xmax, FitPeaksAlgorithm::FitContext *fit_context) {
+  if (fit_context) {
+    // fit the function to both ranges of the spectrum at once
+    const auto &histogram = dataws->histogram(wsindex);
+    const auto points = histogram.points();
+    const auto &vec_x = points.rawData();
+    auto &engine = fit_context->engine;
+    engine.clearParameterBounds();
+    return engine.fit(*fit_function, vec_x, histogram.y().rawData(), histogram.e().rawData(),
+                      {pointIndexRange(vec_x, vec_xmin.first, vec_xmax.first),
+                       pointIndexRange(vec_x, vec_xmin.second, vec_xmax.second)});
+  }
+
   // Note: after testing it is found that multi-domain Fit cannot be reused
   API::IAlgorithm_sptr fit;
   try {
@@ -1882,15 +2017,17 @@ double FitPeaks::fitFunctionMD(API::IFunction_sptr fit_function, const API::Matr
 double FitPeaks::fitFunctionHighBackground(const IAlgorithm_sptr &fit, const std::pair<double, double> &fit_window,
                                            const size_t &ws_index, const double &expected_peak_center,
                                            bool observe_peak_shape, const API::IPeakFunction_sptr &peakfunction,
-                                           const API::IBackgroundFunction_sptr &bkgdfunc) {
+                                           const API::IBackgroundFunction_sptr &bkgdfunc,
+                                           FitPeaksAlgorithm::FitContext *fit_context) {
   assert(m_linearBackgroundFunction);
 
   // high background to reduce
   API::IBackgroundFunction_sptr high_bkgd_function =
-      std::dynamic_pointer_cast<API::IBackgroundFunction>(m_linearBackgroundFunction->clone());
+      fit_context ? fit_context->linearbkgdfunction
+                  : std::dynamic_pointer_cast<API::IBackgroundFunction>(m_linearBackgroundFunction->clone());
 
   // Fit the background first if there is enough data points
-  fitBackground(ws_index, fit_window, expected_peak_center, high_bkgd_function);
+  fitBackground(ws_index, fit_window, expected_peak_center, high_bkgd_function, fit_context);
 
   // Get partial of the data
   std::vector<double> vec_x, vec_y, vec_e;
@@ -1906,7 +2043,7 @@ double FitPeaks::fitFunctionHighBackground(const IAlgorithm_sptr &fit, const std
 
   // Fit peak with background
   fitFunctionSD(fit, peakfunction, bkgdfunc, reduced_bkgd_ws, 0, {vec_x.front(), vec_x.back()}, expected_peak_center,
-                observe_peak_shape, false);
+                observe_peak_shape, false, fit_context);
 
   // add the reduced background back
   bkgdfunc->setParameter(0, bkgdfunc->getParameter(0) + high_bkgd_function->getParameter(0));
@@ -1914,7 +2051,7 @@ double FitPeaks::fitFunctionHighBackground(const IAlgorithm_sptr &fit, const std
                                 high_bkgd_function->getParameter(1));
 
   double cost = fitFunctionSD(fit, peakfunction, bkgdfunc, m_inputMatrixWS, ws_index, {vec_x.front(), vec_x.back()},
-                              expected_peak_center, false, false);
+                              expected_peak_center, false, false, fit_context);
 
   return cost;
 }
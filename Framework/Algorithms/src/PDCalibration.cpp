@@ -273,6 +273,10 @@ void PDCalibration::init() {
                   "Flag whether the input data has high background compared to peaks' heights. "
                   "This option is recommended for data with peak-to-background ratios under ~5.");
 
+  declareProperty("LightweightFitting", false,
+                  "If true FitPeaks fits the peaks in process with a reusable fitter for each thread, "
+                  "instead of running the Fit algorithm for every peak.");
+
   declareProperty("MinimumSignalToNoiseRatio", 0.,
                   "Used for validating peaks before fitting. If the signal-to-noise ratio is under this value, "
                   "the peak will be excluded from fitting and calibration. This check does not apply to peaks for "
@@ -344,6 +348,7 @@ void PDCalibration::init() {
   setPropertyGroup("HighBackground", fitPeaksGroup);
   setPropertyGroup("MaxChiSq", fitPeaksGroup);
   setPropertyGroup("ConstrainPeakPositions", fitPeaksGroup);
+  setPropertyGroup("LightweightFitting", fitPeaksGroup);
 
   // make group for type of calibration
   std::string calGroup("Calibration Type");
@@ -595,6 +600,8 @@ void PDCalibration::exec() {
   //  optimization setup // TODO : need to test LM or LM-MD
   algFitPeaks->setProperty("Minimizer", "Levenberg-Marquardt");
   algFitPeaks->setProperty("CostFunction", "Least squares");
+  const bool lightweightFitting = getProperty("LightweightFitting");
+  algFitPeaks->setProperty("LightweightFitting", lightweightFitting);
 
   // FitPeaks will abstract the peak parameters if you ask (if using chisq then
   // need FitPeaks to output fitted params rather than height, width)
@@ -0,0 +1,279 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/PeakFitEngine.h"
+#include "MantidAPI/FunctionDomain1D.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Mantid::Algorithms {
+
+namespace {
+/// The fit has converged when a step reduces chi squared by less than this fraction
+constexpr double RELATIVE_TOLERANCE{1e-4};
+/// Starting value of the Levenberg-Marquardt damping factor
+constexpr double INITIAL_DAMPING{1e-3};
+/// The fit is at a minimum when no step shorter than this damping reduces chi squared
+constexpr double MAX_DAMPING{1e10};
+/// Relative step for differentiating a declared parameter with respect to its active parameter
+constexpr double DERIVATIVE_STEP{std::numeric_limits<double>::epsilon() * 100};
+
+/**
+ * Solve the n x n linear system in place by Gaussian elimination with partial pivoting
+ * @param matrix :: the matrix in row major order, overwritten
+ * @param rhs :: the right hand side, overwritten with the solution
+ * @param n :: the size of the system
+ * @return false if the matrix is singular
+ */
+bool solveInPlace(std::vector<double> &matrix, std::vector<double> &rhs, const size_t n) {
+  for (size_t col = 0; col < n; ++col) {
+    size_t pivot = col;
+    for (size_t row = col + 1; row < n; ++row) {
+      if (std::abs(matrix[row * n + col]) > std::abs(matrix[pivot * n + col]))
+        pivot = row;
+    }
+    if (matrix[pivot * n + col] == 0.0)
+      return false;
+    if (pivot != col) {
+      std::swap_ranges(matrix.begin() + col * n, matrix.begin() + (col + 1) * n, matrix.begin() + pivot * n);
+      std::swap(rhs[col], rhs[pivot]);
+    }
+    for (size_t row = col + 1; row < n; ++row) {
+      const double factor = matrix[row * n + col] / matrix[col * n + col];
+      for (size_t k = col; k < n; ++k)
+        matrix[row * n + k] -= factor * matrix[col * n + k];
+      rhs[row] -= factor * rhs[col];
+    }
+  }
+  for (size_t row = n; row-- > 0;) {
+    double sum = rhs[row];
+    for (size_t k = row + 1; k < n; ++k)
+      sum -= matrix[row * n + k] * rhs[k];
+    rhs[row] = sum / matrix[row * n + row];
+  }
+  return true;
+}
+} // namespace
+
+/// Resize the buffer, reusing its memory if it is large enough
+void PeakFitEngine::FlatJacobian::resize(const size_t nData, const size_t nParams) {
+  m_nParams = nParams;
+  m_data.resize(nData * nParams);
+}
+
+/**
+ * Constructor
+ * @param maxIterations :: the maximum number of iterations of each fit
+ */
+PeakFitEngine::PeakFitEngine(const size_t maxIterations) : m_maxIterations(maxIterations) {}
+
+/**
+ * Keep a declared parameter of the fitted function within limits. The parameter is clamped after each step.
+ * @param index :: declared index of the parameter in the function passed to fit()
+ * @param lower :: the lower limit
+ * @param upper :: the upper limit
+ */
+void PeakFitEngine::setParameterBounds(const size_t index, const double lower, const double upper) {
+  if (lower > upper)
+    throw std::invalid_argument("PeakFitEngine: the lower bound of a parameter is larger than the upper bound");
+  auto existing =
+      std::find_if(m_bounds.begin(), m_bounds.end(), [index](const auto &bounds) { return bounds.index == index; });
+  if (existing != m_bounds.end()) {
+    existing->lower = lower;
+    existing->upper = upper;
+  } else {
+    m_bounds.emplace_back(Bounds{index, lower, upper});
+  }
+}
+
+/// Remove all the parameter bounds
+void PeakFitEngine::clearParameterBounds() { m_bounds.clear(); }
+
+/**
+ * Fit a function to parts of a spectrum. The function's parameter values are the starting point and are replaced by
+ * the fitted values, with their errors, if the fit converges.
+ * @param function :: the function to fit
+ * @param x :: the x values (point data)
+ * @param y :: the y values
+ * @param e :: the errors
+ * @param ranges :: the ranges of indices to fit
+ * @return chi squared divided by the degrees of freedom, or DBL_MAX if the fit failed
+ */
+double PeakFitEngine::fit(API::IFunction &function, const std::vector<double> &x, const std::vector<double> &y,
+                          const std::vector<double> &e, std::initializer_list<IndexRange> ranges) {
+  constexpr double FAILED{std::numeric_limits<double>::max()};
+  m_iterations = 0;
+  m_converged = false;
+
+  m_x.clear();
+  m_y.clear();
+  m_weights.clear();
+  for (const auto &[first, last] : ranges) {
+    if (first > last || last > x.size() || last > y.size() || last > e.size())
+      throw std::invalid_argument("PeakFitEngine: fit range is outside of the data");
+    for (size_t i = first; i < last; ++i) {
+      m_x.emplace_back(x[i]);
+      m_y.emplace_back(y[i]);
+      // ignore invalid data as Fit does
+      m_weights.emplace_back(std::isfinite(y[i]) && std::isfinite(e[i]) && e[i] > 0.0 ? 1.0 / e[i] : 0.0);
+    }
+  }
+
+  m_active.clear();
+  for (size_t i = 0; i < function.nParams(); ++i) {
+    if (function.isActive(i))
+      m_active.emplace_back(i);
+  }
+  const size_t nActive = m_active.size();
+  const size_t nData = m_x.size();
+  if (nActive == 0 || nData <= nActive)
+    return FAILED;
+
+  m_parameters.resize(nActive);
+  for (size_t k = 0; k < nActive; ++k)
+    m_parameters[k] = function.activeParameter(m_active[k]);
+  m_trial.resize(nActive);
+  m_hessian.resize(nActive * nActive);
+  m_gradient.resize(nActive);
+  m_system.resize(nActive * nActive);
+  m_step.resize(nActive);
+  m_jacobian.resize(nData, function.nParams());
+
+  double chi2 = calculateChiSquared(function);
+  if (!std::isfinite(chi2))
+    return FAILED;
+
+  double damping = INITIAL_DAMPING;
+  while (!m_converged && m_iterations < m_maxIterations) {
+    ++m_iterations;
+    calculateNormalEquations(function);
+    bool improved = false;
+    while (!improved && damping <= MAX_DAMPING) {
+      std::copy(m_hessian.cbegin(), m_hessian.cend(), m_system.begin());
+      for (size_t k = 0; k < nActive; ++k)
+        m_system[k * nActive + k] += damping * std::max(m_hessian[k * nActive + k], 1e-300);
+      std::copy(m_gradient.cbegin(), m_gradient.cend(), m_step.begin());
+      if (!solveInPlace(m_system, m_step, nActive)) {
+        damping *= 10.;
+        continue;
+      }
+      for (size_t k = 0; k < nActive; ++k)
+        m_trial[k] = m_parameters[k] + m_step[k];
+      setActiveParameters(function, m_trial);
+      const double trialChi2 = calculateChiSquared(function);
+      if (std::isfinite(trialChi2) && trialChi2 <= chi2) {
+        improved = true;
+        m_converged = chi2 - trialChi2 <= RELATIVE_TOLERANCE * trialChi2;
+        chi2 = trialChi2;
+        // the bounds and ties may have changed the step
+        for (size_t k = 0; k < nActive; ++k)
+          m_parameters[k] = function.activeParameter(m_active[k]);
+        damping = std::max(damping / 10., 1e-10);
+      } else {
+        damping *= 10.;
+      }
+    }
+    if (!improved) {
+      // no step reduces chi squared any further so this is the minimum
+      setActiveParameters(function, m_parameters);
+      chi2 = calculateChiSquared(function);
+      m_converged = true;
+    }
+  }
+  if (!m_converged)
+    return FAILED;
+
+  calculateErrors(function);
+  return chi2 / static_cast<double>(nData - nActive);
+}
+
+/// Calculate the function at the fitted points and return the weighted sum of squared residuals
+double PeakFitEngine::calculateChiSquared(API::IFunction &function) {
+  API::FunctionDomain1DView domain(m_x.data(), m_x.size());
+  m_values.reset(domain);
+  function.function(domain, m_values);
+  double chi2(0.);
+  for (size_t i = 0; i < m_x.size(); ++i) {
+    if (m_weights[i] == 0.0)
+      continue;
+    const double residual = (m_y[i] - m_values.getCalculated(i)) * m_weights[i];
+    chi2 += residual * residual;
+  }
+  return chi2;
+}
+
+/// Calculate J^T W J and J^T W r for the active parameters at the values last calculated
+void PeakFitEngine::calculateNormalEquations(API::IFunction &function) {
+  API::FunctionDomain1DView domain(m_x.data(), m_x.size());
+  m_jacobian.zero();
+  function.functionDeriv(domain, m_jacobian);
+
+  const size_t nActive = m_active.size();
+  std::fill(m_hessian.begin(), m_hessian.end(), 0.0);
+  std::fill(m_gradient.begin(), m_gradient.end(), 0.0);
+  for (size_t i = 0; i < m_x.size(); ++i) {
+    const double weight = m_weights[i];
+    if (weight == 0.0)
+      continue;
+    const double residual = (m_y[i] - m_values.getCalculated(i)) * weight;
+    for (size_t a = 0; a < nActive; ++a) {
+      const double derivA = m_jacobian.get(i, m_active[a]) * weight;
+      m_gradient[a] += derivA * residual;
+      for (size_t b = 0; b <= a; ++b)
+        m_hessian[a * nActive + b] += derivA * m_jacobian.get(i, m_active[b]) * weight;
+    }
+  }
+  for (size_t a = 0; a < nActive; ++a) {
+    for (size_t b = a + 1; b < nActive; ++b)
+      m_hessian[a * nActive + b] = m_hessian[b * nActive + a];
+  }
+}
+
+/// Set the active parameters, then apply the bounds and the ties
+void PeakFitEngine::setActiveParameters(API::IFunction &function, const std::vector<double> &parameters) {
+  for (size_t k = 0; k < m_active.size(); ++k)
+    function.setActiveParameter(m_active[k], parameters[k]);
+  for (const auto &bounds : m_bounds) {
+    const double value = function.getParameter(bounds.index);
+    const double clamped = std::clamp(value, bounds.lower, bounds.upper);
+    if (clamped != value)
+      function.setParameter(bounds.index, clamped);
+  }
+  function.applyTies();
+}
+
+/**
+ * Set the errors of the fitted parameters from the diagonal of the covariance matrix, the inverse of J^T W J,
+ * transformed from the active to the declared parameters.
+ */
+void PeakFitEngine::calculateErrors(API::IFunction &function) {
+  calculateNormalEquations(function);
+  for (size_t i = 0; i < function.nParams(); ++i)
+    function.setError(i, 0.);
+
+  const size_t nActive = m_active.size();
+  for (size_t k = 0; k < nActive; ++k) {
+    std::copy(m_hessian.cbegin(), m_hessian.cend(), m_system.begin());
+    std::fill(m_step.begin(), m_step.end(), 0.0);
+    m_step[k] = 1.0;
+    if (!solveInPlace(m_system, m_step, nActive))
+      continue;
+    const double variance = std::max(m_step[k], 0.0);
+
+    const size_t index = m_active[k];
+    const double declared = function.getParameter(index);
+    const double active = m_parameters[k];
+    const double delta = active == 0.0 ? DERIVATIVE_STEP : active * DERIVATIVE_STEP;
+    function.setActiveParameter(index, active + delta);
+    const double derivative = (function.getParameter(index) - declared) / delta;
+    function.setParameter(index, declared);
+    function.setError(index, std::sqrt(variance) * std::abs(derivative));
+  }
+}
+
+} // namespace Mantid::Algorithms
@@ -6,17 +6,44 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/SampleCorrections/MCAbsorptionStrategy.h"
 #include "MantidAlgorithms/SampleCorrections/IBeamProfile.h"
+#include "MantidKernel/Material.h"
 #include "MantidKernel/PseudoRandomNumberGenerator.h"
 #include "MantidKernel/V3D.h"
 
 #include "MantidGeometry/Objects/CSGObject.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace Mantid {
 using Kernel::DeltaEMode;
 using Kernel::PseudoRandomNumberGenerator;
+using Kernel::V3D;
 
 namespace Algorithms {
 
+namespace {
+/// The most tracks whose path lengths are calculated in one call
+constexpr size_t TRACK_BLOCK_SIZE{1024};
+
+std::string trackGenerationError(const size_t maxScatterAttempts) {
+  return "Unable to generate valid track through "
+         "sample interaction volume after " +
+         std::to_string(maxScatterAttempts) +
+         " attempts. Try increasing the maximum "
+         "threshold or if this does not help then "
+         "please check the defined shape and, "
+         "if defined, the gauge volume (both its shape "
+         "and its intersection with the defined sample shape).";
+}
+
+/// @return true if a track of the block passes through none of the objects before scattering
+bool missesVolume(const std::vector<double> &before, const size_t track, const size_t nobjects) {
+  const auto first = before.cbegin() + static_cast<std::ptrdiff_t>(track * nobjects);
+  return std::all_of(first, first + static_cast<std::ptrdiff_t>(nobjects), [](double length) { return length <= 0.0; });
+}
+} // namespace
+
 /**
  * Constructor
  * @param interactionVolume A reference to the MCInteractionVolume dependency
@@ -73,58 +100,55 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng, c
   const auto nbins = static_cast<int>(lambdas.size());
   Geometry::IObject_sptr gv = m_scatterVol->getGaugeVolume();
 
-  std::vector<double> wgtMean(attenuationFactors.size()), wgtM2(attenuationFactors.size());
-
-  for (size_t i = 0; i < m_nevents; ++i) {
-    std::shared_ptr<Geometry::Track> beforeScatter;
-    std::shared_ptr<Geometry::Track> afterScatter;
-    for (int j = 0; j < nbins; ++j) {
-      size_t attempts(0);
-      do {
-        bool success = false;
-        if (m_regenerateTracksForEachLambda || j == 0) {
-          const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
-          std::tie(success, beforeScatter, afterScatter) =
-              m_scatterVol->calculateBeforeAfterTrack(rng, neutron.startPos, finalPos, stats);
-        } else {
-          success = true;
-        }
-        if (!success) {
-          ++attempts;
-        } else {
-          const double lambdaStep = lambdas[j];
-          double lambdaIn(lambdaStep), lambdaOut(lambdaStep);
-          if (m_EMode == DeltaEMode::Direct) {
-            lambdaIn = lambdaFixed;
-          } else if (m_EMode == DeltaEMode::Indirect) {
-            lambdaOut = lambdaFixed;
+  if (m_scatterVol->canCalculateTrackLengths()) {
+    accumulateFromTrackLengths(rng, finalPos, lambdas, lambdaFixed, attenuationFactors, attFactorErrors, stats);
+  } else {
+    std::vector<double> wgtMean(attenuationFactors.size()), wgtM2(attenuationFactors.size());
+
+    for (size_t i = 0; i < m_nevents; ++i) {
+      std::shared_ptr<Geometry::Track> beforeScatter;
+      std::shared_ptr<Geometry::Track> afterScatter;
+      for (int j = 0; j < nbins; ++j) {
+        size_t attempts(0);
+        do {
+          bool success = false;
+          if (m_regenerateTracksForEachLambda || j == 0) {
+            const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+            std::tie(success, beforeScatter, afterScatter) =
+                m_scatterVol->calculateBeforeAfterTrack(rng, neutron.startPos, finalPos, stats);
           } else {
-            // elastic case already initialized
+            success = true;
           }
-          const double wgt =
-              beforeScatter->calculateAttenuation(lambdaIn) * afterScatter->calculateAttenuation(lambdaOut);
-          attenuationFactors[j] += wgt;
-          // increment standard deviation using Welford algorithm
-          double delta = wgt - wgtMean[j];
-          wgtMean[j] += delta / static_cast<double>(i + 1);
-          wgtM2[j] += delta * (wgt - wgtMean[j]);
-          // calculate sample SD (M2/n-1)
-          // will give NaN for m_events=1, but that's correct
-          attFactorErrors[j] = sqrt(wgtM2[j] / static_cast<double>(i));
-
-          break;
-        }
-        if (attempts == m_maxScatterAttempts) {
-          throw std::runtime_error("Unable to generate valid track through "
-                                   "sample interaction volume after " +
-                                   std::to_string(m_maxScatterAttempts) +
-                                   " attempts. Try increasing the maximum "
-                                   "threshold or if this does not help then "
-                                   "please check the defined shape and, "
-                                   "if defined, the gauge volume (both its shape "
-                                   "and its intersection with the defined sample shape).");
-        }
-      } while (true);
+          if (!success) {
+            ++attempts;
+          } else {
+            const double lambdaStep = lambdas[j];
+            double lambdaIn(lambdaStep), lambdaOut(lambdaStep);
+            if (m_EMode == DeltaEMode::Direct) {
+              lambdaIn = lambdaFixed;
+            } else if (m_EMode == DeltaEMode::Indirect) {
+              lambdaOut = lambdaFixed;
+            } else {
+              // elastic case already initialized
+            }
+            const double wgt =
+                beforeScatter->calculateAttenuation(lambdaIn) * afterScatter->calculateAttenuation(lambdaOut);
+            attenuationFactors[j] += wgt;
+            // increment standard deviation using Welford algorithm
+            double delta = wgt - wgtMean[j];
+            wgtMean[j] += delta / static_cast<double>(i + 1);
+            wgtM2[j] += delta * (wgt - wgtMean[j]);
+            // calculate sample SD (M2/n-1)
+            // will give NaN for m_events=1, but that's correct
+            attFactorErrors[j] = sqrt(wgtM2[j] / static_cast<double>(i));
+
+            break;
+          }
+          if (attempts == m_maxScatterAttempts) {
+            throw std::runtime_error(trackGenerationError(m_maxScatterAttempts));
+          }
+        } while (true);
+      }
     }
   }
 
@@ -136,5 +160,109 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng, c
                  [this](double v) -> double { return v / sqrt(static_cast<double>(m_nevents)); });
 }
 
+/**
+ * Accumulate the correction using the path lengths through each object of the interaction volume. The tracks are
+ * generated in blocks of at most TRACK_BLOCK_SIZE and the path lengths of a block are calculated in one call. The
+ * attenuation coefficient of each material is evaluated once per wavelength rather than once per track segment.
+ *
+ * A candidate track draws the same random numbers whether or not it is kept, so a track that misses the volume is
+ * replaced by the next candidate in the block. This keeps the order of the random numbers the same as calculate()
+ * uses track by track.
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param finalPos Defines the final position of the neutron
+ * @param lambdas Set of wavelength values from the input workspace
+ * @param lambdaFixed Efixed value for a detector ID converted to wavelength
+ * @param attenuationFactors [output] The sum of the attenuation factors
+ * @param attFactorErrors [output] The sample standard deviation of the attenuation factors
+ * @param stats A statistics class to hold the statistics on the generated tracks
+ */
+void MCAbsorptionStrategy::accumulateFromTrackLengths(PseudoRandomNumberGenerator &rng, const V3D &finalPos,
+                                                      const std::vector<double> &lambdas, const double lambdaFixed,
+                                                      std::vector<double> &attenuationFactors,
+                                                      std::vector<double> &attFactorErrors,
+                                                      MCInteractionStatistics &stats) {
+  const auto scatterBounds = m_scatterVol->getFullBoundingBox();
+  const size_t nbins = lambdas.size();
+  const size_t tracksPerEvent = nbins == 0 ? 0 : (m_regenerateTracksForEachLambda ? nbins : 1);
+  const size_t ntracks = m_nevents * tracksPerEvent;
+
+  std::vector<V3D> startPositions;
+  std::vector<ComponentScatterPoint> scatterPoints;
+  IMCInteractionVolume::ScatterTrackLengths lengths;
+  // attenuation coefficient of each object for each wavelength, indexed by bin * nobjects + object
+  std::vector<double> coefficientIn, coefficientOut;
+  std::vector<double> wgtMean(nbins), wgtM2(nbins);
+  size_t track(0), attempts(0);
+  while (track < ntracks) {
+    const size_t blockSize = std::min(TRACK_BLOCK_SIZE, ntracks - track);
+    startPositions.resize(blockSize);
+    scatterPoints.resize(blockSize);
+    for (size_t i = 0; i < blockSize; ++i) {
+      startPositions[i] = m_beamProfile.generatePoint(rng, scatterBounds).startPos;
+      scatterPoints[i] = m_scatterVol->generatePoint(rng);
+      stats.UpdateScatterPointCounts(scatterPoints[i].componentIndex, false);
+    }
+    m_scatterVol->calculateTrackLengths(startPositions, scatterPoints, finalPos, lengths);
+    const size_t nobjects = lengths.materials.size();
+    if (coefficientIn.empty()) {
+      coefficientIn.resize(nbins * nobjects);
+      coefficientOut.resize(nbins * nobjects);
+      for (size_t j = 0; j < nbins; ++j) {
+        double lambdaIn(lambdas[j]), lambdaOut(lambdas[j]);
+        if (m_EMode == DeltaEMode::Direct) {
+          lambdaIn = lambdaFixed;
+        } else if (m_EMode == DeltaEMode::Indirect) {
+          lambdaOut = lambdaFixed;
+        }
+        for (size_t k = 0; k < nobjects; ++k) {
+          coefficientIn[j * nobjects + k] = lengths.materials[k]->attenuationCoefficient(lambdaIn);
+          coefficientOut[j * nobjects + k] = lengths.materials[k]->attenuationCoefficient(lambdaOut);
+        }
+      }
+    }
+
+    for (size_t i = 0; i < blockSize; ++i) {
+      // This should not happen but numerical precision means that it can
+      // occasionally occur with tracks that are very close to the surface
+      if (missesVolume(lengths.before, i, nobjects)) {
+        if (++attempts == m_maxScatterAttempts) {
+          throw std::runtime_error(trackGenerationError(m_maxScatterAttempts));
+        }
+        continue;
+      }
+      attempts = 0;
+      const auto &scatterPoint = scatterPoints[i].scatterPoint;
+      stats.UpdateScatterPointCounts(scatterPoints[i].componentIndex, true);
+      stats.UpdateScatterAngleStats(normalize(startPositions[i] - scatterPoint), normalize(finalPos - scatterPoint));
+
+      // the track is used for one wavelength, or for all of them if the tracks are not regenerated
+      const size_t event = track / tracksPerEvent;
+      const size_t firstBin = m_regenerateTracksForEachLambda ? track % tracksPerEvent : 0;
+      const size_t lastBin = m_regenerateTracksForEachLambda ? firstBin + 1 : nbins;
+      const double *before = lengths.before.data() + i * nobjects;
+      const double *after = lengths.after.data() + i * nobjects;
+      for (size_t j = firstBin; j < lastBin; ++j) {
+        double exponent(0.0);
+        for (size_t k = 0; k < nobjects; ++k) {
+          exponent += coefficientIn[j * nobjects + k] * before[k] + coefficientOut[j * nobjects + k] * after[k];
+        }
+        const double wgt = std::exp(-exponent);
+        attenuationFactors[j] += wgt;
+        // increment standard deviation using Welford algorithm
+        const double delta = wgt - wgtMean[j];
+        wgtMean[j] += delta / static_cast<double>(event + 1);
+        wgtM2[j] += delta * (wgt - wgtMean[j]);
+      }
+      ++track;
+    }
+  }
+  // calculate sample SD (M2/n-1)
+  // will give NaN for m_events=1, but that's correct
+  if (ntracks > 0) {
+    for (size_t j = 0; j < nbins; ++j)
+      attFactorErrors[j] = sqrt(wgtM2[j] / static_cast<double>(m_nevents - 1));
+  }
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -253,5 +253,52 @@ TrackPair MCInteractionVolume::calculateBeforeAfterTrack(Kernel::PseudoRandomNum
   return {true, beforeScatter, afterScatter};
 }
 
+/**
+ * Calculate the distance travelled inside the sample and each environment component before and after scattering
+ * for a batch of scatter points. Each object intersects all the rays in one call, which avoids building a Track per
+ * ray. The objects are the sample followed by the environment components.
+ * @param startPositions Origin of the initial track for each scatter point
+ * @param scatterPoints The scatter points, e.g. from generatePoint
+ * @param endPos Final position of neutron after scattering (assumed to be
+ * outside of the "volume")
+ * @param lengths [output] The materials of the objects and the path lengths
+ * through them
+ */
+void MCInteractionVolume::calculateTrackLengths(const std::vector<Kernel::V3D> &startPositions,
+                                                const std::vector<ComponentScatterPoint> &scatterPoints,
+                                                const Kernel::V3D &endPos, ScatterTrackLengths &lengths) const {
+  if (startPositions.size() != scatterPoints.size())
+    throw std::invalid_argument("MCInteractionVolume::calculateTrackLengths() - the number of start positions and "
+                                "scatter points differ");
+  std::vector<const Geometry::IObject *> objects{m_sample.get()};
+  if (m_env) {
+    for (size_t i = 0; i < m_env->nelements(); ++i)
+      objects.emplace_back(&m_env->getComponent(i));
+  }
+  const size_t nobjects = objects.size();
+  const size_t npoints = scatterPoints.size();
+  lengths.materials.resize(nobjects);
+  lengths.before.resize(npoints * nobjects);
+  lengths.after.resize(npoints * nobjects);
+
+  // the tracks start at the scatter point, see calculateBeforeAfterTrack
+  std::vector<V3D> origins(npoints), toStart(npoints), scatteredDirec(npoints);
+  for (size_t i = 0; i < npoints; ++i) {
+    origins[i] = scatterPoints[i].scatterPoint;
+    toStart[i] = normalize(startPositions[i] - origins[i]);
+    scatteredDirec[i] = normalize(endPos - origins[i]);
+  }
+  std::vector<double> distances;
+  for (size_t k = 0; k < nobjects; ++k) {
+    lengths.materials[k] = &objects[k]->material();
+    objects[k]->distancesInside(origins, toStart, distances);
+    for (size_t i = 0; i < npoints; ++i)
+      lengths.before[i * nobjects + k] = distances[i];
+    objects[k]->distancesInside(origins, scatteredDirec, distances);
+    for (size_t i = 0; i < npoints; ++i)
+      lengths.after[i * nobjects + k] = distances[i];
+  }
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -309,6 +309,72 @@ public:
     FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
   }
 
+  //----------------------------------------------------------------------------------------------
+  /** Test that fitting in process with LightweightFitting gives the same peaks as the Fit algorithm
+   * @brief test_lightweightFittingMatchesFit
+   */
+  void test_lightweightFittingMatchesFit() {
+    generateTestDataGaussian(m_inputWorkspaceName);
+
+    auto runFitPeaks = [this](const bool lightweight, const std::string &suffix) {
+      FitPeaks fitpeaks;
+      fitpeaks.initialize();
+      fitpeaks.setRethrows(true);
+      fitpeaks.setProperty("InputWorkspace", m_inputWorkspaceName);
+      fitpeaks.setProperty("PeakCenters", "5.0, 10.0");
+      fitpeaks.setProperty("FitWindowBoundaryList", "2.5, 6.5, 8.0, 12.0");
+      fitpeaks.setProperty("HighBackground", false);
+      fitpeaks.setProperty("ConstrainPeakPositions", true);
+      fitpeaks.setProperty("LightweightFitting", lightweight);
+      fitpeaks.setProperty("OutputWorkspace", "PeakPositionsWS" + suffix);
+      fitpeaks.setProperty("OutputPeakParametersWorkspace", "PeakParametersWS" + suffix);
+      fitpeaks.setProperty("OutputParameterFitErrorsWorkspace", "PeakErrorsWS" + suffix);
+      fitpeaks.setProperty("FittedPeaksWorkspace", "FittedPeaksWS" + suffix);
+      TS_ASSERT_THROWS_NOTHING(fitpeaks.execute());
+      TS_ASSERT(fitpeaks.isExecuted());
+    };
+    runFitPeaks(false, "_Fit");
+    runFitPeaks(true, "_Lightweight");
+
+    auto &ads = AnalysisDataService::Instance();
+    const auto positions = ads.retrieveWS<MatrixWorkspace>("PeakPositionsWS_Fit");
+    const auto lightweightPositions = ads.retrieveWS<MatrixWorkspace>("PeakPositionsWS_Lightweight");
+    TS_ASSERT_EQUALS(lightweightPositions->getNumberHistograms(), 3);
+    for (size_t i = 0; i < positions->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < 2; ++j)
+        TS_ASSERT_DELTA(lightweightPositions->y(i)[j], positions->y(i)[j], 1e-4);
+    }
+
+    // height, centre, sigma and background, with their errors
+    for (const std::string table : {"PeakParametersWS", "PeakErrorsWS"}) {
+      const auto params = ads.retrieveWS<ITableWorkspace>(table + "_Fit");
+      const auto lightweightParams = ads.retrieveWS<ITableWorkspace>(table + "_Lightweight");
+      TS_ASSERT_EQUALS(lightweightParams->rowCount(), params->rowCount());
+      for (size_t row = 0; row < params->rowCount(); ++row) {
+        for (size_t col = 2; col < 7; ++col) {
+          const double expected = params->cell<double>(row, col);
+          TS_ASSERT_DELTA(lightweightParams->cell<double>(row, col), expected, 1e-3 * std::max(1., std::abs(expected)));
+        }
+      }
+    }
+
+    ads.remove(m_inputWorkspaceName);
+    for (const std::string suffix : {"_Fit", "_Lightweight"}) {
+      for (const std::string name : {"PeakPositionsWS", "PeakParametersWS", "PeakErrorsWS", "FittedPeaksWS"})
+        ads.remove(name + suffix);
+    }
+  }
+
+  void test_lightweightFittingRequiresLeastSquares() {
+    FitPeaks fitpeaks;
+    fitpeaks.initialize();
+    fitpeaks.setProperty("LightweightFitting", true);
+    fitpeaks.setProperty("CostFunction", "Rwp");
+    const auto issues = fitpeaks.validateInputs();
+    TS_ASSERT_EQUALS(issues.count("CostFunction"), 1);
+    TS_ASSERT_EQUALS(issues.count("Minimizer"), 0);
+  }
+
   //----------------------------------------------------------------------------------------------
   /** Test output of effective peak parameters
    * @brief test_effectivePeakParameters
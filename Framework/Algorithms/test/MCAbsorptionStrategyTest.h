@@ -19,6 +19,7 @@
 #include "MantidGeometry/Objects/BoundingBox.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MersenneTwister.h"
 #include "MantidKernel/WarningSuppressions.h"
 #include "MonteCarloTesting.h"
 
@@ -178,6 +179,24 @@ public:
     TS_ASSERT_EQUALS(attenuationFactors[0], 3.0);
   }
 
+  void test_track_lengths_match_track_by_track_calculation() {
+    using namespace MonteCarloTesting;
+
+    const auto sample = createTestSample(TestSampleType::SamplePlusContainer);
+    for (const bool regenerateTracks : {false, true}) {
+      for (const auto emode : {Mantid::Kernel::DeltaEMode::Elastic, Mantid::Kernel::DeltaEMode::Direct}) {
+        const auto batched = runSimulation(sample, MCInteractionVolume::create(sample), emode, regenerateTracks);
+        const auto trackByTrack =
+            runSimulation(sample, std::make_shared<TrackByTrackInteractionVolume>(MCInteractionVolume::create(sample)),
+                          emode, regenerateTracks);
+        for (size_t i = 0; i < batched.first.size(); ++i) {
+          TS_ASSERT_DELTA(trackByTrack.first[i], batched.first[i], 1e-10);
+          TS_ASSERT_DELTA(trackByTrack.second[i], batched.second[i], 1e-10);
+        }
+      }
+    }
+  }
+
   //----------------------------------------------------------------------------
   // Failure cases
   //----------------------------------------------------------------------------
@@ -210,6 +229,57 @@ public:
   }
 
 private:
+  /// Forwards to another volume but only supports the track by track calculation
+  class TrackByTrackInteractionVolume final : public IMCInteractionVolume {
+  public:
+    explicit TrackByTrackInteractionVolume(std::shared_ptr<IMCInteractionVolume> volume)
+        : m_volume(std::move(volume)) {}
+    Mantid::Algorithms::TrackPair calculateBeforeAfterTrack(Mantid::Kernel::PseudoRandomNumberGenerator &rng,
+                                                            const Mantid::Kernel::V3D &startPos,
+                                                            const Mantid::Kernel::V3D &endPos,
+                                                            MCInteractionStatistics &stats) const override {
+      return m_volume->calculateBeforeAfterTrack(rng, startPos, endPos, stats);
+    }
+    Mantid::Algorithms::ComponentScatterPoint
+    generatePoint(Mantid::Kernel::PseudoRandomNumberGenerator &rng) const override {
+      return m_volume->generatePoint(rng);
+    }
+    const Mantid::Geometry::BoundingBox getFullBoundingBox() const override { return m_volume->getFullBoundingBox(); }
+    void setActiveRegion(const Mantid::Geometry::BoundingBox &region) override { m_volume->setActiveRegion(region); }
+    Mantid::Geometry::IObject_sptr getGaugeVolume() const override { return m_volume->getGaugeVolume(); }
+    void setGaugeVolume(Mantid::Geometry::IObject_sptr gaugeVolume) override {
+      m_volume->setGaugeVolume(std::move(gaugeVolume));
+    }
+
+  protected:
+    void init() override {}
+
+  private:
+    std::shared_ptr<IMCInteractionVolume> m_volume;
+  };
+
+  /// Run a simulation with a fixed seed and return the attenuation factors and their errors
+  std::pair<std::vector<double>, std::vector<double>> runSimulation(const Mantid::API::Sample &sample,
+                                                                    std::shared_ptr<IMCInteractionVolume> volume,
+                                                                    const Mantid::Kernel::DeltaEMode::Type emode,
+                                                                    const bool regenerateTracks) {
+    using Mantid::Algorithms::RectangularBeamProfile;
+    using namespace Mantid::Geometry;
+    using namespace Mantid::Kernel;
+
+    RectangularBeamProfile beamProfile(ReferenceFrame(Z, X, Right, "source"), V3D(-10, 0, 0), 0.05, 0.05);
+    // enough tracks to span more than one block when they are regenerated for each wavelength
+    MCAbsorptionStrategy strategy(volume, beamProfile, emode, 300, 100, regenerateTracks);
+    MersenneTwister rng(12345);
+    const std::vector<double> lambdas = {0.5, 1.5, 2.5, 3.5};
+    std::vector<double> attenuationFactors(lambdas.size(), 0.);
+    std::vector<double> attenuationFactorErrors(lambdas.size(), 0.);
+    MCInteractionStatistics trackStatistics(-1, sample);
+    strategy.calculate(rng, V3D(0.3, 1.2, 0.1), lambdas, 1.8, attenuationFactors, attenuationFactorErrors,
+                       trackStatistics);
+    return {attenuationFactors, attenuationFactorErrors};
+  }
+
   class MockBeamProfile final : public Mantid::Algorithms::IBeamProfile {
   public:
     using Mantid::Algorithms::IBeamProfile::Ray;
@@ -260,3 +330,45 @@ private:
 
   Mantid::Kernel::Logger g_log{"MCAbsorptionStrategyTest"};
 };
+
+class MCAbsorptionStrategyTestPerformance : public CxxTest::TestSuite {
+public:
+  static MCAbsorptionStrategyTestPerformance *createSuite() { return new MCAbsorptionStrategyTestPerformance(); }
+  static void destroySuite(MCAbsorptionStrategyTestPerformance *suite) { delete suite; }
+
+  MCAbsorptionStrategyTestPerformance()
+      : m_sample(MonteCarloTesting::createTestSample(MonteCarloTesting::TestSampleType::SamplePlusContainer)),
+        m_beamProfile(Mantid::Geometry::ReferenceFrame(Mantid::Geometry::Z, Mantid::Geometry::X,
+                                                       Mantid::Geometry::Right, "source"),
+                      Mantid::Kernel::V3D(-10, 0, 0), 0.05, 0.05),
+        m_lambdas(100) {
+    for (size_t i = 0; i < m_lambdas.size(); ++i)
+      m_lambdas[i] = 0.5 + 0.05 * static_cast<double>(i);
+  }
+
+  void test_calculate_with_sample_and_container() {
+    MCAbsorptionStrategy strategy(MCInteractionVolume::create(m_sample), m_beamProfile,
+                                  Mantid::Kernel::DeltaEMode::Elastic, 10000, 5000, false);
+    runCalculate(strategy);
+  }
+
+  void test_calculate_with_sample_and_container_regenerating_tracks() {
+    MCAbsorptionStrategy strategy(MCInteractionVolume::create(m_sample), m_beamProfile,
+                                  Mantid::Kernel::DeltaEMode::Elastic, 1000, 5000, true);
+    runCalculate(strategy);
+  }
+
+private:
+  void runCalculate(MCAbsorptionStrategy &strategy) {
+    Mantid::Kernel::MersenneTwister rng(12345);
+    std::vector<double> attenuationFactors(m_lambdas.size(), 0.);
+    std::vector<double> attenuationFactorErrors(m_lambdas.size(), 0.);
+    MCInteractionStatistics trackStatistics(-1, m_sample);
+    strategy.calculate(rng, Mantid::Kernel::V3D(0.3, 1.2, 0.1), m_lambdas, 1.8, attenuationFactors,
+                       attenuationFactorErrors, trackStatistics);
+  }
+
+  const Mantid::API::Sample m_sample;
+  const Mantid::Algorithms::RectangularBeamProfile m_beamProfile;
+  std::vector<double> m_lambdas;
+};
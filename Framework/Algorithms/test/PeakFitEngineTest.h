@@ -0,0 +1,230 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/IFunction.h"
+#include "MantidAlgorithms/PeakFitEngine.h"
+#include "MantidKernel/Timer.h"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+using Mantid::Algorithms::PeakFitEngine;
+using namespace Mantid::API;
+
+namespace {
+constexpr double HEIGHT{5.};
+constexpr double CENTRE{3.};
+constexpr double SIGMA{0.2};
+constexpr double A0{1.};
+constexpr double A1{0.1};
+
+/// Gaussian on a linear background, sampled on [0, 6)
+struct PeakData {
+  explicit PeakData(const size_t n = 300) : x(n), y(n), e(n, 0.1) {
+    for (size_t i = 0; i < n; ++i) {
+      x[i] = 6. * static_cast<double>(i) / static_cast<double>(n);
+      y[i] = HEIGHT * std::exp(-0.5 * std::pow((x[i] - CENTRE) / SIGMA, 2)) + A0 + A1 * x[i];
+    }
+  }
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> e;
+};
+
+IFunction_sptr createPeakFunction() {
+  return FunctionFactory::Instance().createInitialized(
+      "name=Gaussian,Height=4,PeakCentre=3.05,Sigma=0.25;name=LinearBackground,A0=0,A1=0");
+}
+} // namespace
+
+class PeakFitEngineTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static PeakFitEngineTest *createSuite() { return new PeakFitEngineTest(); }
+  static void destroySuite(PeakFitEngineTest *suite) { delete suite; }
+
+  // the functions are registered by the CurveFitting library
+  PeakFitEngineTest() { FrameworkManager::Instance(); }
+
+  void test_fit_gaussian_on_linear_background() {
+    const PeakData data;
+    auto function = createPeakFunction();
+    PeakFitEngine engine;
+
+    const double chi2 = engine.fit(*function, data.x, data.y, data.e, {{0, data.x.size()}});
+
+    TS_ASSERT(engine.converged());
+    TS_ASSERT_LESS_THAN(engine.iterations(), 50);
+    TS_ASSERT_DELTA(chi2, 0., 1e-10);
+    TS_ASSERT_DELTA(function->getParameter("f0.Height"), HEIGHT, 1e-6);
+    TS_ASSERT_DELTA(function->getParameter("f0.PeakCentre"), CENTRE, 1e-6);
+    TS_ASSERT_DELTA(function->getParameter("f0.Sigma"), SIGMA, 1e-6);
+    TS_ASSERT_DELTA(function->getParameter("f1.A0"), A0, 1e-6);
+    TS_ASSERT_DELTA(function->getParameter("f1.A1"), A1, 1e-6);
+    for (size_t i = 0; i < function->nParams(); ++i)
+      TS_ASSERT_LESS_THAN(0., function->getError(i));
+  }
+
+  void test_engine_is_reused_for_different_windows() {
+    const PeakData data;
+    PeakFitEngine engine;
+    for (const auto &range : {PeakFitEngine::IndexRange{0, 300}, PeakFitEngine::IndexRange{100, 200},
+                              PeakFitEngine::IndexRange{50, 250}}) {
+      auto function = createPeakFunction();
+      engine.fit(*function, data.x, data.y, data.e, {range});
+      TS_ASSERT(engine.converged());
+      TS_ASSERT_DELTA(function->getParameter("f0.PeakCentre"), CENTRE, 1e-6);
+    }
+  }
+
+  void test_errors_of_straight_line() {
+    const size_t n = 20;
+    const double sigma = 0.5;
+    std::vector<double> x(n), y(n), e(n, sigma);
+    double sumX(0.), sumXX(0.);
+    for (size_t i = 0; i < n; ++i) {
+      x[i] = static_cast<double>(i);
+      y[i] = 2. + 3. * x[i] + (i % 2 == 0 ? 0.1 : -0.1);
+      sumX += x[i];
+      sumXX += x[i] * x[i];
+    }
+    auto function = FunctionFactory::Instance().createInitialized("name=LinearBackground,A0=0,A1=0");
+    PeakFitEngine engine;
+
+    engine.fit(*function, x, y, e, {{0, n}});
+
+    TS_ASSERT(engine.converged());
+    const double determinant = static_cast<double>(n) * sumXX - sumX * sumX;
+    TS_ASSERT_DELTA(function->getError(0), sigma * std::sqrt(sumXX / determinant), 1e-8);
+    TS_ASSERT_DELTA(function->getError(1), sigma * std::sqrt(static_cast<double>(n) / determinant), 1e-8);
+  }
+
+  void test_background_fitted_on_both_sides_of_peak() {
+    const PeakData data;
+    auto function = FunctionFactory::Instance().createInitialized("name=LinearBackground,A0=0,A1=0");
+    PeakFitEngine engine;
+
+    // the peak is more than 7 sigma away from both ranges
+    engine.fit(*function, data.x, data.y, data.e, {{0, 100}, {200, 300}});
+
+    TS_ASSERT(engine.converged());
+    TS_ASSERT_DELTA(function->getParameter("A0"), A0, 1e-6);
+    TS_ASSERT_DELTA(function->getParameter("A1"), A1, 1e-6);
+  }
+
+  void test_bounds_limit_parameter() {
+    const PeakData data;
+    auto function = createPeakFunction();
+    const size_t centreIndex = function->parameterIndex("f0.PeakCentre");
+    PeakFitEngine engine;
+    engine.setParameterBounds(centreIndex, 2.9, 2.95);
+
+    engine.fit(*function, data.x, data.y, data.e, {{0, data.x.size()}});
+    TS_ASSERT_DELTA(function->getParameter(centreIndex), 2.95, 1e-12);
+
+    engine.clearParameterBounds();
+    engine.fit(*function, data.x, data.y, data.e, {{0, data.x.size()}});
+    TS_ASSERT_DELTA(function->getParameter(centreIndex), CENTRE, 1e-6);
+
+    TS_ASSERT_THROWS(engine.setParameterBounds(centreIndex, 3., 2.), const std::invalid_argument &);
+  }
+
+  void test_invalid_data_are_ignored() {
+    PeakData data;
+    data.y[10] = std::numeric_limits<double>::quiet_NaN();
+    data.y[150] = 1000.;
+    data.e[150] = 0.;
+    data.y[200] = 1000.;
+    data.e[200] = std::numeric_limits<double>::infinity();
+    auto function = createPeakFunction();
+    PeakFitEngine engine;
+
+    engine.fit(*function, data.x, data.y, data.e, {{0, data.x.size()}});
+
+    TS_ASSERT(engine.converged());
+    TS_ASSERT_DELTA(function->getParameter("f0.Height"), HEIGHT, 1e-6);
+    TS_ASSERT_DELTA(function->getParameter("f0.PeakCentre"), CENTRE, 1e-6);
+  }
+
+  void test_fixed_parameters_are_not_fitted() {
+    const PeakData data;
+    auto function = createPeakFunction();
+    function->fix(function->parameterIndex("f1.A1"));
+    PeakFitEngine engine;
+
+    engine.fit(*function, data.x, data.y, data.e, {{0, data.x.size()}});
+
+    TS_ASSERT(engine.converged());
+    TS_ASSERT_EQUALS(function->getParameter("f1.A1"), 0.);
+    TS_ASSERT_EQUALS(function->getError(function->parameterIndex("f1.A1")), 0.);
+  }
+
+  void test_fit_fails_without_enough_points() {
+    const PeakData data;
+    auto function = createPeakFunction();
+    PeakFitEngine engine;
+
+    // five parameters and five points
+    const double chi2 = engine.fit(*function, data.x, data.y, data.e, {{148, 153}});
+
+    TS_ASSERT_EQUALS(chi2, std::numeric_limits<double>::max());
+    TS_ASSERT(!engine.converged());
+  }
+
+  void test_range_outside_data_throws() {
+    const PeakData data;
+    auto function = createPeakFunction();
+    PeakFitEngine engine;
+    TS_ASSERT_THROWS(engine.fit(*function, data.x, data.y, data.e, {{0, data.x.size() + 1}}),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(engine.fit(*function, data.x, data.y, data.e, {{20, 10}}), const std::invalid_argument &);
+  }
+};
+
+class PeakFitEngineTestPerformance : public CxxTest::TestSuite {
+public:
+  static PeakFitEngineTestPerformance *createSuite() { return new PeakFitEngineTestPerformance(); }
+  static void destroySuite(PeakFitEngineTestPerformance *suite) { delete suite; }
+
+  PeakFitEngineTestPerformance() : m_function(createPeakFunction()) {}
+
+  void test_fits_per_second() {
+    const PeakData data;
+    const std::vector<double> start = parameterValues();
+    Mantid::Kernel::Timer timer;
+    for (size_t i = 0; i < NUMBER_OF_FITS; ++i) {
+      for (size_t j = 0; j < start.size(); ++j)
+        m_function->setParameter(j, start[j]);
+      // windows of different widths around the peak
+      const size_t halfWidth = 20 + i % 40;
+      m_engine.fit(*m_function, data.x, data.y, data.e, {{150 - halfWidth, 150 + halfWidth}});
+    }
+    const double seconds = timer.elapsed();
+    TS_ASSERT(m_engine.converged());
+    std::cout << "\nPeakFitEngine: " << static_cast<double>(NUMBER_OF_FITS) / seconds << " fits per second\n";
+  }
+
+private:
+  static constexpr size_t NUMBER_OF_FITS{20000};
+
+  std::vector<double> parameterValues() const {
+    std::vector<double> values(m_function->nParams());
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = m_function->getParameter(i);
+    return values;
+  }
+
+  IFunction_sptr m_function;
+  PeakFitEngine m_engine;
+};
@@ -84,6 +84,7 @@ const std::string BINMODE("BinningMode");
 const std::string OUTPUT_WKSP("OutputWorkspace");
 const std::string READ_SIZE_FROM_DISK("ReadSizeFromDisk");
 const std::string EVENTS_PER_THREAD("EventsPerThread");
+const std::string CHUNKS_IN_FLIGHT("ChunksInFlight");
 const std::string ALLOW_LOGS("LogAllowList");
 const std::string BLOCK_LOGS("LogBlockList");
 const std::string OUTPUT_SPEC_NUM("OutputSpectrumNumber");
@@ -26,7 +26,11 @@ public:
   BankCalibration(const detid_t idmin, const detid_t idmax, const double time_conversion,
                   const std::map<detid_t, double> &calibration_map, const std::map<detid_t, double> &scale_at_sample,
                   const std::set<detid_t> &mask);
-  const double &value_calibration(const detid_t detid) const;
+  /**
+   * This assumes that everything is in range. Values that weren't in the calibration map get set to 1. This is inline
+   * so the lookup can be vectorised in ProcessEventsTask.
+   */
+  inline const double &value_calibration(const detid_t detid) const { return m_calibration[detid - m_detid_offset]; }
   /**
    * This returns a value with no bounds checking. If scale_at_sample is not provided, this will have undefined
    * behavior.
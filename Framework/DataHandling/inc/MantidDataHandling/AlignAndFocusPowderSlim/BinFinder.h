@@ -0,0 +1,66 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+
+#pragma once
+
+#include "MantidDataHandling/DllConfig.h"
+#include "MantidDataObjects/EventList.h"
+#include <algorithm>
+#include <vector>
+
+namespace Mantid::DataHandling::AlignAndFocusPowderSlim {
+
+/**
+ * Find the bin an event belongs in. The binning is inspected at construction and if the bin edges are linear or
+ * logarithmic the bin is calculated directly (see EventList::findLinearBin and EventList::findLogBin). Any other
+ * binning falls back to a binary search of the bin edges.
+ *
+ * The bin edges are NOT copied and must outlive this object.
+ */
+class MANTID_DATAHANDLING_DLL BinFinder {
+public:
+  enum class Strategy { LINEAR, LOGARITHMIC, BINARY_SEARCH };
+
+  explicit BinFinder(const std::vector<double> *binedges);
+  BinFinder(const std::vector<double> *binedges, const Strategy strategy);
+
+  Strategy strategy() const;
+
+  /**
+   * Find the bin that contains the supplied time-of-flight. This DOES NO RANGE CHECKING and assumes that
+   * front() <= tof < back() for the bin edges.
+   */
+  inline size_t findBin(const double tof) const {
+    switch (m_strategy) {
+    case Strategy::LINEAR:
+      if (const auto bin = DataObjects::EventList::findLinearBin(*m_binedges, tof, m_divisor, m_offset))
+        return bin.value();
+      break;
+    case Strategy::LOGARITHMIC:
+      if (const auto bin = DataObjects::EventList::findLogBin(*m_binedges, tof, m_divisor, m_offset))
+        return bin.value();
+      break;
+    default:
+      break;
+    }
+    return findBinarySearch(tof);
+  }
+
+private:
+  inline size_t findBinarySearch(const double tof) const {
+    const auto &it = std::upper_bound(m_binedges->cbegin(), m_binedges->cend(), tof);
+    return static_cast<size_t>(std::distance(m_binedges->cbegin(), it) - 1);
+  }
+
+  const std::vector<double> *m_binedges;
+  Strategy m_strategy;
+  /// pre-calculated values for the direct calculation, see EventList::findLinearBin
+  double m_divisor{0.};
+  double m_offset{0.};
+};
+
+} // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
@@ -23,7 +23,7 @@ public:
                   API::MatrixWorkspace_sptr &wksp, const std::map<detid_t, double> &calibration,
                   const std::map<detid_t, double> &scale_at_sample, const std::set<detid_t> &masked,
                   const size_t events_per_chunk, const size_t grainsize_event, std::vector<PulseROI> pulse_indices,
-                  std::shared_ptr<API::Progress> &progress);
+                  std::shared_ptr<API::Progress> &progress, const size_t chunks_in_flight = 2);
 
   void operator()(const tbb::blocked_range<size_t> &range) const;
 
@@ -39,6 +39,8 @@ private:
   const size_t m_events_per_chunk;
   /// number of events to histogram in a single thread
   const size_t m_grainsize_event;
+  /// number of chunks that are read ahead of the one being histogrammed, plus the one being histogrammed
+  const size_t m_chunks_in_flight;
   std::shared_ptr<API::Progress> m_progress;
 };
 } // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
@@ -8,51 +8,61 @@
 #pragma once
 
 #include "MantidDataHandling/AlignAndFocusPowderSlim/BankCalibration.h"
+#include "MantidDataHandling/AlignAndFocusPowderSlim/BinFinder.h"
+#include <array>
 #include <ranges>
 #include <tbb/tbb.h>
 #include <vector>
 
 namespace Mantid::DataHandling::AlignAndFocusPowderSlim {
 
+/// number of events calibrated together before they are histogrammed
+constexpr size_t EVENT_BLOCK_SIZE{16};
+
 template <typename DetIDsVector, typename TofVector> class ProcessEventsTask {
 public:
   ProcessEventsTask(DetIDsVector *detids, TofVector *tofs, const BankCalibration *calibration,
                     const std::vector<double> *binedges)
       : y_temp(binedges->size() - 1, 0), m_detids(detids), m_tofs(tofs), m_calibration(calibration),
-        m_binedges(binedges) {}
+        m_binedges(binedges), m_binfinder(binedges) {}
 
   ProcessEventsTask(ProcessEventsTask &other, tbb::split)
       : y_temp(other.y_temp.size(), 0), m_detids(other.m_detids), m_tofs(other.m_tofs),
-        m_calibration(other.m_calibration), m_binedges(other.m_binedges) {}
+        m_calibration(other.m_calibration), m_binedges(other.m_binedges), m_binfinder(other.m_binfinder) {}
 
   void operator()(const tbb::blocked_range<size_t> &range) {
     // Cache values to reduce number of function calls
     const auto &range_end = range.end();
-    const auto &binedges_cbegin = m_binedges->cbegin();
-    const auto &binedges_cend = m_binedges->cend();
     const auto &tof_min = m_binedges->front();
     const auto &tof_max = m_binedges->back();
 
-    // Calibrate and histogram the data
+    // Events are processed in fixed size blocks. The first loop over a block gathers the calibration constants and
+    // calibrates without any branches so the compiler can vectorise it. The second loop does the range check and
+    // histograms.
+    std::array<double, EVENT_BLOCK_SIZE> tof_block;
     auto detid_iter = std::ranges::next(m_detids->begin(), range.begin());
     auto tof_iter = std::ranges::next(m_tofs->begin(), range.begin());
-    for (size_t i = range.begin(); i < range_end; ++i) {
-      const auto &detid = *detid_iter;
-      const auto &calib_factor = m_calibration->value_calibration(detid);
-      if (calib_factor < IGNORE_PIXEL) {
-        // Apply calibration
-        const double &tof = static_cast<double>(*tof_iter) * calib_factor;
-        if ((tof < tof_max) && (!(tof < tof_min))) { // check against max first to allow skipping second
-          // Find the bin index using binary search
-          const auto &it = std::upper_bound(binedges_cbegin, binedges_cend, tof);
+    for (size_t block_start = range.begin(); block_start < range_end; block_start += EVENT_BLOCK_SIZE) {
+      const auto block_size = static_cast<std::ptrdiff_t>(std::min(EVENT_BLOCK_SIZE, range_end - block_start));
+
+      // Apply calibration. Masked pixels are moved to tof_max so they fail the range check below.
+      for (std::ptrdiff_t i = 0; i < block_size; ++i) {
+        const auto &calib_factor = m_calibration->value_calibration(static_cast<detid_t>(detid_iter[i]));
+        const double tof = static_cast<double>(tof_iter[i]) * calib_factor;
+        tof_block[i] = (calib_factor < IGNORE_PIXEL) ? tof : tof_max;
+      }
 
-          // Increment the count if a bin was found
-          const auto &bin = static_cast<size_t>(std::distance(binedges_cbegin, it) - 1);
-          y_temp[bin]++;
+      // Histogram the calibrated events
+      for (std::ptrdiff_t i = 0; i < block_size; ++i) {
+        const auto &tof = tof_block[i];
+        if ((tof < tof_max) && (!(tof < tof_min))) { // check against max first to allow skipping second
+          // Find the bin index directly for linear/log binning, otherwise using binary search
+          y_temp[m_binfinder.findBin(tof)]++;
         }
       }
-      ++detid_iter;
-      ++tof_iter;
+
+      std::ranges::advance(detid_iter, block_size);
+      std::ranges::advance(tof_iter, block_size);
     }
   }
 
@@ -69,6 +79,7 @@ private:
   TofVector *m_tofs;
   const BankCalibration *m_calibration;
   const std::vector<double> *m_binedges;
+  BinFinder m_binfinder;
 };
 
 } // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
@@ -8,6 +8,7 @@
 
 #include "MantidAPI/Axis.h"
 #include "MantidDataHandling/DllConfig.h"
+#include "MantidDataHandling/EventPrecountCache.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
 
 class BankPulseTimes;
@@ -25,7 +26,7 @@ public:
   static void load(LoadEventNexus *alg, EventWorkspaceCollection &ws, bool haveWeights, bool event_id_is_spec,
                    std::vector<std::string> bankNames, const std::vector<int> &periodLog, const std::string &classType,
                    std::vector<std::size_t> bankNumEvents, const bool oldNeXusFileNames, const bool precount,
-                   const int chunk, const int totalChunks);
+                   const int chunk, const int totalChunks, const std::string &precountCacheDirectory);
 
   /// Flag for dealing with a simulated file
   bool m_haveWeights;
@@ -39,6 +40,9 @@ public:
   /// Do we pre-count the # of events in each pixel ID?
   bool precount;
 
+  /// Counts of events in each pixel ID saved by an earlier load, null if not used
+  std::unique_ptr<EventPrecountCache> precountCache;
+
   /// Offset in the pixelID_to_wi_vector to use.
   detid_t pixelID_to_wi_offset;
 
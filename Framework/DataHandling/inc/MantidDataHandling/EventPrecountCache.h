@@ -0,0 +1,73 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataHandling/DllConfig.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** EventPrecountCache : The number of events of each pixel ID in each bank of an event NeXus file, kept in a side-car
+ * file so that loading the same file again can reserve the event lists exactly without counting the events.
+ *
+ * The side-car file is stored in a cache directory under a name derived from the path of the NeXus file. It records
+ * the size and modification time of the NeXus file and is ignored if either has changed.
+ */
+class MANTID_DATAHANDLING_DLL EventPrecountCache {
+public:
+  /// Number of events of each pixel ID of one bank
+  struct BankCounts {
+    /// Smallest pixel ID in the bank
+    uint32_t minId{0};
+    /// Largest pixel ID in the bank
+    uint32_t maxId{0};
+    /// Number of events for each pixel ID from minId to maxId
+    std::vector<uint64_t> counts;
+
+    /// @return the number of events of a pixel ID, 0 if it is outside of the bank
+    uint64_t count(const uint32_t pixelId) const {
+      return (pixelId < minId || pixelId > maxId) ? 0 : counts[pixelId - minId];
+    }
+    uint64_t numberOfEvents() const;
+  };
+
+  EventPrecountCache(const std::string &nexusFilename, const std::string &cacheDirectory);
+
+  static std::shared_ptr<const BankCounts> countEvents(const std::vector<uint32_t> &pixelIds, const uint32_t minId,
+                                                       const uint32_t maxId);
+
+  std::shared_ptr<const BankCounts> find(const std::string &bankName) const;
+  void insert(const std::string &bankName, std::shared_ptr<const BankCounts> counts);
+
+  bool load();
+  void save() const;
+
+  /// @return the path of the side-car file
+  const std::string &cacheFilename() const { return m_cacheFilename; }
+
+private:
+  /// Path, size and modification time of the NeXus file
+  std::string m_key;
+  /// Path of the side-car file
+  std::string m_cacheFilename;
+  /// Protects m_banks and m_modified as banks are loaded in parallel
+  mutable std::mutex m_mutex;
+  /// Counts of each bank, by bank name
+  std::map<std::string, std::shared_ptr<const BankCounts>> m_banks;
+  /// Whether banks were added since the side-car file was read
+  bool m_modified{false};
+};
+
+} // namespace DataHandling
+} // namespace Mantid
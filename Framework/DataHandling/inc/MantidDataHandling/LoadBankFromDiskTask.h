@@ -8,6 +8,7 @@
 
 #include "MantidAPI/Progress.h"
 #include "MantidDataHandling/DllConfig.h"
+#include "MantidDataHandling/EventPrecountCache.h"
 #include "MantidKernel/Task.h"
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidNexus/NexusFile_fwd.h"
@@ -42,6 +43,8 @@ private:
   void prepareEventId(Nexus::File &file, uint64_t &start_event, uint64_t &stop_event,
                       const uint64_t &start_event_index);
   std::unique_ptr<std::vector<uint32_t>> loadEventId(Nexus::File &file);
+  std::shared_ptr<const EventPrecountCache::BankCounts> findPixelCounts(const std::vector<uint32_t> &event_id) const;
+  bool loadedWholeBank(const std::vector<uint32_t> &event_id) const;
   std::unique_ptr<std::vector<float>> loadTof(Nexus::File &file);
   std::unique_ptr<std::vector<float>> loadEventWeights(Nexus::File &file);
   uint64_t recalculateDataSize(const int64_t size);
@@ -71,6 +74,12 @@ private:
   uint32_t m_min_id;
   /// Maximum pixel ID in this data
   uint32_t m_max_id;
+  /// Minimum pixel ID of the events in the bank, before limiting it to the pixel IDs of the instrument
+  uint32_t m_bank_min_id;
+  /// Maximum pixel ID of the events in the bank, before limiting it to the pixel IDs of the instrument
+  uint32_t m_bank_max_id;
+  /// Number of events of each pixel ID in the bank, if known
+  std::shared_ptr<const EventPrecountCache::BankCounts> m_pixelCounts;
   /// Flag for simulated data
   bool m_have_weight;
   /// Frame period numbers
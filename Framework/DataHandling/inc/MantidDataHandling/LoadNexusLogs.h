@@ -65,9 +65,9 @@ private:
                 const std::shared_ptr<API::MatrixWorkspace> &workspace, const std::vector<std::string> &allow_list,
                 const std::vector<std::string> &block_list) const;
 
-  /// Load an NXlog entry
-  void loadNXLog(Nexus::File &file, const std::string &absolute_entry_name, const std::string &entry_class,
-                 const std::shared_ptr<API::MatrixWorkspace> &workspace) const;
+  /// Load NXlog entries, given as pairs of absolute name and class
+  void loadNXLogs(Nexus::File &file, const std::vector<std::pair<std::string, std::string>> &entries,
+                  const std::shared_ptr<API::MatrixWorkspace> &workspace) const;
 
   /**
    * Load an IXseblock entry
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "MantidDataHandling/BankPulseTimes.h"
+#include "MantidDataHandling/EventPrecountCache.h"
 #include "MantidGeometry/IDTypes.h"
 #include "MantidKernel/Task.h"
 
@@ -39,13 +40,16 @@ public:
    * @param event_weight :: array with weights for events
    * @param min_event_id ;: minimum detector ID to load
    * @param max_event_id :: maximum detector ID to load
+   * @param pixelCounts :: number of events of each pixel ID if already known, otherwise they are counted if the
+   *loader pre-counts
    */
   ProcessBankData(DefaultEventLoader &loader, const std::string &entry_name, API::Progress *prog,
                   std::shared_ptr<std::vector<uint32_t>> const &event_id,
                   std::shared_ptr<std::vector<float>> const &event_time_of_flight, size_t numEvents, size_t startAt,
                   std::shared_ptr<std::vector<uint64_t>> const &event_index,
                   std::shared_ptr<BankPulseTimes> const &thisBankPulseTimes, bool have_weight,
-                  std::shared_ptr<std::vector<float>> const &event_weight, detid_t min_event_id, detid_t max_event_id);
+                  std::shared_ptr<std::vector<float>> const &event_weight, detid_t min_event_id, detid_t max_event_id,
+                  std::shared_ptr<const EventPrecountCache::BankCounts> pixelCounts);
 
   void run() override;
 
@@ -83,6 +87,8 @@ private:
   detid_t m_min_detid;
   /// Maximum pixel id (inclusive)
   detid_t m_max_detid;
+  /// Number of events of each pixel ID of the bank, if known before processing
+  std::shared_ptr<const EventPrecountCache::BankCounts> m_pixelCounts;
 }; // ENDDEF-CLASS ProcessBankData
 } // namespace DataHandling
 } // namespace Mantid
@@ -14,6 +14,7 @@
 #include "MantidDataObjects/EventWorkspace_fwd.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/cow_ptr.h"
+#include "MantidNexus/ChunkCompression.h"
 #include "MantidNexus/NexusException.h"
 #include "MantidNexus/NexusFile.h"
 
@@ -83,6 +84,9 @@ public:
   /// Reset the pointer to the progress object.
   void resetProgress(Mantid::API::Progress *prog);
 
+  /// Set the deflate level and shuffle filter used for the compressed 2D data
+  void setDeflateSettings(const DeflateSettings &settings) { m_deflateSettings = settings; }
+
   /// Nexus file handle
   std::shared_ptr<Nexus::File> filehandle() const { return m_filehandle; }
 
@@ -91,6 +95,8 @@ private:
   std::shared_ptr<Nexus::File> m_filehandle;
   /// Nexus compression method
   NXcompression m_nexuscompression;
+  /// Deflate settings for the compressed 2D data
+  DeflateSettings m_deflateSettings;
   /// Allow an externally supplied progress object to be used
   API::Progress *m_progress;
   /// Write a simple value plus possible attributes
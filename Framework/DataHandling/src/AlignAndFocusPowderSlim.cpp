@@ -212,6 +212,11 @@ void AlignAndFocusPowderSlim::init() {
       std::make_unique<Kernel::PropertyWithValue<int>>(PropertyNames::EVENTS_PER_THREAD, 1000000, positiveIntValidator),
       "Number of events to read in a single thread. Higher means less threads are created.");
   setPropertyGroup(PropertyNames::EVENTS_PER_THREAD, CHUNKING_PARAM_GROUP);
+  declareProperty(
+      std::make_unique<Kernel::PropertyWithValue<int>>(PropertyNames::CHUNKS_IN_FLIGHT, 2, positiveIntValidator),
+      "Number of chunks of a bank that can be in memory at once. Values larger than 1 allow reading the next chunk "
+      "from disk while the current one is being histogrammed.");
+  setPropertyGroup(PropertyNames::CHUNKS_IN_FLIGHT, CHUNKING_PARAM_GROUP);
 
   // load single spectrum
   declareProperty(std::make_unique<Kernel::PropertyWithValue<int>>(PropertyNames::OUTPUT_SPEC_NUM, EMPTY_INT(),
@@ -385,6 +390,7 @@ void AlignAndFocusPowderSlim::exec() {
   // threaded processing of the banks
   const int DISK_CHUNK = getProperty(PropertyNames::READ_SIZE_FROM_DISK);
   const int GRAINSIZE_EVENTS = getProperty(PropertyNames::EVENTS_PER_THREAD);
+  const int CHUNKS_IN_FLIGHT = getProperty(PropertyNames::CHUNKS_IN_FLIGHT);
   g_log.debug() << (DISK_CHUNK / GRAINSIZE_EVENTS) << " threads per chunk\n";
 
   if (timeSplitter.empty()) {
@@ -393,7 +399,7 @@ void AlignAndFocusPowderSlim::exec() {
     auto progress = std::make_shared<API::Progress>(this, .17, .9, num_banks_to_read);
     ProcessBankTask task(bankEntryNames, h5file, is_time_filtered, wksp, m_calibration, m_scale_at_sample, m_masked,
                          static_cast<size_t>(DISK_CHUNK), static_cast<size_t>(GRAINSIZE_EVENTS), pulse_indices,
-                         progress);
+                         progress, static_cast<size_t>(CHUNKS_IN_FLIGHT));
     // generate threads only if appropriate
     if (num_banks_to_read > 1) {
       tbb::parallel_for(tbb::blocked_range<size_t>(0, num_banks_to_read), task);
@@ -488,7 +494,8 @@ void AlignAndFocusPowderSlim::exec() {
 
               ProcessBankTask task(bankEntryNames, h5file, is_time_filtered, target_wksp, m_calibration,
                                    m_scale_at_sample, m_masked, static_cast<size_t>(DISK_CHUNK),
-                                   static_cast<size_t>(GRAINSIZE_EVENTS), pulse_indices, progress);
+                                   static_cast<size_t>(GRAINSIZE_EVENTS), pulse_indices, progress,
+                                   static_cast<size_t>(CHUNKS_IN_FLIGHT));
               // generate threads only if appropriate
               if (num_banks_to_read > 1) {
                 tbb::parallel_for(tbb::blocked_range<size_t>(0, num_banks_to_read), task);
@@ -80,13 +80,6 @@ BankCalibration::BankCalibration(const detid_t idmin, const detid_t idmax, const
   }
 }
 
-/**
- * This assumes that everything is in range. Values that weren't in the calibration map get set to 1.
- */
-const double &BankCalibration::value_calibration(const detid_t detid) const {
-  return m_calibration[detid - m_detid_offset];
-}
-
 double BankCalibration::value_scale_at_sample(const detid_t detid) const {
   return m_scale_at_sample[detid - m_detid_offset];
 }
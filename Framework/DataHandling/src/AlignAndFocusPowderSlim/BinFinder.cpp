@@ -0,0 +1,88 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+
+#include "MantidDataHandling/AlignAndFocusPowderSlim/BinFinder.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid::DataHandling::AlignAndFocusPowderSlim {
+
+namespace {
+/// relative tolerance when comparing bin widths (or ratios) to each other
+constexpr double BIN_TOLERANCE{1.e-6};
+
+/**
+ * The last bin is ignored when checking because Kernel::VectorHelper::createAxisFromRebinParams allows it to be
+ * between 0.25 and 1.25 times the size of the others. EventList::findExactBin corrects the estimate for that bin.
+ */
+bool isLinear(const std::vector<double> &binedges) {
+  const double step = binedges[1] - binedges[0];
+  if (step <= 0.)
+    return false;
+  for (size_t i = 1; i + 2 < binedges.size(); ++i) {
+    if (std::fabs(binedges[i + 1] - binedges[i] - step) > BIN_TOLERANCE * step)
+      return false;
+  }
+  return true;
+}
+
+bool isLogarithmic(const std::vector<double> &binedges) {
+  if (binedges.front() <= 0.)
+    return false;
+  const double ratio = binedges[1] / binedges[0];
+  if (ratio <= 1.)
+    return false;
+  for (size_t i = 1; i + 2 < binedges.size(); ++i) {
+    if (std::fabs(binedges[i + 1] / binedges[i] - ratio) > BIN_TOLERANCE * ratio)
+      return false;
+  }
+  return true;
+}
+
+BinFinder::Strategy detectStrategy(const std::vector<double> &binedges) {
+  if (binedges.size() < 2)
+    return BinFinder::Strategy::BINARY_SEARCH;
+  else if (isLinear(binedges))
+    return BinFinder::Strategy::LINEAR;
+  else if (isLogarithmic(binedges))
+    return BinFinder::Strategy::LOGARITHMIC;
+  else
+    return BinFinder::Strategy::BINARY_SEARCH;
+}
+} // namespace
+
+BinFinder::BinFinder(const std::vector<double> *binedges) : BinFinder(binedges, detectStrategy(*binedges)) {}
+
+/**
+ * Force a particular strategy. This is mainly useful for comparing the strategies against each other.
+ *
+ * @throws std::invalid_argument if the bin edges are not compatible with the requested strategy
+ */
+BinFinder::BinFinder(const std::vector<double> *binedges, const Strategy strategy)
+    : m_binedges(binedges), m_strategy(strategy) {
+  if (m_strategy == Strategy::BINARY_SEARCH)
+    return;
+  if (detectStrategy(*m_binedges) != m_strategy)
+    throw std::invalid_argument("Bin edges are not compatible with the requested BinFinder strategy");
+
+  // the average width (or log of the ratio) of all bins except the last is less sensitive to rounding
+  const auto num_full_bins = static_cast<double>(std::max<size_t>(m_binedges->size() - 2, 1));
+  const double xmin = m_binedges->front();
+  const double xmax_full = (m_binedges->size() > 2) ? *std::prev(m_binedges->cend(), 2) : m_binedges->back();
+  if (m_strategy == Strategy::LINEAR) {
+    m_divisor = num_full_bins / (xmax_full - xmin);
+    m_offset = xmin * m_divisor;
+  } else {
+    // use this to do change of base
+    m_divisor = num_full_bins / std::log(xmax_full / xmin);
+    m_offset = std::log(xmin) * m_divisor;
+  }
+}
+
+BinFinder::Strategy BinFinder::strategy() const { return m_strategy; }
+
+} // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
@@ -12,7 +12,9 @@
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Unit.h"
 #include "MantidNexus/H5Util.h"
+#include "tbb/concurrent_queue.h"
 #include "tbb/parallel_for.h"
+#include "tbb/parallel_pipeline.h"
 #include "tbb/parallel_reduce.h"
 
 namespace Mantid::DataHandling::AlignAndFocusPowderSlim {
@@ -24,16 +26,25 @@ const std::string MICROSEC("microseconds");
 // Logger for this class
 auto g_log = Kernel::Logger("ProcessBankTask");
 
+/// Events for one chunk of a bank that are read from disk together
+struct EventChunk {
+  std::unique_ptr<std::vector<uint32_t>> detid{std::make_unique<std::vector<uint32_t>>()}; // uint32 for ORNL nexus file
+  std::unique_ptr<std::vector<float>> time_of_flight{std::make_unique<std::vector<float>>()}; // float for ORNL files
+  std::shared_ptr<BankCalibration> calibration;
+};
+
 } // namespace
 ProcessBankTask::ProcessBankTask(std::vector<std::string> &bankEntryNames, H5::H5File &h5file,
                                  const bool is_time_filtered, API::MatrixWorkspace_sptr &wksp,
                                  const std::map<detid_t, double> &calibration,
                                  const std::map<detid_t, double> &scale_at_sample, const std::set<detid_t> &masked,
                                  const size_t events_per_chunk, const size_t grainsize_event,
-                                 std::vector<PulseROI> pulse_indices, std::shared_ptr<API::Progress> &progress)
+                                 std::vector<PulseROI> pulse_indices, std::shared_ptr<API::Progress> &progress,
+                                 const size_t chunks_in_flight)
     : m_h5file(h5file), m_bankEntries(bankEntryNames), m_loader(is_time_filtered, pulse_indices), m_wksp(wksp),
       m_calibration(calibration), m_scale_at_sample(scale_at_sample), m_masked(masked),
-      m_events_per_chunk(events_per_chunk), m_grainsize_event(grainsize_event), m_progress(progress) {}
+      m_events_per_chunk(events_per_chunk), m_grainsize_event(grainsize_event),
+      m_chunks_in_flight(std::max<size_t>(chunks_in_flight, 1)), m_progress(progress) {}
 
 void ProcessBankTask::operator()(const tbb::blocked_range<size_t> &range) const {
   auto entry = m_h5file.openGroup("entry"); // type=NXentry
@@ -67,9 +78,6 @@ void ProcessBankTask::operator()(const tbb::blocked_range<size_t> &range) const
     // std::vector<std::atomic_uint32_t> y_temp(spectrum.dataY().size())
     std::vector<uint32_t> y_temp(spectrum.dataY().size());
 
-    // create object so bank calibration can be re-used
-    std::unique_ptr<BankCalibration> calibration = nullptr;
-
     // get handle to the data
     auto detID_SDS = event_group.openDataSet(NxsFieldNames::DETID);
     // auto tof_SDS = event_group.openDataSet(NxsFieldNames::TIME_OF_FLIGHT);
@@ -78,90 +86,132 @@ void ProcessBankTask::operator()(const tbb::blocked_range<size_t> &range) const
     Nexus::H5Util::readStringAttribute(tof_SDS, "units", tof_unit);
     const double time_conversion = Kernel::Units::timeConversionValue(tof_unit, MICROSEC);
 
-    // declare arrays once so memory can be reused
-    auto event_detid = std::make_unique<std::vector<uint32_t>>();       // uint32 for ORNL nexus file
-    auto event_time_of_flight = std::make_unique<std::vector<float>>(); // float for ORNL nexus files
-
-    // read parts of the bank at a time until all events are processed
-    while (!eventRanges.empty()) {
-      // Create offsets and slab sizes for the next chunk of events.
-      // This will read at most m_events_per_chunk events from the file
-      // and will split the ranges if necessary for the next iteration.
-      std::vector<size_t> offsets;
-      std::vector<size_t> slabsizes;
-
-      size_t total_events_to_read = 0;
-      // Process the event ranges until we reach the desired number of events to read or run out of ranges
-      while (!eventRanges.empty() && total_events_to_read < m_events_per_chunk) {
-        // Get the next event range from the stack
-        auto eventRange = eventRanges.top();
-        eventRanges.pop();
-
-        size_t range_size = eventRange.second - eventRange.first;
-        size_t remaining_chunk = m_events_per_chunk - total_events_to_read;
-
-        // If the range size is larger than the remaining chunk, we need to split it
-        if (range_size > remaining_chunk) {
-          // Split the range: process only part of it now, push the rest back for later
-          offsets.push_back(eventRange.first);
-          slabsizes.push_back(remaining_chunk);
-          total_events_to_read += remaining_chunk;
-          // Push the remainder of the range back to the front for next iteration
-          eventRanges.emplace(eventRange.first + remaining_chunk, eventRange.second);
-          break;
-        } else {
-          offsets.push_back(eventRange.first);
-          slabsizes.push_back(range_size);
-          total_events_to_read += range_size;
-          // Continue to next range
-        }
-      }
-
-      // log the event ranges being processed
-      std::ostringstream oss;
-      oss << "Processing " << bankName << " with " << total_events_to_read << " events in the ranges: ";
-      for (size_t i = 0; i < offsets.size(); ++i) {
-        oss << "[" << offsets[i] << ", " << (offsets[i] + slabsizes[i]) << "), ";
-      }
-      oss << "\n";
-      g_log.debug() << oss.str();
-
-      // load detid and tof at the same time
-      tbb::parallel_invoke(
-          [&] { // load detid
-            // event_detid->clear();
-            m_loader.loadData(detID_SDS, event_detid, offsets, slabsizes);
-            // immediately find min/max to allow for other things to read disk
-            const auto [minval, maxval] = Mantid::Kernel::parallel_minmax(event_detid, m_grainsize_event);
-            // only recreate calibration if it doesn't already have the useful information
-            if ((!calibration) || (calibration->idmin() > static_cast<detid_t>(minval)) ||
-                (calibration->idmax() < static_cast<detid_t>(maxval))) {
-              calibration =
-                  std::make_unique<BankCalibration>(static_cast<detid_t>(minval), static_cast<detid_t>(maxval),
-                                                    time_conversion, m_calibration, m_scale_at_sample, m_masked);
-            }
-          },
-          [&] { // load time-of-flight
-            // event_time_of_flight->clear();
-            m_loader.loadData(tof_SDS, event_time_of_flight, offsets, slabsizes);
-          });
-
-      // Create a local task for this thread
-      ProcessEventsTask task(event_detid.get(), event_time_of_flight.get(), calibration.get(), &spectrum.readX());
-
-      // Non-blocking processing of the events
-      const tbb::blocked_range<size_t> range_info(0, event_time_of_flight->size(), m_grainsize_event);
-      tbb::parallel_reduce(range_info, task);
-
-      // Accumulate results into shared y_temp to combine local histograms
-      std::transform(y_temp.begin(), y_temp.end(), task.y_temp.begin(), y_temp.begin(), std::plus<uint32_t>());
+    // the calibration is recreated in the read stage of the pipeline and carried along with the events it is for
+    std::shared_ptr<BankCalibration> calibration = nullptr;
+
+    // declare arrays once so memory can be reused - there is one set of arrays for each chunk in flight
+    std::vector<std::unique_ptr<EventChunk>> chunk_buffers;
+    tbb::concurrent_queue<EventChunk *> free_chunks;
+    for (size_t i = 0; i < m_chunks_in_flight; ++i) {
+      chunk_buffers.emplace_back(std::make_unique<EventChunk>());
+      free_chunks.push(chunk_buffers.back().get());
     }
 
+    // time spent in each stage of the pipeline
+    double time_read{0.};
+    double time_histogram{0.};
+
+    // Read parts of the bank at a time until all events are processed. Reading the next chunk from disk overlaps with
+    // histogramming the current one. Both stages are serial so the file is read in order and only one chunk at a time
+    // is accumulated into y_temp.
+    tbb::parallel_pipeline(
+        m_chunks_in_flight,
+        tbb::make_filter<void, EventChunk *>(
+            tbb::filter_mode::serial_in_order,
+            [&](tbb::flow_control &fc) -> EventChunk * {
+              if (eventRanges.empty()) {
+                fc.stop();
+                return nullptr;
+              }
+              Kernel::Timer read_timer;
+
+              // Create offsets and slab sizes for the next chunk of events.
+              // This will read at most m_events_per_chunk events from the file
+              // and will split the ranges if necessary for the next iteration.
+              std::vector<size_t> offsets;
+              std::vector<size_t> slabsizes;
+
+              size_t total_events_to_read = 0;
+              // Process the event ranges until we reach the desired number of events to read or run out of ranges
+              while (!eventRanges.empty() && total_events_to_read < m_events_per_chunk) {
+                // Get the next event range from the stack
+                auto eventRange = eventRanges.top();
+                eventRanges.pop();
+
+                size_t range_size = eventRange.second - eventRange.first;
+                size_t remaining_chunk = m_events_per_chunk - total_events_to_read;
+
+                // If the range size is larger than the remaining chunk, we need to split it
+                if (range_size > remaining_chunk) {
+                  // Split the range: process only part of it now, push the rest back for later
+                  offsets.push_back(eventRange.first);
+                  slabsizes.push_back(remaining_chunk);
+                  total_events_to_read += remaining_chunk;
+                  // Push the remainder of the range back to the front for next iteration
+                  eventRanges.emplace(eventRange.first + remaining_chunk, eventRange.second);
+                  break;
+                } else {
+                  offsets.push_back(eventRange.first);
+                  slabsizes.push_back(range_size);
+                  total_events_to_read += range_size;
+                  // Continue to next range
+                }
+              }
+
+              // log the event ranges being processed
+              std::ostringstream oss;
+              oss << "Processing " << bankName << " with " << total_events_to_read << " events in the ranges: ";
+              for (size_t i = 0; i < offsets.size(); ++i) {
+                oss << "[" << offsets[i] << ", " << (offsets[i] + slabsizes[i]) << "), ";
+              }
+              oss << "\n";
+              g_log.debug() << oss.str();
+
+              // there is always a free buffer because the number of live tokens is the same as the number of buffers
+              EventChunk *chunk = nullptr;
+              free_chunks.try_pop(chunk);
+
+              // load detid and tof at the same time
+              tbb::parallel_invoke(
+                  [&] { // load detid
+                    m_loader.loadData(detID_SDS, chunk->detid, offsets, slabsizes);
+                    // immediately find min/max to allow for other things to read disk
+                    const auto [minval, maxval] = Mantid::Kernel::parallel_minmax(chunk->detid, m_grainsize_event);
+                    // only recreate calibration if it doesn't already have the useful information
+                    if ((!calibration) || (calibration->idmin() > static_cast<detid_t>(minval)) ||
+                        (calibration->idmax() < static_cast<detid_t>(maxval))) {
+                      calibration = std::make_shared<BankCalibration>(
+                          static_cast<detid_t>(minval), static_cast<detid_t>(maxval), time_conversion, m_calibration,
+                          m_scale_at_sample, m_masked);
+                    }
+                  },
+                  [&] { // load time-of-flight
+                    m_loader.loadData(tof_SDS, chunk->time_of_flight, offsets, slabsizes);
+                  });
+              chunk->calibration = calibration;
+
+              time_read += read_timer.elapsed();
+              return chunk;
+            }) &
+            tbb::make_filter<EventChunk *, void>(
+                tbb::filter_mode::serial_in_order, [&](EventChunk *chunk) {
+                  Kernel::Timer histogram_timer;
+
+                  // Create a local task for this thread
+                  ProcessEventsTask task(chunk->detid.get(), chunk->time_of_flight.get(), chunk->calibration.get(),
+                                         &spectrum.readX());
+
+                  // Non-blocking processing of the events
+                  const tbb::blocked_range<size_t> range_info(0, chunk->time_of_flight->size(), m_grainsize_event);
+                  tbb::parallel_reduce(range_info, task);
+
+                  // Accumulate results into shared y_temp to combine local histograms
+                  std::transform(y_temp.begin(), y_temp.end(), task.y_temp.begin(), y_temp.begin(),
+                                 std::plus<uint32_t>());
+
+                  // release the buffer to be filled with the next chunk
+                  chunk->calibration.reset();
+                  free_chunks.push(chunk);
+
+                  time_histogram += histogram_timer.elapsed();
+                }));
+
     // copy the data out into the correct spectrum
     auto &y_values = spectrum.dataY();
     std::copy(y_temp.cbegin(), y_temp.cend(), y_values.begin());
 
-    g_log.debug() << bankName << " stop " << timer << std::endl;
+    g_log.debug() << bankName << " stop " << timer << " (read " << time_read << "s, histogram " << time_histogram
+                  << "s)" << std::endl;
     m_progress->report();
   }
 }
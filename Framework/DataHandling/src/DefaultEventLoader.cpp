@@ -19,9 +19,16 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                               bool event_id_is_spec, std::vector<std::string> bankNames,
                               const std::vector<int> &periodLog, const std::string &classType,
                               std::vector<std::size_t> bankNumEvents, const bool oldNeXusFileNames, const bool precount,
-                              const int chunk, const int totalChunks) {
+                              const int chunk, const int totalChunks, const std::string &precountCacheDirectory) {
   DefaultEventLoader loader(alg, ws, haveWeights, event_id_is_spec, bankNames.size(), precount, chunk, totalChunks);
 
+  // The counts of a bank are only complete if the whole bank is loaded
+  if (precount && !precountCacheDirectory.empty() && chunk == EMPTY_INT()) {
+    loader.precountCache = std::make_unique<EventPrecountCache>(alg->m_filename, precountCacheDirectory);
+    if (loader.precountCache->load())
+      alg->getLogger().debug() << "Using the event pre-count cache " << loader.precountCache->cacheFilename() << "\n";
+  }
+
   auto bankRange = loader.setupChunking(bankNames, bankNumEvents);
 
   // Make the thread pool
@@ -44,6 +51,9 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
   // Start and end all threads
   pool.joinAll();
   diskIOMutex.reset();
+
+  if (loader.precountCache)
+    loader.precountCache->save();
 }
 
 DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollection &ws, bool haveWeights,
@@ -0,0 +1,208 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/EventPrecountCache.h"
+#include "MantidKernel/ChecksumHelper.h"
+#include "MantidKernel/Logger.h"
+
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+
+namespace Mantid::DataHandling {
+
+namespace {
+Kernel::Logger g_log("EventPrecountCache");
+
+/// Identifies the file format, change the version if the layout changes
+constexpr char MAGIC[] = "MantidEventPrecount";
+constexpr uint32_t VERSION{1};
+
+template <typename T> void writeValue(std::ostream &stream, const T &value) {
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T> T readValue(std::istream &stream) {
+  T value{};
+  stream.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return value;
+}
+
+void writeString(std::ostream &stream, const std::string &value) {
+  writeValue<uint64_t>(stream, value.size());
+  stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+std::string readString(std::istream &stream) {
+  const auto size = readValue<uint64_t>(stream);
+  // guard against reading a huge length from a corrupt file
+  if (!stream || size > (1 << 16))
+    throw std::runtime_error("invalid string length");
+  std::string value(size, '\0');
+  stream.read(value.data(), static_cast<std::streamsize>(size));
+  return value;
+}
+} // namespace
+
+/// @return the total number of events in the bank
+uint64_t EventPrecountCache::BankCounts::numberOfEvents() const {
+  return std::accumulate(counts.cbegin(), counts.cend(), uint64_t{0});
+}
+
+/**
+ * Constructor. Nothing is read until load() is called.
+ * @param nexusFilename :: path of the event NeXus file
+ * @param cacheDirectory :: directory for the side-car file
+ */
+EventPrecountCache::EventPrecountCache(const std::string &nexusFilename, const std::string &cacheDirectory) {
+  // Hashing the whole file would take as long as the count that is being saved, so the file is identified by its
+  // path, size and modification time instead.
+  std::error_code ec;
+  const auto path = std::filesystem::weakly_canonical(nexusFilename, ec);
+  const auto filePath = ec ? std::filesystem::path(nexusFilename) : path;
+  const auto size = std::filesystem::file_size(filePath, ec);
+  const auto modified = std::filesystem::last_write_time(filePath, ec).time_since_epoch().count();
+  // a file that cannot be looked at gets a key that never matches so the side-car file is not used
+  m_key = ec ? std::string() : filePath.string() + "|" + std::to_string(size) + "|" + std::to_string(modified);
+
+  const auto cacheName = filePath.stem().string() + "_" +
+                         Kernel::ChecksumHelper::sha1FromString(filePath.string()).substr(0, 16) + ".precount";
+  m_cacheFilename = (std::filesystem::path(cacheDirectory) / cacheName).string();
+}
+
+/**
+ * Count the number of events of each pixel ID
+ * @param pixelIds :: the pixel ID of each event
+ * @param minId :: the smallest pixel ID
+ * @param maxId :: the largest pixel ID
+ * @return the counts. Pixel IDs outside of [minId, maxId] are not counted.
+ */
+std::shared_ptr<const EventPrecountCache::BankCounts>
+EventPrecountCache::countEvents(const std::vector<uint32_t> &pixelIds, const uint32_t minId, const uint32_t maxId) {
+  if (maxId < minId)
+    throw std::invalid_argument("EventPrecountCache: maximum pixel ID is less than the minimum");
+  auto bank = std::make_shared<BankCounts>();
+  bank->minId = minId;
+  bank->maxId = maxId;
+  bank->counts.resize(static_cast<size_t>(maxId - minId) + 1, 0);
+  for (const auto pixelId : pixelIds) {
+    if (pixelId >= minId && pixelId <= maxId)
+      bank->counts[pixelId - minId]++;
+  }
+  return bank;
+}
+
+/**
+ * @param bankName :: name of the NXevent_data group
+ * @return the counts of the bank, or nullptr if they are not known
+ */
+std::shared_ptr<const EventPrecountCache::BankCounts> EventPrecountCache::find(const std::string &bankName) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto bank = m_banks.find(bankName);
+  return (bank == m_banks.end()) ? nullptr : bank->second;
+}
+
+/**
+ * Add the counts of a bank, which are written by the next call to save()
+ * @param bankName :: name of the NXevent_data group
+ * @param counts :: the counts of all events in the bank
+ */
+void EventPrecountCache::insert(const std::string &bankName, std::shared_ptr<const BankCounts> counts) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_banks[bankName] = std::move(counts);
+  m_modified = true;
+}
+
+/**
+ * Read the side-car file. It is ignored if it does not exist, is not readable or belongs to a different version of
+ * the NeXus file.
+ * @return true if counts were read
+ */
+bool EventPrecountCache::load() {
+  if (m_key.empty())
+    return false;
+  std::ifstream stream(m_cacheFilename, std::ios::binary);
+  if (!stream)
+    return false;
+
+  std::map<std::string, std::shared_ptr<const BankCounts>> banks;
+  try {
+    std::string magic(sizeof(MAGIC), '\0');
+    stream.read(magic.data(), sizeof(MAGIC));
+    if (!stream || magic != std::string(MAGIC, sizeof(MAGIC)) || readValue<uint32_t>(stream) != VERSION)
+      return false;
+    if (readString(stream) != m_key) {
+      g_log.debug() << "Ignoring " << m_cacheFilename << " as the NeXus file has changed\n";
+      return false;
+    }
+    const auto numBanks = readValue<uint64_t>(stream);
+    for (uint64_t i = 0; stream && i < numBanks; ++i) {
+      auto name = readString(stream);
+      auto bank = std::make_shared<BankCounts>();
+      bank->minId = readValue<uint32_t>(stream);
+      bank->maxId = readValue<uint32_t>(stream);
+      if (!stream || bank->maxId < bank->minId)
+        return false;
+      bank->counts.resize(static_cast<size_t>(bank->maxId - bank->minId) + 1);
+      stream.read(reinterpret_cast<char *>(bank->counts.data()),
+                  static_cast<std::streamsize>(bank->counts.size() * sizeof(uint64_t)));
+      banks.emplace(std::move(name), std::move(bank));
+    }
+  } catch (std::exception &e) {
+    g_log.debug() << "Ignoring " << m_cacheFilename << ": " << e.what() << '\n';
+    return false;
+  }
+  if (!stream) {
+    g_log.debug() << "Ignoring truncated " << m_cacheFilename << '\n';
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_banks = std::move(banks);
+  m_modified = false;
+  return true;
+}
+
+/**
+ * Write the side-car file if banks were added since it was read. Failing to write it is not an error, as it only
+ * makes the next load slower.
+ */
+void EventPrecountCache::save() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_modified || m_key.empty())
+    return;
+
+  // write to a temporary file and rename it so another process never reads a partial file
+  const auto tempFilename = m_cacheFilename + ".tmp";
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::path(m_cacheFilename).parent_path(), ec);
+  {
+    std::ofstream stream(tempFilename, std::ios::binary | std::ios::trunc);
+    stream.write(MAGIC, sizeof(MAGIC));
+    writeValue(stream, VERSION);
+    writeString(stream, m_key);
+    writeValue<uint64_t>(stream, m_banks.size());
+    for (const auto &[name, bank] : m_banks) {
+      writeString(stream, name);
+      writeValue(stream, bank->minId);
+      writeValue(stream, bank->maxId);
+      stream.write(reinterpret_cast<const char *>(bank->counts.data()),
+                   static_cast<std::streamsize>(bank->counts.size() * sizeof(uint64_t)));
+    }
+    if (!stream) {
+      g_log.warning() << "Could not write the event pre-count cache " << tempFilename << '\n';
+      std::filesystem::remove(tempFilename, ec);
+      return;
+    }
+  }
+  std::filesystem::rename(tempFilename, m_cacheFilename, ec);
+  if (ec) {
+    g_log.warning() << "Could not write the event pre-count cache " << m_cacheFilename << ": " << ec.message() << '\n';
+    std::filesystem::remove(tempFilename, ec);
+  }
+}
+
+} // namespace Mantid::DataHandling
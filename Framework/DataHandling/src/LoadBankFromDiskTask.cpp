@@ -57,6 +57,8 @@ LoadBankFromDiskTask::LoadBankFromDiskTask(DefaultEventLoader &loader, std::stri
   // detector id range
   m_min_id = std::numeric_limits<uint32_t>::max();
   m_max_id = 0;
+  m_bank_min_id = m_min_id;
+  m_bank_max_id = m_max_id;
 }
 
 /** Load the pulse times, if needed. This sets thisBankPulseTimes to the right pointer.
@@ -186,12 +188,19 @@ std::unique_ptr<std::vector<uint32_t>> LoadBankFromDiskTask::loadEventId(Nexus::
                                                                                   m_loadStart, m_loadSize);
     file.closeData();
 
-    // determine the range of pixel ids
-    {
+    // determine the range of pixel ids, which is known without looking at the events if they were counted before
+    m_pixelCounts = this->findPixelCounts(*event_id);
+    if (m_pixelCounts) {
+      m_min_id = m_pixelCounts->minId;
+      m_max_id = m_pixelCounts->maxId;
+    } else {
       const auto [min_id, max_id] = Mantid::Kernel::parallel_minmax<uint32_t>(event_id);
       m_min_id = min_id;
       m_max_id = max_id;
     }
+    // the pre-count cache holds the events of the whole bank, including any outside the instrument
+    m_bank_min_id = m_min_id;
+    m_bank_max_id = m_max_id;
 
     if (m_min_id > static_cast<uint32_t>(m_loader.eventid_max)) {
       // All the detector IDs in the bank are higher than the highest 'known'
@@ -302,6 +311,30 @@ std::unique_ptr<std::vector<float>> LoadBankFromDiskTask::loadEventWeights(Nexus
   return event_weight;
 }
 
+/** Look up the number of events of each pixel ID in the pre-count cache
+ * @param event_id :: the pixel IDs of the events that were loaded
+ * @returns the counts, or nullptr if they are not in the cache or do not match the events that were loaded
+ */
+std::shared_ptr<const EventPrecountCache::BankCounts>
+LoadBankFromDiskTask::findPixelCounts(const std::vector<uint32_t> &event_id) const {
+  if (!m_loader.precountCache || !loadedWholeBank(event_id))
+    return nullptr;
+  auto counts = m_loader.precountCache->find(entry_name);
+  if (counts && counts->numberOfEvents() != event_id.size()) {
+    m_loader.alg->getLogger().debug() << "Ignoring the cached event counts of " << entry_name
+                                      << " as the number of events does not match\n";
+    return nullptr;
+  }
+  return counts;
+}
+
+/** @param event_id :: the pixel IDs of the events that were loaded
+ * @returns true if all events of the bank were loaded, so their counts can go in the pre-count cache
+ */
+bool LoadBankFromDiskTask::loadedWholeBank(const std::vector<uint32_t> &event_id) const {
+  return m_loadStart[0] == 0 && static_cast<size_t>(m_loadSize[0]) == event_id.size();
+}
+
 void LoadBankFromDiskTask::run() {
   // timer for performance
   Mantid::Kernel::Timer timer;
@@ -516,15 +549,22 @@ void LoadBankFromDiskTask::run() {
       scheduler.push(newTask2);
     }
   } else {
+    // Count the events once for the whole bank and keep the counts for the next time the file is loaded. Without the
+    // cache each ProcessBankData counts the events of its own pixels.
+    if (m_loader.precount && m_loader.precountCache && !m_pixelCounts && loadedWholeBank(*event_id)) {
+      m_pixelCounts = EventPrecountCache::countEvents(*event_id, m_bank_min_id, m_bank_max_id);
+      m_loader.precountCache->insert(entry_name, m_pixelCounts);
+    }
+
     // create all events using traditional method
     std::shared_ptr<Task> newTask1 = std::make_shared<ProcessBankData>(
         m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents, startAt, event_index, thisBankPulseTimes,
-        m_have_weight, event_weight, m_min_id, mid_id);
+        m_have_weight, event_weight, m_min_id, mid_id, m_pixelCounts);
     scheduler.push(newTask1);
     if (m_loader.splitProcessing && (mid_id < m_max_id)) {
       std::shared_ptr<Task> newTask2 = std::make_shared<ProcessBankData>(
           m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents, startAt, event_index,
-          thisBankPulseTimes, m_have_weight, event_weight, (mid_id + 1), m_max_id);
+          thisBankPulseTimes, m_have_weight, event_weight, (mid_id + 1), m_max_id, m_pixelCounts);
       scheduler.push(newTask2);
     }
   }
@@ -172,6 +172,9 @@ void LoadEventNexus::init() {
                   "(optional, default True). "
                   "This can significantly reduce memory use and memory fragmentation; it "
                   "may also speed up loading.");
+  declareProperty(std::make_unique<FileProperty>("PrecountCacheDirectory", "", FileProperty::OptionalDirectory),
+                  "Directory to keep the number of events in each pixel in, so that loading the same file again "
+                  "does not need to count them (optional, default no cache). Only used with Precount.");
 
   declareProperty(
       std::make_unique<PropertyWithValue<double>>(PropertyNames::COMPRESS_TOL, EMPTY_DBL(), Direction::Input),
@@ -201,6 +204,7 @@ void LoadEventNexus::init() {
 
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
+  setPropertyGroup("PrecountCacheDirectory", grp3);
   setPropertyGroup(PropertyNames::COMPRESS_TOL, grp3);
   setPropertyGroup(PropertyNames::COMPRESS_MODE, grp3);
   setPropertyGroup("ChunkNumber", grp3);
@@ -1161,11 +1165,13 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
   longest_tof = 0.;
 
   bool precount = getProperty("Precount");
+  const std::string precountCacheDirectory = getPropertyValue("PrecountCacheDirectory");
   int chunk = getProperty("ChunkNumber");
   int totalChunks = getProperty("TotalChunks");
   const auto startTime = std::chrono::high_resolution_clock::now();
   DefaultEventLoader::load(this, *m_ws, haveWeights, event_id_is_spec, bankNames, periodLog->valuesAsVector(),
-                           classType, bankNumEvents, oldNeXusFileNames, precount, chunk, totalChunks);
+                           classType, bankNumEvents, oldNeXusFileNames, precount, chunk, totalChunks,
+                           precountCacheDirectory);
   addTimer("loadEvents", startTime, std::chrono::high_resolution_clock::now());
 
   // Info reporting
@@ -10,6 +10,7 @@
 #include "MantidAPI/Run.h"
 #include "MantidDataHandling/LoadTOFRawNexus.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidNexus/NexusException.h"
 
@@ -123,40 +124,53 @@ bool isControlValue(const char &c, const std::string &propName, Kernel::Logger &
 }
 
 /**
- * Creates a time series property from the currently opened log entry. It is
- * assumed to
- * have been checked to have a time field and the value entry's name is given
- * as an argument
+ * The time and value arrays of an NXlog, as read from the file. Turning them into a property does not touch the file
+ * so several logs can be converted at the same time.
+ */
+struct NXLogData {
+  /// Name of the property to create
+  std::string propName;
+  /// The "start" or "offset" attribute of the time array
+  std::string start;
+  /// The times in seconds relative to start
+  std::vector<double> times;
+  /// Units of the values
+  std::string valueUnits;
+  /// Which of the value arrays is used: INT32, FLOAT64 or CHAR
+  NXnumtype type;
+  std::vector<int> intValues;
+  std::vector<double> doubleValues;
+  /// Fixed length strings packed together
+  std::string charValues;
+  /// Length of each string in charValues
+  std::size_t itemLength{0};
+  /// The value_valid array, empty if the log does not have one
+  std::vector<int> validity;
+};
+
+/**
+ * Reads the time and value arrays of the currently opened log entry. It is assumed to have been checked to have a
+ * time field and a value field.
  * @param file :: A reference to the file handle
- * @param propName :: The name of the property
- * @param freqStart :: A string containing the start time of the frequency log
- * on SNAP
+ * @param data :: Filled with the contents of the log
  * @param log :: Reference to logger to print out to
- * @returns A pointer to a new property containing the time series
  */
-std::unique_ptr<Kernel::Property> createTimeSeries(Nexus::File &file, const std::string &propName,
-                                                   const std::string &freqStart, Kernel::Logger &log) {
+void readTimeSeries(Nexus::File &file, NXLogData &data, Kernel::Logger &log) {
   file.openData("time");
   //----- Start time is an ISO8601 string date and time. ------
-  std::string start;
   try {
-    file.getAttr("start", start);
+    file.getAttr("start", data.start);
   } catch (Nexus::Exception const &) {
     // Some logs have "offset" instead of start
     try {
-      file.getAttr("offset", start);
+      file.getAttr("offset", data.start);
     } catch (Nexus::Exception const &) {
       log.warning() << "Log entry has no start time indicated.\n";
       file.closeData();
       throw;
     }
   }
-  if (start == "No Time") {
-    start = freqStart;
-  }
 
-  // Convert to date and time
-  Types::Core::DateAndTime start_time = Types::Core::DateAndTime(start);
   std::string time_units;
   file.getAttr("units", time_units);
   if (time_units.compare("second") < 0 && time_units != "s" &&
@@ -166,9 +180,8 @@ std::unique_ptr<Kernel::Property> createTimeSeries(Nexus::File &file, const std:
     throw Nexus::Exception("Unsupported time unit '" + time_units + "'");
   }
   //--- Load the seconds into a double array ---
-  std::vector<double> time_double;
   try {
-    file.getDataCoerce(time_double);
+    file.getDataCoerce(data.times);
   } catch (Nexus::Exception const &e) {
     log.warning() << "Log entry's time field could not be loaded: '" << e.what() << "'.\n";
     file.closeData();
@@ -180,89 +193,181 @@ std::unique_ptr<Kernel::Property> createTimeSeries(Nexus::File &file, const std:
   // Convert to seconds if needed
   if (time_units == "minutes") {
     using std::placeholders::_1;
-    std::transform(time_double.begin(), time_double.end(), time_double.begin(),
+    std::transform(data.times.begin(), data.times.end(), data.times.begin(),
                    std::bind(std::multiplies<double>(), _1, 60.0));
   }
 
   // Now the values: Could be a string, int or double
   file.openData("value");
   // Get the units of the property
-  std::string value_units;
   try {
-    file.getAttr("units", value_units);
+    file.getAttr("units", data.valueUnits);
   } catch (Nexus::Exception const &) {
     // Ignore missing units field.
-    value_units = "";
+    data.valueUnits = "";
   }
 
   // Now the actual data
   Nexus::Info info = file.getInfo();
   // Check the size
-  if (size_t(info.dims[0]) != time_double.size()) {
+  if (size_t(info.dims[0]) != data.times.size()) {
     file.closeData();
     throw Nexus::Exception("Invalid value entry for time series");
   }
-  if (file.isDataInt()) // Int type
-  {
-    std::vector<int> values;
-    try {
-      file.getDataCoerce(values);
-      file.closeData();
-    } catch (Nexus::Exception const &) {
-      file.closeData();
-      throw;
+  try {
+    if (file.isDataInt()) // Int type
+    {
+      data.type = NXnumtype::INT32;
+      file.getDataCoerce(data.intValues);
+    } else if (info.type == NXnumtype::CHAR) {
+      data.type = NXnumtype::CHAR;
+      data.itemLength = std::size_t(info.dims[1]);
+      const std::size_t total_length = std::size_t(info.dims[0]) * data.itemLength;
+      boost::scoped_array<char> val_array(new char[total_length]);
+      file.getData(val_array.get());
+      data.charValues = std::string(val_array.get(), total_length);
+    } else if (info.type == NXnumtype::FLOAT32 || info.type == NXnumtype::FLOAT64) {
+      data.type = NXnumtype::FLOAT64;
+      file.getDataCoerce(data.doubleValues);
+    } else {
+      throw Nexus::Exception("Invalid value type for time series. Only int, double or strings are "
+                             "supported");
     }
+  } catch (Nexus::Exception const &) {
+    file.closeData();
+    throw;
+  }
+  file.closeData();
+  log.debug() << "   done reading \"value\" array\n";
+}
+
+/**
+ * Creates a time series property from the contents of a log entry read by readTimeSeries
+ * @param data :: The contents of the log entry
+ * @param freqStart :: A string containing the start time of the frequency log
+ * on SNAP
+ * @param log :: Reference to logger to print out to
+ * @returns A pointer to a new property containing the time series
+ */
+std::unique_ptr<Kernel::Property> createTimeSeries(const NXLogData &data, const std::string &freqStart,
+                                                   Kernel::Logger &log) {
+  // Convert to date and time
+  const Types::Core::DateAndTime start_time(data.start == "No Time" ? freqStart : data.start);
+  const std::string &propName = data.propName;
+
+  if (data.type == NXnumtype::INT32) {
     // Make an int TSP
     auto tsp = std::make_unique<TimeSeriesProperty<int>>(propName);
-    tsp->create(start_time, time_double, values);
-    tsp->setUnits(value_units);
-    log.debug() << "   done reading \"value\" array\n";
+    tsp->create(start_time, data.times, data.intValues);
+    tsp->setUnits(data.valueUnits);
     return tsp;
-  } else if (info.type == NXnumtype::CHAR) {
-    std::string values;
-    const int64_t item_length = info.dims[1];
-    try {
-      const int64_t nitems = info.dims[0];
-      const std::size_t total_length = std::size_t(nitems * item_length);
-      boost::scoped_array<char> val_array(new char[total_length]);
-      file.getData(val_array.get());
-      file.closeData();
-      values = std::string(val_array.get(), total_length);
-    } catch (Nexus::Exception const &) {
-      file.closeData();
-      throw;
-    }
+  } else if (data.type == NXnumtype::CHAR) {
+    std::string values = data.charValues;
     // The string may contain non-printable (i.e. control) characters, replace these
     std::replace_if(values.begin(), values.end(), [&](const char &c) { return isControlValue(c, propName, log); }, ' ');
     auto tsp = std::make_unique<TimeSeriesProperty<std::string>>(propName);
     std::vector<DateAndTime> times;
-    DateAndTime::createVector(start_time, time_double, times);
+    DateAndTime::createVector(start_time, data.times, times);
     const size_t ntimes = times.size();
     for (size_t i = 0; i < ntimes; ++i) {
-      std::string value_i = std::string(values.data() + i * item_length, item_length);
+      std::string value_i = std::string(values.data() + i * data.itemLength, data.itemLength);
       tsp->addValue(times[i], value_i);
     }
-    tsp->setUnits(value_units);
-    log.debug() << "   done reading \"value\" array\n";
+    tsp->setUnits(data.valueUnits);
     return tsp;
-  } else if (info.type == NXnumtype::FLOAT32 || info.type == NXnumtype::FLOAT64) {
-    std::vector<double> values;
-    try {
+  } else {
+    auto tsp = std::make_unique<TimeSeriesProperty<double>>(propName);
+    tsp->create(start_time, data.times, data.doubleValues);
+    tsp->setUnits(data.valueUnits);
+    return tsp;
+  }
+}
+
+/**
+ * Creates a time series property from the currently opened log entry. It is
+ * assumed to
+ * have been checked to have a time field and the value entry's name is given
+ * as an argument
+ * @param file :: A reference to the file handle
+ * @param propName :: The name of the property
+ * @param freqStart :: A string containing the start time of the frequency log
+ * on SNAP
+ * @param log :: Reference to logger to print out to
+ * @returns A pointer to a new property containing the time series
+ */
+std::unique_ptr<Kernel::Property> createTimeSeries(Nexus::File &file, const std::string &propName,
+                                                   const std::string &freqStart, Kernel::Logger &log) {
+  NXLogData data;
+  data.propName = propName;
+  readTimeSeries(file, data, log);
+  return createTimeSeries(data, freqStart, log);
+}
+
+/**
+ * Reads the validity array of the currently opened log entry, if there is one. This should be an int array matching
+ * the data values (or times). If it is not present all data is assumed to be valid.
+ * @param file :: A reference to the file handle
+ * @param numValues :: The number of values in the log
+ * @param log :: Reference to logger to print out to
+ * @returns The validity of each value, or an empty vector if there is no validity data
+ */
+std::vector<int> readTimeSeriesValidity(Nexus::File &file, const std::size_t numValues, Kernel::Logger &log) {
+  std::vector<int> values;
+  if (!file.hasData("value_valid"))
+    return values;
+  file.openData("value_valid");
+  try {
+    // Now the validity data
+    Nexus::Info info = file.getInfo();
+    // Check the size
+    if (size_t(info.dims[0]) != numValues) {
+      throw Nexus::Exception("Invalid value entry for validity data");
+    }
+    if (file.isDataInt()) // Int type
+    {
       file.getDataCoerce(values);
       file.closeData();
-    } catch (Nexus::Exception const &) {
-      file.closeData();
-      throw;
+    } else {
+      throw Nexus::Exception("Invalid value type for validity data. Only int is supported");
     }
-    auto tsp = std::make_unique<TimeSeriesProperty<double>>(propName);
-    tsp->create(start_time, time_double, values);
-    tsp->setUnits(value_units);
-    log.debug() << "   done reading \"value\" array\n";
-    return tsp;
-  } else {
-    throw Nexus::Exception("Invalid value type for time series. Only int, double or strings are "
-                           "supported");
+  } catch (std::exception const &ex) {
+    std::string error_msg = ex.what();
+    log.warning() << error_msg << "\n";
+    file.closeData();
+    // no data found
+    values.clear();
+  }
+  return values;
+}
+
+/**
+ * Creates a time series validity filter property for a log entry
+ * @param values :: The validity array of the log entry, 0 marks invalid data
+ * @param prop :: The time series the validity array belongs to
+ * @param log :: Reference to logger to print out to
+ * @returns A pointer to a new property containing the time series filter or
+ * null if all values are valid
+ */
+std::unique_ptr<Kernel::Property> createTimeSeriesValidityFilter(const std::vector<int> &values,
+                                                                 const Kernel::Property &prop, Kernel::Logger &log) {
+  // convert the integer values to boolean with 0=invalid data
+  if (std::find(values.cbegin(), values.cend(), 0) == values.cend()) {
+    // no invalid data found
+    return std::unique_ptr<Kernel::Property>(nullptr);
   }
+  std::vector<bool> boolValues;
+  boolValues.reserve(values.size());
+  std::transform(values.cbegin(), values.cend(), std::back_inserter(boolValues),
+                 [](const int value) { return value != 0; });
+
+  // Prepare the TimeSeriesProperty<bool>
+  // It's name will be the name of the property plus suffix "_invalid_values"
+  const auto tsProp = dynamic_cast<const Kernel::ITimeSeriesProperty *>(&prop);
+  const auto tspName = API::LogManager::getInvalidValuesFilterLogName(prop.name());
+  auto tsp = std::make_unique<TimeSeriesProperty<bool>>(tspName);
+  tsp->create(tsProp->timesAsVector(), boolValues);
+  log.debug() << "   done reading \"value_valid\" array\n";
+  return tsp;
 }
 
 /**
@@ -277,65 +382,8 @@ std::unique_ptr<Kernel::Property> createTimeSeries(Nexus::File &file, const std:
  */
 std::unique_ptr<Kernel::Property> createTimeSeriesValidityFilter(Nexus::File &file, const Kernel::Property &prop,
                                                                  Kernel::Logger &log) {
-  const auto tsProp = dynamic_cast<const Kernel::ITimeSeriesProperty *>(&prop);
-  const auto times = tsProp->timesAsVector();
-  std::vector<int> values;
-  std::vector<bool> boolValues;
-  // Now the validity of the values
-  // this should be a match int array to the data values (or times)
-  // If not present assume all data is valid
-  if (file.hasData("value_valid")) {
-    file.openData("value_valid");
-    try {
-      // Now the validity data
-      Nexus::Info info = file.getInfo();
-      // Check the size
-      if (size_t(info.dims[0]) != times.size()) {
-        throw Nexus::Exception("Invalid value entry for validity data");
-      }
-      if (file.isDataInt()) // Int type
-      {
-        try {
-          file.getDataCoerce(values);
-          file.closeData();
-        } catch (Nexus::Exception const &) {
-          throw;
-        }
-      } else {
-        throw Nexus::Exception("Invalid value type for validity data. Only int is supported");
-      }
-    } catch (std::exception const &ex) {
-      std::string error_msg = ex.what();
-      log.warning() << error_msg << "\n";
-      file.closeData();
-      // no data found
-      return std::unique_ptr<Kernel::Property>(nullptr);
-    }
-  }
-
-  bool invalidDataFound = false;
-  boolValues.reserve(values.size());
-  // convert the integer values to boolean with 0=invalid data
-  for (size_t i = 0; i < values.size(); i++) {
-    bool isInvalidData = (values[i] == 0);
-    boolValues.emplace_back(!isInvalidData);
-    if (isInvalidData && !invalidDataFound) {
-      invalidDataFound = true;
-    }
-  }
-  if (invalidDataFound) {
-    // Prepare the TimeSeriesProperty<bool>
-    // It's name will be the name of the property plus suffix "_invalid_values"
-    const auto tspName = API::LogManager::getInvalidValuesFilterLogName(prop.name());
-    auto tsp = std::make_unique<TimeSeriesProperty<bool>>(tspName);
-    tsp->create(times, boolValues);
-    log.debug() << "   done reading \"value_valid\" array\n";
-
-    return tsp;
-  } else {
-    // no data found
-    return std::unique_ptr<Kernel::Property>(nullptr);
-  }
+  const auto values = readTimeSeriesValidity(file, static_cast<std::size_t>(prop.size()), log);
+  return createTimeSeriesValidityFilter(values, prop, log);
 }
 
 /**
@@ -771,6 +819,8 @@ void LoadNexusLogs::loadLogs(Nexus::File &file, const std::string &absolute_entr
                              const std::vector<std::string> &block_list) const {
 
   const std::map<std::string, std::set<std::string>> &allEntries = getFileInfo()->getAllEntries();
+  // NXlog and NXpositioner entries are loaded together so they can be converted in parallel
+  std::vector<std::pair<std::string, std::string>> nxLogs;
 
   auto lf_LoadByLogClass = [&](const std::string &logClass, const bool isNxLog) {
     auto itLogClass = allEntries.find(logClass);
@@ -807,7 +857,7 @@ void LoadNexusLogs::loadLogs(Nexus::File &file, const std::string &absolute_entr
           } // end of looping over block_list
 
           if (isNxLog) {
-            loadNXLog(file, *it, logClass, workspace);
+            nxLogs.emplace_back(*it, logClass);
           } else {
             loadSELog(file, *it, workspace);
           }
@@ -825,7 +875,7 @@ void LoadNexusLogs::loadLogs(Nexus::File &file, const std::string &absolute_entr
         // must be third level entry
         if (std::count(it->begin(), it->end(), '/') == 3) {
           if (isNxLog) {
-            loadNXLog(file, *it, logClass, workspace);
+            nxLogs.emplace_back(*it, logClass);
           } else {
             loadSELog(file, *it, workspace);
           }
@@ -838,6 +888,7 @@ void LoadNexusLogs::loadLogs(Nexus::File &file, const std::string &absolute_entr
   file.openGroup(entry_name, entry_class);
   lf_LoadByLogClass("NXlog", true);
   lf_LoadByLogClass("NXpositioner", true);
+  loadNXLogs(file, nxLogs, workspace);
   lf_LoadByLogClass("IXseblock", false);
   loadVetoPulses(file, workspace);
 
@@ -845,76 +896,107 @@ void LoadNexusLogs::loadLogs(Nexus::File &file, const std::string &absolute_entr
 }
 
 /**
- * Load an NX log entry a group type that has value and time entries.
+ * Load NX log entries, groups that have value and time entries. The entries are read from the file one at a time and
+ * then converted to properties in parallel, as the conversion of the larger logs takes longer than reading them.
  * @param file :: A reference to the NeXus file handle opened at the parent
  * group
- * @param absolute_entry_name :: The name of the log entry
- * @param entry_class :: The type of the entry
+ * @param entries :: The name and class of each log entry
  * @param workspace :: A pointer to the workspace to store the logs
  */
-void LoadNexusLogs::loadNXLog(Nexus::File &file, const std::string &absolute_entry_name, const std::string &entry_class,
-                              const std::shared_ptr<API::MatrixWorkspace> &workspace) const {
-
-  const std::string entry_name = absolute_entry_name.substr(absolute_entry_name.find_last_of("/") + 1);
-  g_log.debug() << "processing " << entry_name << ":" << entry_class << "\n";
-  file.openGroup(entry_name, entry_class);
-  // Validate the NX log class.
-  // Just verify that time and value entries exist
-  const std::string timeEntry = absolute_entry_name + "/time";
-  const std::string valueEntry = absolute_entry_name + "/value";
-  const std::string validatorEntry = absolute_entry_name + "/value_valid";
-  bool foundValue = false;
-  bool foundTime = false;
-  bool foundValidator = false;
-
+void LoadNexusLogs::loadNXLogs(Nexus::File &file, const std::vector<std::pair<std::string, std::string>> &entries,
+                               const std::shared_ptr<API::MatrixWorkspace> &workspace) const {
   const std::map<std::string, std::set<std::string>> &allEntries = getFileInfo()->getAllEntries();
-  // reverse search to take advantage of the fact that these are located in SDS
-  for (auto it = allEntries.rbegin(); it != allEntries.rend(); ++it) {
-    const std::set<std::string> &entriesSet = it->second;
-    if (entriesSet.count(timeEntry) == 1) {
-      foundTime = true;
-    }
-    if (entriesSet.count(valueEntry) == 1) {
-      foundValue = true;
+  // whether to overwrite logs on workspace
+  const bool overwritelogs = this->getProperty("OverwriteLogs");
+
+  std::vector<NXLogData> logs;
+  logs.reserve(entries.size());
+  for (const auto &[absolute_entry_name, entry_class] : entries) {
+    const std::string entry_name = absolute_entry_name.substr(absolute_entry_name.find_last_of("/") + 1);
+    g_log.debug() << "processing " << entry_name << ":" << entry_class << "\n";
+    // Validate the NX log class.
+    // Just verify that time and value entries exist
+    const std::string timeEntry = absolute_entry_name + "/time";
+    const std::string valueEntry = absolute_entry_name + "/value";
+    const std::string validatorEntry = absolute_entry_name + "/value_valid";
+    bool foundValue = false;
+    bool foundTime = false;
+    bool foundValidator = false;
+
+    // reverse search to take advantage of the fact that these are located in SDS
+    for (auto it = allEntries.rbegin(); it != allEntries.rend(); ++it) {
+      const std::set<std::string> &entriesSet = it->second;
+      if (entriesSet.count(timeEntry) == 1) {
+        foundTime = true;
+      }
+      if (entriesSet.count(valueEntry) == 1) {
+        foundValue = true;
+      }
+      if (entriesSet.count(validatorEntry) == 1) {
+        foundValidator = true;
+      }
+      if (foundTime && foundValue && foundValidator) {
+        break;
+      }
     }
-    if (entriesSet.count(validatorEntry) == 1) {
-      foundValidator = true;
+
+    if (!foundTime || !foundValue) {
+      g_log.warning() << "Invalid NXlog entry " << entry_name << " found. Did not contain 'value' and 'time'.\n";
+      continue;
     }
-    if (foundTime && foundValue && foundValidator) {
-      break;
+    if (!overwritelogs && workspace->run().hasProperty(entry_name)) {
+      continue;
     }
-  }
 
-  if (!foundTime || !foundValue) {
-    g_log.warning() << "Invalid NXlog entry " << entry_name << " found. Did not contain 'value' and 'time'.\n";
+    file.openGroup(entry_name, entry_class);
+    try {
+      NXLogData data;
+      data.propName = entry_name;
+      readTimeSeries(file, data, g_log);
+      // Read (possibly) the validity of the values, companion to time series `entry_name`
+      if (foundValidator) {
+        data.validity = readTimeSeriesValidity(file, data.times.size(), g_log);
+      }
+      logs.emplace_back(std::move(data));
+    } catch (Nexus::Exception const &e) {
+      g_log.warning() << "NXlog entry " << entry_name << " gave an error when loading:'" << e.what() << "'.\n";
+    }
     file.closeGroup();
-    return;
   }
 
-  // whether to overwrite logs on workspace
-  bool overwritelogs = this->getProperty("OverwriteLogs");
-  try {
-    if (overwritelogs || !(workspace->run().hasProperty(entry_name))) {
-      auto logValue = createTimeSeries(file, entry_name, freqStart, g_log);
-      // Create (possibly) a boolean time series, companion to time series `entry_name`
-      if (foundValidator) {
-        auto validityLogValue = createTimeSeriesValidityFilter(file, *logValue, g_log);
-        if (validityLogValue) {
-          appendEndTimeLog(validityLogValue.get(), workspace->run());
-          workspace->mutableRun().addProperty(std::move(validityLogValue), overwritelogs);
-          m_logsWithInvalidValues.emplace_back(entry_name);
-        }
+  // The file is not used from here on so each log can be converted independently
+  const API::Run &run = workspace->run();
+  std::vector<std::unique_ptr<Kernel::Property>> logValues(logs.size());
+  std::vector<std::unique_ptr<Kernel::Property>> validityLogValues(logs.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(logs.size()); ++i) {
+    try {
+      logValues[i] = createTimeSeries(logs[i], freqStart, g_log);
+      validityLogValues[i] = createTimeSeriesValidityFilter(logs[i].validity, *logValues[i], g_log);
+      if (validityLogValues[i]) {
+        appendEndTimeLog(validityLogValues[i].get(), run);
       }
-      appendEndTimeLog(logValue.get(), workspace->run());
-      workspace->mutableRun().addProperty(std::move(logValue), overwritelogs);
+      appendEndTimeLog(logValues[i].get(), run);
+    } catch (std::exception &e) {
+      g_log.warning() << "NXlog entry " << logs[i].propName << " gave an error when loading:'" << e.what() << "'.\n";
+      logValues[i].reset();
+      validityLogValues[i].reset();
     }
-  } catch (Nexus::Exception const &e) {
-    g_log.warning() << "NXlog entry " << entry_name << " gave an error when loading:'" << e.what() << "'.\n";
-  } catch (std::invalid_argument &e) {
-    g_log.warning() << "NXlog entry " << entry_name << " gave an error when loading:'" << e.what() << "'.\n";
+    // the arrays read from the file are no longer needed
+    logs[i] = NXLogData();
   }
 
-  file.closeGroup();
+  // Add the logs in the order they are in the file
+  for (size_t i = 0; i < logValues.size(); ++i) {
+    if (!logValues[i]) {
+      continue;
+    }
+    if (validityLogValues[i]) {
+      m_logsWithInvalidValues.emplace_back(logValues[i]->name());
+      workspace->mutableRun().addProperty(std::move(validityLogValues[i]), overwritelogs);
+    }
+    workspace->mutableRun().addProperty(std::move(logValues[i]), overwritelogs);
+  }
 }
 
 void LoadNexusLogs::loadSELog(Nexus::File &file, const std::string &absolute_entry_name,
@@ -44,6 +44,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -65,6 +66,9 @@ namespace {
 // Helper typedef
 using IntArray = std::vector<int>;
 
+/// Maximum number of events read from the file in one go by loadEventEntry, unless a spectrum has more
+constexpr int64_t EVENT_CHUNK_SIZE{1 << 23};
+
 // Struct to contain spectrum information.
 struct SpectraInfo {
   // Number of spectra
@@ -671,102 +675,136 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadEventEntry(NXData &wksp_cls, N
     unitLabel = indices_data.attributes("units");
   ws->setYUnitLabel(unitLabel);
 
-  // Handle optional fields.
-  // TODO: Handle inconsistent sizes
-  std::vector<int64_t> pulsetimes;
-  if (wksp_cls.isValid("pulsetime")) {
-    NXInt64 pulsetime = wksp_cls.openNXDataSet<int64_t>("pulsetime");
-    pulsetime.load();
-    pulsetimes = pulsetime.vecBuffer();
-  }
-
-  std::vector<double> tofs;
-  if (wksp_cls.isValid("tof")) {
-    NXDouble tof = wksp_cls.openNXDouble("tof");
-    tof.load();
-    tofs = tof.vecBuffer();
-  }
-
-  std::vector<float> error_squareds;
-  if (wksp_cls.isValid("error_squared")) {
-    NXFloat error_squared = wksp_cls.openNXFloat("error_squared");
-    error_squared.load();
-    error_squareds = error_squared.vecBuffer();
-  }
-
-  std::vector<float> weights;
-  if (wksp_cls.isValid("weight")) {
-    NXFloat weight = wksp_cls.openNXFloat("weight");
-    weight.load();
-    weights = weight.vecBuffer();
-  }
+  // The events are read in chunks of spectra whose events are contiguous in the file. Only the events of the spectra
+  // being loaded are read, and only one chunk is held in memory alongside the event lists.
+  const auto fieldLength = [&wksp_cls](const std::string &name) -> int64_t {
+    if (!wksp_cls.isValid(name))
+      return 0;
+    NXDataSet field(wksp_cls, name);
+    field.open();
+    return field.dim0();
+  };
+  const bool hasTofs = fieldLength("tof") > 0;
+  const bool hasPulsetimes = fieldLength("pulsetime") > 0;
+  const bool hasWeights = fieldLength("weight") > 0 && fieldLength("error_squared") > 0;
 
   // What type of event lists?
   EventType type = TOF;
-  if (!tofs.empty() && !pulsetimes.empty() && !weights.empty() && !error_squareds.empty())
+  if (hasTofs && hasPulsetimes && hasWeights)
     type = WEIGHTED;
-  else if ((!tofs.empty() && !weights.empty() && !error_squareds.empty()))
+  else if (hasTofs && hasWeights)
     type = WEIGHTED_NOTIME;
-  else if (!pulsetimes.empty() && !tofs.empty())
+  else if (hasPulsetimes && hasTofs)
     type = TOF;
   else
     throw std::runtime_error("Could not figure out the type of event list!");
 
+  NXDouble tof = wksp_cls.openNXDouble("tof");
+  std::optional<NXInt64> pulsetime;
+  if (type != WEIGHTED_NOTIME)
+    pulsetime.emplace(wksp_cls.openNXDataSet<int64_t>("pulsetime"));
+  std::optional<NXFloat> weight;
+  std::optional<NXFloat> error_squared;
+  if (type != TOF) {
+    weight.emplace(wksp_cls.openNXFloat("weight"));
+    error_squared.emplace(wksp_cls.openNXFloat("error_squared"));
+  }
+
   // indices of events
-  std::vector<int64_t> indices = indices_data.vecBuffer();
+  const std::vector<int64_t> &indices = indices_data.vecBuffer();
+  const auto max = static_cast<int64_t>(m_filtered_spec_idxs.size());
+  struct EventChunk {
+    int64_t firstSpectrum;
+    int64_t endSpectrum;
+    int64_t firstEvent;
+    int64_t endEvent;
+  };
+  std::vector<EventChunk> chunks;
+  for (int64_t j = 0; j < max; ++j) {
+    const size_t wi = m_filtered_spec_idxs[j] - 1;
+    const int64_t index_start = indices[wi];
+    const int64_t index_end = std::max(indices[wi + 1], index_start);
+    if (!chunks.empty() && chunks.back().endEvent == index_start &&
+        index_end - chunks.back().firstEvent <= EVENT_CHUNK_SIZE) {
+      chunks.back().endSpectrum = j + 1;
+      chunks.back().endEvent = index_end;
+    } else {
+      chunks.emplace_back(EventChunk{j, j + 1, index_start, index_end});
+    }
+  }
+
   // Create all the event lists
-  auto max = static_cast<int64_t>(m_filtered_spec_idxs.size());
   Progress progress(this, progressStart, progressStart + progressRange, max);
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int64_t j = 0; j < max; ++j) {
-    PARALLEL_START_INTERRUPT_REGION
-    size_t wi = m_filtered_spec_idxs[j] - 1;
-    int64_t index_start = indices[wi];
-    int64_t index_end = indices[wi + 1];
-    if (index_end >= index_start) {
-      EventList &el = ws->getSpectrum(j);
-      el.switchTo(type);
-
-      // Allocate all the required memory
-      el.reserve(index_end - index_start);
-      el.clearDetectorIDs();
-
-      for (int64_t i = index_start; i < index_end; i++)
+  for (const auto &chunk : chunks) {
+    const int64_t numEvents = chunk.endEvent - chunk.firstEvent;
+    if (numEvents > 0) {
+      tof.load(numEvents, chunk.firstEvent);
+      if (pulsetime)
+        pulsetime->load(numEvents, chunk.firstEvent);
+      if (weight) {
+        weight->load(numEvents, chunk.firstEvent);
+        error_squared->load(numEvents, chunk.firstEvent);
+      }
+    }
+    const double *tofs = tof.vecBuffer().data();
+    const int64_t *pulsetimes = pulsetime ? pulsetime->vecBuffer().data() : nullptr;
+    const float *weights = weight ? weight->vecBuffer().data() : nullptr;
+    const float *error_squareds = error_squared ? error_squared->vecBuffer().data() : nullptr;
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t j = chunk.firstSpectrum; j < chunk.endSpectrum; ++j) {
+      PARALLEL_START_INTERRUPT_REGION
+      size_t wi = m_filtered_spec_idxs[j] - 1;
+      // positions of the events in the buffers of this chunk
+      int64_t index_start = indices[wi] - chunk.firstEvent;
+      int64_t index_end = indices[wi + 1] - chunk.firstEvent;
+      if (index_end >= index_start) {
+        EventList &el = ws->getSpectrum(j);
+        el.switchTo(type);
+
+        // Allocate all the required memory
+        el.reserve(index_end - index_start);
+        el.clearDetectorIDs();
+
         switch (type) {
         case TOF:
-          el.addEventQuickly(TofEvent(tofs[i], DateAndTime(pulsetimes[i])));
+          for (int64_t i = index_start; i < index_end; i++)
+            el.addEventQuickly(TofEvent(tofs[i], DateAndTime(pulsetimes[i])));
           break;
         case WEIGHTED:
-          el.addEventQuickly(WeightedEvent(tofs[i], DateAndTime(pulsetimes[i]), weights[i], error_squareds[i]));
+          for (int64_t i = index_start; i < index_end; i++)
+            el.addEventQuickly(WeightedEvent(tofs[i], DateAndTime(pulsetimes[i]), weights[i], error_squareds[i]));
           break;
         case WEIGHTED_NOTIME:
-          el.addEventQuickly(WeightedEventNoTime(tofs[i], weights[i], error_squareds[i]));
+          for (int64_t i = index_start; i < index_end; i++)
+            el.addEventQuickly(WeightedEventNoTime(tofs[i], weights[i], error_squareds[i]));
           break;
         }
 
-      // Set the X axis
-      if (this->m_shared_bins)
-        el.setHistogram(this->m_xbins);
-      else {
-        MantidVec x(xbins.dim1());
-
-        for (std::size_t i = 0; i < xbins.dim1(); i++)
-          x[i] = xbins(wi, i);
-
-        // for ragged workspace we need to remove all NaN value from end of vector
-        const auto idx =
-            std::distance(x.rbegin(), std::find_if_not(x.rbegin(), x.rend(), [](auto val) { return std::isnan(val); }));
-        if (idx > 0)
-          x.resize(x.size() - idx);
-        // Workspace and el was just created, so we can just set a new histogram
-        // We can move x as it is not longer used after this point
-        el.setHistogram(HistogramData::BinEdges(std::move(x)));
+        // Set the X axis
+        if (this->m_shared_bins)
+          el.setHistogram(this->m_xbins);
+        else {
+          MantidVec x(xbins.dim1());
+
+          for (std::size_t i = 0; i < xbins.dim1(); i++)
+            x[i] = xbins(wi, i);
+
+          // for ragged workspace we need to remove all NaN value from end of vector
+          const auto idx = std::distance(
+              x.rbegin(), std::find_if_not(x.rbegin(), x.rend(), [](auto val) { return std::isnan(val); }));
+          if (idx > 0)
+            x.resize(x.size() - idx);
+          // Workspace and el was just created, so we can just set a new histogram
+          // We can move x as it is not longer used after this point
+          el.setHistogram(HistogramData::BinEdges(std::move(x)));
+        }
       }
+      progress.report();
+      PARALLEL_END_INTERRUPT_REGION
     }
-    progress.report();
-    PARALLEL_END_INTERRUPT_REGION
+    PARALLEL_CHECK_INTERRUPT_REGION
   }
-  PARALLEL_CHECK_INTERRUPT_REGION
 
   return ws;
 }
@@ -22,12 +22,14 @@ ProcessBankData::ProcessBankData(DefaultEventLoader &m_loader, const std::string
                                  size_t startAt, std::shared_ptr<std::vector<uint64_t>> const &tevent_index,
                                  std::shared_ptr<BankPulseTimes> const &thisBankPulseTimes, bool have_weight,
                                  std::shared_ptr<std::vector<float>> const &tevent_weight, detid_t min_event_id,
-                                 detid_t max_event_id)
+                                 detid_t max_event_id,
+                                 std::shared_ptr<const EventPrecountCache::BankCounts> pixelCounts)
     : Task(), m_loader(m_loader), entry_name(std::move(entry_name)),
       pixelID_to_wi_vector(m_loader.pixelID_to_wi_vector), pixelID_to_wi_offset(m_loader.pixelID_to_wi_offset),
       prog(prog), event_detid(event_id), event_time_of_flight(tevent_time_of_flight), numEvents(numEvents),
       startAt(startAt), event_index(tevent_index), thisBankPulseTimes(thisBankPulseTimes), have_weight(have_weight),
-      event_weight(tevent_weight), m_min_detid(min_event_id), m_max_detid(max_event_id) {
+      event_weight(tevent_weight), m_min_detid(min_event_id), m_max_detid(max_event_id),
+      m_pixelCounts(std::move(pixelCounts)) {
   // Cost is approximately proportional to the number of events to process.
   m_cost = static_cast<double>(numEvents);
 
@@ -39,15 +41,19 @@ ProcessBankData::ProcessBankData(DefaultEventLoader &m_loader, const std::string
 }
 
 /*
- * Pre-counting the events per pixel ID allows for allocating the proper amount of memory in each output event vector
+ * Pre-counting the events per pixel ID allows for allocating the proper amount of memory in each output event vector.
+ * The events are only counted if the counts were not given to the constructor.
  */
 void ProcessBankData::preCountAndReserveMem() {
   // ---- Pre-counting events per pixel ID ----
-  std::vector<size_t> counts(m_max_detid - m_min_detid + 1, 0);
-  for (size_t i = 0; i < numEvents; i++) {
-    const auto thisId = static_cast<detid_t>((*event_detid)[i]);
-    if (!(thisId < m_min_detid || thisId > m_max_detid)) // or allows for skipping out early
-      counts[thisId - m_min_detid]++;
+  std::vector<size_t> counts;
+  if (!m_pixelCounts) {
+    counts.resize(m_max_detid - m_min_detid + 1, 0);
+    for (size_t i = 0; i < numEvents; i++) {
+      const auto thisId = static_cast<detid_t>((*event_detid)[i]);
+      if (!(thisId < m_min_detid || thisId > m_max_detid)) // or allows for skipping out early
+        counts[thisId - m_min_detid]++;
+    }
   }
 
   // Now we pre-allocate (reserve) the vectors of events in each pixel counted
@@ -56,12 +62,14 @@ void ProcessBankData::preCountAndReserveMem() {
   const size_t numEventLists = outputWS.getNumberHistograms();
   for (detid_t pixID = m_min_detid; pixID <= m_max_detid; ++pixID) {
     const auto pixelIndex = pixID - m_min_detid; // index from zero
-    if (counts[pixelIndex] > 0) {
+    const auto count = m_pixelCounts ? static_cast<size_t>(m_pixelCounts->count(static_cast<uint32_t>(pixID)))
+                                     : counts[pixelIndex];
+    if (count > 0) {
       const size_t wi = getWorkspaceIndexFromPixelID(pixID);
       // Find the workspace index corresponding to that pixel ID
       // Allocate it
       if (wi < numEventLists) {
-        outputWS.reserveEventListAt(wi, counts[pixelIndex]);
+        outputWS.reserveEventListAt(wi, count);
       }
       if ((wi % 20 == 0) && alg->getCancel())
         return; // User cancellation
@@ -147,6 +147,12 @@ void SaveNexusProcessed::init() {
                   "This will make smaller files but takes much longer.");
   setPropertySettings("CompressNexus",
                       std::make_unique<EnabledWhenWorkspaceIsType<EventWorkspace>>("InputWorkspace", true));
+
+  auto deflateLevel = std::make_shared<BoundedValidator<int>>(1, 9);
+  declareProperty("CompressionLevel", 6, deflateLevel,
+                  "Deflate level of the compressed histogram data, from 1 (fastest) to 9 (smallest file).");
+  declareProperty("CompressionShuffle", true,
+                  "Shuffle the bytes of the histogram data before compressing, which usually makes smaller files.");
 }
 
 /** Get the list of workspace indices to use
@@ -266,6 +272,9 @@ void SaveNexusProcessed::doExec(const Workspace_sptr &inputWorkspace, std::share
   const bool append_to_file = getProperty("Append");
 
   nexusFile->resetProgress(&prog_init);
+  const int compressionLevel = getProperty("CompressionLevel");
+  const bool compressionShuffle = getProperty("CompressionShuffle");
+  nexusFile->setDeflateSettings({compressionLevel, compressionShuffle});
   nexusFile->openNexusWrite(filename, entryNumber, append_to_file || keepFile);
 
   prog_init.reportIncrement(1, "Opening file");
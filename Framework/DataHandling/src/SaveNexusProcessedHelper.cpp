@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 // NexusFileIO
 // @author Ronald Fowler
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -23,6 +24,10 @@
 #include "MantidDataObjects/RebinnedOutput.h"
 #include "MantidDataObjects/TableWorkspace.h"
 #include "MantidHistogramData/Histogram.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <tbb/parallel_pipeline.h>
+#include <tbb/task_arena.h>
 
 #include <filesystem>
 #include <memory>
@@ -215,17 +220,74 @@ template <class V> const double *_dataPointer(const V &v) { return v.rawData().d
 
 template <> const double *_dataPointer<MantidVec>(const MantidVec &v) { return v.data(); }
 
+// Target size of the uncompressed chunks of compressed datasets. This is below the 1 MiB default chunk cache of HDF5 so
+// reading a spectrum at a time when loading does not decompress each chunk more than once.
+constexpr size_t _COMPRESSED_CHUNK_BYTES(512 * 1024);
+
+// A chunk of rows compressed by `_writeCompressedChunks`
+struct _CompressedChunk {
+  size_t firstRow{0};
+  std::vector<char> data;
+};
+
+// Internal-use method:
+//   * Write the rows of an open dataset created with `makeDeflateData` and chunks of `rowsPerChunk` rows;
+//   * Chunks are filled and compressed on worker threads and written to the file in order by a single thread.
+template <class V, class WS>
+void _writeCompressedChunks(Nexus::File &dest, const WS &src, const std::vector<int> &indices, _VAccessor<V, WS> vData,
+                            const size_t chunk_size, const size_t rowsPerChunk, const double fillValue,
+                            const Nexus::DeflateSettings &settings) {
+  const size_t N_chunk = indices.size();
+  size_t nextRow = 0;
+  // if the workspace can not be read from many threads only the compression overlaps with the writing
+  const auto compressMode = Kernel::threadSafe(src) ? tbb::filter_mode::parallel : tbb::filter_mode::serial_in_order;
+  const auto maxChunksInFlight = static_cast<size_t>(2 * tbb::this_task_arena::max_concurrency());
+
+  tbb::parallel_pipeline(
+      maxChunksInFlight,
+      tbb::make_filter<void, size_t>(tbb::filter_mode::serial_in_order,
+                                     [&](tbb::flow_control &fc) -> size_t {
+                                       if (nextRow >= N_chunk) {
+                                         fc.stop();
+                                         return 0;
+                                       }
+                                       const size_t firstRow = nextRow;
+                                       nextRow += rowsPerChunk;
+                                       return firstRow;
+                                     }) &
+          tbb::make_filter<size_t, _CompressedChunk>(
+              compressMode,
+              [&](const size_t firstRow) {
+                // every chunk has the full dimensions, including rows past the end of the dataset in the last one
+                std::vector<double> buffer(rowsPerChunk * chunk_size, fillValue);
+                const size_t lastRow = std::min(firstRow + rowsPerChunk, N_chunk);
+                for (size_t row = firstRow; row < lastRow; ++row) {
+                  const auto &v = (src.*vData)(indices[row]);
+                  std::copy_n(_dataPointer<V>(v), v.size(), buffer.begin() + (row - firstRow) * chunk_size);
+                }
+                return _CompressedChunk{firstRow, Nexus::compressChunk(buffer.data(), buffer.size() * sizeof(double),
+                                                                       sizeof(double), settings)};
+              }) &
+          tbb::make_filter<_CompressedChunk, void>(tbb::filter_mode::serial_in_order,
+                                                   [&dest](const _CompressedChunk &chunk) {
+                                                     dest.putRawChunk(chunk.data.data(), chunk.data.size(),
+                                                                      Nexus::DimVector{chunk.firstRow, 0});
+                                                   }));
+}
+
 // Internal-use method:
 //   * Create the dataset and write chunks of double-precision data;
 //   * Optionally fill the chunks with a specified fill value;
 //   * Optionally close the dataset.
+// LZW compressed datasets have chunks of many rows, compressed in parallel with `deflateSettings`.
 template <class V, class WS>
 void _writeChunkedData(std::shared_ptr<Nexus::File> dest, // Must have open group, but NO open dataset
                        const std::string &name,
                        std::shared_ptr<const WS> src, // Do not pass std::shared_ptr<..> by reference!
                        const std::vector<int> &indices, _VAccessor<V, WS> vData, bool raggedSpectra = false,
                        NXcompression compressionType = NXcompression::NONE, double fillValue = _DEFAULT_FILL_VALUE,
-                       bool closeData = true) {
+                       bool closeData = true,
+                       const Nexus::DeflateSettings &deflateSettings = Nexus::DeflateSettings()) {
 
   const size_t N_chunk = indices.size(); // number of spectra
 
@@ -237,6 +299,18 @@ void _writeChunkedData(std::shared_ptr<Nexus::File> dest, // Must have open grou
   const size_t chunk_size = _chunk_size;
 
   const Nexus::DimVector dims = {N_chunk, chunk_size};
+
+  if (compressionType == NXcompression::LZW && N_chunk > 0 && chunk_size > 0) {
+    const size_t rowsPerChunk =
+        std::clamp<size_t>(_COMPRESSED_CHUNK_BYTES / (chunk_size * sizeof(double)), 1, std::max<size_t>(N_chunk, 1));
+    dest->makeDeflateData(name, NXnumtype::FLOAT64, dims, {rowsPerChunk, chunk_size}, deflateSettings.level,
+                          deflateSettings.shuffle, true);
+    _writeCompressedChunks<V, WS>(*dest, *src, indices, vData, chunk_size, rowsPerChunk, fillValue, deflateSettings);
+    if (closeData)
+      dest->closeData();
+    return;
+  }
+
   const Nexus::DimVector chunk_dims = {1, chunk_size};
 
   // Create and open the dataset.
@@ -324,8 +398,8 @@ int NexusFileIO::writeNexusProcessedData2D(const API::MatrixWorkspace_const_sptr
   if (write2Ddata) {
     _writeChunkedData<HistogramY, MatrixWorkspace>(m_filehandle, "values", localworkspace, indices, &MatrixWorkspace::y,
                                                    raggedSpectra, m_nexuscompression, _DEFAULT_FILL_VALUE,
-                                                   false // don't close the dataset
-    );
+                                                   false, // don't close the dataset
+                                                   m_deflateSettings);
 
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
@@ -338,7 +412,8 @@ int NexusFileIO::writeNexusProcessedData2D(const API::MatrixWorkspace_const_sptr
 
     // errors
     _writeChunkedData<HistogramE, MatrixWorkspace>(m_filehandle, "errors", localworkspace, indices, &MatrixWorkspace::e,
-                                                   raggedSpectra, m_nexuscompression);
+                                                   raggedSpectra, m_nexuscompression, _DEFAULT_FILL_VALUE, true,
+                                                   m_deflateSettings);
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
 
@@ -349,8 +424,8 @@ int NexusFileIO::writeNexusProcessedData2D(const API::MatrixWorkspace_const_sptr
       _writeChunkedData<MantidVec, RebinnedOutput>(m_filehandle, "frac_area", rebin_workspace, indices,
                                                    &RebinnedOutput::readF, raggedSpectra, m_nexuscompression,
                                                    _DEFAULT_FILL_VALUE,
-                                                   false // don't close the dataset
-      );
+                                                   false, // don't close the dataset
+                                                   m_deflateSettings);
 
       std::string finalized = (rebin_workspace->isFinalized()) ? "1" : "0";
       m_filehandle->putAttr("finalized", finalized);
@@ -365,7 +440,8 @@ int NexusFileIO::writeNexusProcessedData2D(const API::MatrixWorkspace_const_sptr
     // x errors
     if (localworkspace->hasDx(0)) {
       _writeChunkedData<HistogramDx, MatrixWorkspace>(m_filehandle, "xerrors", localworkspace, indices,
-                                                      &MatrixWorkspace::dx, raggedSpectra, m_nexuscompression);
+                                                      &MatrixWorkspace::dx, raggedSpectra, m_nexuscompression,
+                                                      _DEFAULT_FILL_VALUE, true, m_deflateSettings);
     }
   }
 
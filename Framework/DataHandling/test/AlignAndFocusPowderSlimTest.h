@@ -181,6 +181,35 @@ public:
     TS_ASSERT(result);
   }
 
+  void test_chunks_in_flight() {
+    // load the banks in 9 to 27 chunks so the pipeline has something to overlap
+    auto run_with_chunks_in_flight = [](const int chunks_in_flight) -> Workspace_sptr {
+      AlignAndFocusPowderSlim alg;
+      alg.setChild(true);
+      TS_ASSERT_THROWS_NOTHING(alg.initialize())
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("Filename", VULCAN_218062));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "unused"));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("ReadSizeFromDisk", 1000000));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("ChunksInFlight", chunks_in_flight));
+      TS_ASSERT_THROWS_NOTHING(alg.execute(););
+      return alg.getProperty("OutputWorkspace");
+    };
+
+    // reading a single chunk at a time does not overlap reading and histogramming
+    Workspace_sptr outputWS1 = run_with_chunks_in_flight(1);
+    Workspace_sptr outputWS4 = run_with_chunks_in_flight(4);
+    TS_ASSERT(outputWS1);
+    TS_ASSERT(outputWS4);
+
+    AlignAndFocusPowderSlim alg;
+    auto compareAlg = alg.createChildAlgorithm("CompareWorkspaces");
+    compareAlg->setProperty("Workspace1", outputWS1);
+    compareAlg->setProperty("Workspace2", outputWS4);
+    compareAlg->execute();
+    bool result = compareAlg->getProperty("Result");
+    TS_ASSERT(result);
+  }
+
   void test_common_x() {
     TestConfig configuration({13000.}, {36000.}, {}, "Logarithmic", "TOF");
     auto outputWS = std::dynamic_pointer_cast<MatrixWorkspace>(run_algorithm(VULCAN_218062, configuration));
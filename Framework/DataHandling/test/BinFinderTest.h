@@ -0,0 +1,148 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataHandling/AlignAndFocusPowderSlim/BinFinder.h"
+#include "MantidKernel/VectorHelper.h"
+#include <cxxtest/TestSuite.h>
+#include <numeric>
+#include <random>
+
+using Mantid::DataHandling::AlignAndFocusPowderSlim::BinFinder;
+
+namespace {
+std::vector<double> createBinEdges(const double xmin, const double delta, const double xmax) {
+  std::vector<double> binedges;
+  Mantid::Kernel::VectorHelper::createAxisFromRebinParams({xmin, delta, xmax}, binedges, true, false);
+  return binedges;
+}
+
+size_t binarySearch(const std::vector<double> &binedges, const double tof) {
+  const auto it = std::upper_bound(binedges.cbegin(), binedges.cend(), tof);
+  return static_cast<size_t>(std::distance(binedges.cbegin(), it) - 1);
+}
+
+std::vector<double> createTofs(const std::vector<double> &binedges, const size_t num_events) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(binedges.front(), binedges.back());
+  std::vector<double> tofs(num_events);
+  std::generate(tofs.begin(), tofs.end(), [&]() { return distribution(generator); });
+  return tofs;
+}
+} // namespace
+
+class BinFinderTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BinFinderTest *createSuite() { return new BinFinderTest(); }
+  static void destroySuite(BinFinderTest *suite) { delete suite; }
+
+  void test_linear() {
+    const auto binedges = createBinEdges(1000., 10., 20005.); // last bin is oversized
+    BinFinder finder(&binedges);
+    TS_ASSERT_EQUALS(finder.strategy(), BinFinder::Strategy::LINEAR);
+    run_compare_with_binary_search(finder, binedges);
+  }
+
+  void test_logarithmic() {
+    const auto binedges = createBinEdges(0.1, -0.0016, 2.); // d-spacing default for AlignAndFocusPowderSlim
+    BinFinder finder(&binedges);
+    TS_ASSERT_EQUALS(finder.strategy(), BinFinder::Strategy::LOGARITHMIC);
+    run_compare_with_binary_search(finder, binedges);
+  }
+
+  void test_ragged() {
+    const std::vector<double> binedges{1000., 2000., 5000., 5500., 9000.};
+    BinFinder finder(&binedges);
+    TS_ASSERT_EQUALS(finder.strategy(), BinFinder::Strategy::BINARY_SEARCH);
+    run_compare_with_binary_search(finder, binedges);
+  }
+
+  void test_single_bin() {
+    const std::vector<double> binedges{1000., 2000.};
+    BinFinder finder(&binedges);
+    TS_ASSERT_EQUALS(finder.strategy(), BinFinder::Strategy::LINEAR);
+    TS_ASSERT_EQUALS(finder.findBin(1000.), 0);
+    TS_ASSERT_EQUALS(finder.findBin(1999.), 0);
+  }
+
+  void test_bin_edges_are_in_upper_bin() {
+    const auto binedges = createBinEdges(0.1, -0.0016, 2.);
+    BinFinder finder(&binedges);
+    for (size_t i = 0; i + 1 < binedges.size(); ++i)
+      TS_ASSERT_EQUALS(finder.findBin(binedges[i]), i);
+  }
+
+  void test_force_strategy() {
+    const auto binedges = createBinEdges(0.1, -0.0016, 2.);
+    BinFinder finder(&binedges, BinFinder::Strategy::BINARY_SEARCH);
+    TS_ASSERT_EQUALS(finder.strategy(), BinFinder::Strategy::BINARY_SEARCH);
+    run_compare_with_binary_search(finder, binedges);
+
+    TS_ASSERT_THROWS(BinFinder(&binedges, BinFinder::Strategy::LINEAR), const std::invalid_argument &);
+  }
+
+private:
+  void run_compare_with_binary_search(const BinFinder &finder, const std::vector<double> &binedges) {
+    const auto tofs = createTofs(binedges, 100000);
+    size_t num_wrong{0};
+    for (const auto &tof : tofs) {
+      if (finder.findBin(tof) != binarySearch(binedges, tof))
+        ++num_wrong;
+    }
+    TS_ASSERT_EQUALS(num_wrong, 0);
+  }
+};
+
+/**
+ * Compare the strategies for finding bins. The same logarithmic binning with ~1900 bins is used for all of them.
+ */
+class BinFinderTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BinFinderTestPerformance *createSuite() { return new BinFinderTestPerformance(); }
+  static void destroySuite(BinFinderTestPerformance *suite) { delete suite; }
+
+  BinFinderTestPerformance()
+      : m_binedges(createBinEdges(0.1, -0.0016, 2.)), m_tofs(createTofs(m_binedges, NUM_EVENTS)) {}
+
+  void test_upper_bound() {
+    std::vector<uint32_t> y(m_binedges.size() - 1, 0);
+    for (const auto &tof : m_tofs)
+      y[binarySearch(m_binedges, tof)]++;
+    TS_ASSERT_EQUALS(std::accumulate(y.cbegin(), y.cend(), size_t{0}), NUM_EVENTS);
+  }
+
+  void test_binary_search_strategy() { run_strategy(BinFinder::Strategy::BINARY_SEARCH); }
+
+  void test_logarithmic_strategy() { run_strategy(BinFinder::Strategy::LOGARITHMIC); }
+
+  void test_linear_strategy() {
+    const auto binedges = createBinEdges(1000., 10., 20000.);
+    const auto tofs = createTofs(binedges, NUM_EVENTS);
+    BinFinder finder(&binedges, BinFinder::Strategy::LINEAR);
+    std::vector<uint32_t> y(binedges.size() - 1, 0);
+    for (const auto &tof : tofs)
+      y[finder.findBin(tof)]++;
+    TS_ASSERT_EQUALS(std::accumulate(y.cbegin(), y.cend(), size_t{0}), NUM_EVENTS);
+  }
+
+private:
+  void run_strategy(const BinFinder::Strategy strategy) {
+    BinFinder finder(&m_binedges, strategy);
+    std::vector<uint32_t> y(m_binedges.size() - 1, 0);
+    for (const auto &tof : m_tofs)
+      y[finder.findBin(tof)]++;
+    TS_ASSERT_EQUALS(std::accumulate(y.cbegin(), y.cend(), size_t{0}), NUM_EVENTS);
+  }
+
+  static constexpr size_t NUM_EVENTS{20000000};
+  const std::vector<double> m_binedges;
+  const std::vector<double> m_tofs;
+};
@@ -0,0 +1,125 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/EventPrecountCache.h"
+
+#include <filesystem>
+#include <fstream>
+
+using Mantid::DataHandling::EventPrecountCache;
+
+class EventPrecountCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventPrecountCacheTest *createSuite() { return new EventPrecountCacheTest(); }
+  static void destroySuite(EventPrecountCacheTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_directory = std::filesystem::temp_directory_path() / "EventPrecountCacheTest";
+    std::filesystem::create_directories(m_directory);
+    m_nexusFile = m_directory / "FAKE_1234_event.nxs";
+    writeFile("original contents");
+  }
+
+  void tearDown() override { std::filesystem::remove_all(m_directory); }
+
+  void test_countEvents() {
+    const std::vector<uint32_t> pixelIds{5, 7, 5, 6, 5, 2, 9};
+    const auto bank = EventPrecountCache::countEvents(pixelIds, 5, 7);
+    TS_ASSERT_EQUALS(bank->minId, 5);
+    TS_ASSERT_EQUALS(bank->maxId, 7);
+    TS_ASSERT_EQUALS(bank->counts, std::vector<uint64_t>({3, 1, 1}));
+    // pixel IDs outside of the range are not counted
+    TS_ASSERT_EQUALS(bank->numberOfEvents(), 5);
+    TS_ASSERT_EQUALS(bank->count(5), 3);
+    TS_ASSERT_EQUALS(bank->count(2), 0);
+    TS_ASSERT_EQUALS(bank->count(9), 0);
+  }
+
+  void test_countEvents_throws_for_bad_range() {
+    TS_ASSERT_THROWS(EventPrecountCache::countEvents({1, 2}, 2, 1), const std::invalid_argument &);
+  }
+
+  void test_find_missing_bank() {
+    EventPrecountCache cache(m_nexusFile.string(), m_directory.string());
+    TS_ASSERT(!cache.load());
+    TS_ASSERT(!cache.find("bank1_events"));
+  }
+
+  void test_save_and_load() {
+    {
+      EventPrecountCache cache(m_nexusFile.string(), m_directory.string());
+      cache.insert("bank1_events", EventPrecountCache::countEvents({1, 1, 3}, 1, 3));
+      cache.insert("bank2_events", EventPrecountCache::countEvents({100}, 100, 100));
+      cache.save();
+      TS_ASSERT(std::filesystem::exists(cache.cacheFilename()));
+      TS_ASSERT_EQUALS(std::filesystem::path(cache.cacheFilename()).parent_path(), m_directory);
+    }
+
+    EventPrecountCache cache(m_nexusFile.string(), m_directory.string());
+    TS_ASSERT(cache.load());
+    const auto bank1 = cache.find("bank1_events");
+    TS_ASSERT(bank1);
+    TS_ASSERT_EQUALS(bank1->minId, 1);
+    TS_ASSERT_EQUALS(bank1->maxId, 3);
+    TS_ASSERT_EQUALS(bank1->counts, std::vector<uint64_t>({2, 0, 1}));
+    const auto bank2 = cache.find("bank2_events");
+    TS_ASSERT(bank2);
+    TS_ASSERT_EQUALS(bank2->count(100), 1);
+    TS_ASSERT(!cache.find("bank3_events"));
+  }
+
+  void test_cache_is_ignored_if_file_changes() {
+    {
+      EventPrecountCache cache(m_nexusFile.string(), m_directory.string());
+      cache.insert("bank1_events", EventPrecountCache::countEvents({1}, 1, 1));
+      cache.save();
+    }
+    writeFile("the file has been replaced");
+
+    EventPrecountCache cache(m_nexusFile.string(), m_directory.string());
+    TS_ASSERT(!cache.load());
+    TS_ASSERT(!cache.find("bank1_events"));
+  }
+
+  void test_cache_is_ignored_if_corrupt() {
+    std::string filename;
+    {
+      EventPrecountCache cache(m_nexusFile.string(), m_directory.string());
+      cache.insert("bank1_events", EventPrecountCache::countEvents({1, 2, 3, 4}, 1, 4));
+      cache.save();
+      filename = cache.cacheFilename();
+    }
+    std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 4);
+
+    EventPrecountCache cache(m_nexusFile.string(), m_directory.string());
+    TS_ASSERT(!cache.load());
+    TS_ASSERT(!cache.find("bank1_events"));
+  }
+
+  void test_other_files_use_other_cache_files() {
+    const auto otherFile = m_directory / "other" / m_nexusFile.filename();
+    std::filesystem::create_directories(otherFile.parent_path());
+    std::filesystem::copy_file(m_nexusFile, otherFile);
+    EventPrecountCache cache(m_nexusFile.string(), m_directory.string());
+    EventPrecountCache otherCache(otherFile.string(), m_directory.string());
+    TS_ASSERT_DIFFERS(cache.cacheFilename(), otherCache.cacheFilename());
+  }
+
+private:
+  void writeFile(const std::string &contents) {
+    std::ofstream stream(m_nexusFile, std::ios::trunc);
+    stream << contents;
+  }
+
+  std::filesystem::path m_directory;
+  std::filesystem::path m_nexusFile;
+};
@@ -8,6 +8,9 @@
 #include "MantidAPI/FileFinder.h"
 #include "MantidDataHandling/LoadBinaryStl.h"
 #include "MantidGeometry/Objects/MeshObject.h"
+#include "MantidGeometry/Objects/MeshObjectCommon.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/MersenneTwister.h"
 #include <cxxtest/TestSuite.h>
 using namespace Mantid;
 using namespace Mantid::API;
@@ -86,3 +89,58 @@ private:
 
   const ScaleUnits units = ScaleUnits::metres;
 };
+
+/** Ray tracing through a large sample environment mesh. The brute force test is the cost of testing every triangle,
+ * which is what MeshObject did before it used a bounding volume hierarchy.
+ */
+class LoadBinaryStlTestPerformance : public CxxTest::TestSuite {
+public:
+  static LoadBinaryStlTestPerformance *createSuite() { return new LoadBinaryStlTestPerformance(); }
+  static void destroySuite(LoadBinaryStlTestPerformance *suite) { delete suite; }
+
+  LoadBinaryStlTestPerformance() {
+    std::string path = FileFinder::Instance().getFullPath("SI-4200-610.stl");
+    auto loader = LoadBinaryStl(path, ScaleUnits::metres);
+    m_mesh = loader.readShape();
+
+    // rays from random points in the bounding box in random directions
+    const auto &bbox = m_mesh->getBoundingBox();
+    Kernel::MersenneTwister rng(200000);
+    for (size_t i = 0; i < NUM_RAYS; ++i) {
+      Kernel::V3D start(rng.nextValue(bbox.xMin(), bbox.xMax()), rng.nextValue(bbox.yMin(), bbox.yMax()),
+                        rng.nextValue(bbox.zMin(), bbox.zMax()));
+      Kernel::V3D direction(rng.nextValue(-1., 1.), rng.nextValue(-1., 1.), rng.nextValue(-1., 1.));
+      direction.normalize();
+      m_tracks.emplace_back(start, direction);
+    }
+  }
+
+  void test_interceptSurface() {
+    for (auto track : m_tracks)
+      m_mesh->interceptSurface(track);
+  }
+
+  void test_isValid() {
+    for (const auto &track : m_tracks)
+      m_mesh->isValid(track.startPoint());
+  }
+
+  void test_interceptSurface_brute_force() {
+    const auto &triangles = m_mesh->getTriangles();
+    const auto &vertices = m_mesh->getV3Ds();
+    Kernel::V3D intersection;
+    TrackDirection entryExit;
+    for (const auto &track : m_tracks) {
+      for (size_t i = 0; i < triangles.size(); i += 3) {
+        MeshObjectCommon::rayIntersectsTriangle(track.startPoint(), track.direction(), vertices[triangles[i]],
+                                                vertices[triangles[i + 1]], vertices[triangles[i + 2]], intersection,
+                                                entryExit);
+      }
+    }
+  }
+
+private:
+  static constexpr size_t NUM_RAYS{1000};
+  std::unique_ptr<Geometry::MeshObject> m_mesh;
+  std::vector<Track> m_tracks;
+};
@@ -7,11 +7,13 @@
 #pragma once
 
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/FileFinder.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/Workspace.h"
+#include "MantidDataHandling/EventPrecountCache.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
@@ -20,6 +22,7 @@
 #include "MantidIndexing/SpectrumNumber.h"
 #include "MantidKernel/Property.h"
 #include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidNexus/NexusFile.h"
 #include "MantidNexusGeometry/Hdf5Version.h"
 
 #include <cxxtest/TestSuite.h>
@@ -596,6 +599,93 @@ public:
     }
   }
 
+  void test_Precount_cache() {
+    const auto cacheDirectory = std::filesystem::temp_directory_path() / "LoadEventNexusTest_precount_cache";
+    std::filesystem::remove_all(cacheDirectory);
+    std::filesystem::create_directories(cacheDirectory);
+
+    const auto load = [&cacheDirectory](const std::string &outws_name) {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setRethrows(true);
+      ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+      ld.setPropertyValue("OutputWorkspace", outws_name);
+      ld.setProperty<bool>("Precount", true);
+      ld.setPropertyValue("PrecountCacheDirectory", cacheDirectory.string());
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+      return AnalysisDataService::Instance().retrieveWS<EventWorkspace>(outws_name);
+    };
+
+    // the first load counts the events and writes the cache, the second one uses it
+    const auto WS = load("cncs_precount_cache_write");
+    TS_ASSERT_EQUALS(std::distance(std::filesystem::directory_iterator(cacheDirectory),
+                                   std::filesystem::directory_iterator()),
+                     1);
+    const auto WS2 = load("cncs_precount_cache_read");
+
+    TS_ASSERT_EQUALS(WS->getNumberEvents(), 112266);
+    TS_ASSERT_EQUALS(WS2->getNumberEvents(), WS->getNumberEvents());
+    for (size_t wi = 0; wi < WS->getNumberHistograms(); wi += 1000) {
+      TS_ASSERT_EQUALS(WS2->getSpectrum(wi).getNumberEvents(), WS->getSpectrum(wi).getNumberEvents());
+    }
+
+    AnalysisDataService::Instance().remove("cncs_precount_cache_write");
+    AnalysisDataService::Instance().remove("cncs_precount_cache_read");
+    std::filesystem::remove_all(cacheDirectory);
+  }
+
+  void test_Precount_cache_with_pixel_ids_outside_the_instrument() {
+    const auto cacheDirectory = std::filesystem::temp_directory_path() / "LoadEventNexusTest_precount_cache_bad_ids";
+    std::filesystem::remove_all(cacheDirectory);
+    std::filesystem::create_directories(cacheDirectory);
+
+    // give one event of a bank a pixel ID above the largest one of CNCS, so the bank is clipped to the instrument
+    const auto filename = cacheDirectory / "CNCS_7860_event.nxs";
+    std::filesystem::copy_file(FileFinder::Instance().getFullPath("CNCS_7860_event.nxs"), filename);
+    {
+      Mantid::Nexus::File file(filename.string(), NXaccess::RDWR);
+      file.openAddress("/entry/bank1_events/event_id");
+      std::vector<uint32_t> eventIds;
+      file.getData(eventIds);
+      eventIds.front() = 100000;
+      file.putData(eventIds);
+      file.close();
+    }
+
+    const auto load = [&cacheDirectory, &filename](const std::string &outws_name) {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setRethrows(true);
+      ld.setPropertyValue("Filename", filename.string());
+      ld.setPropertyValue("OutputWorkspace", outws_name);
+      ld.setProperty<bool>("Precount", true);
+      ld.setPropertyValue("PrecountCacheDirectory", cacheDirectory.string());
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+      return AnalysisDataService::Instance().retrieveWS<EventWorkspace>(outws_name);
+    };
+
+    const auto WS = load("cncs_precount_cache_bad_ids_write");
+    const std::filesystem::path cacheFile =
+        EventPrecountCache(filename.string(), cacheDirectory.string()).cacheFilename();
+    TS_ASSERT(std::filesystem::exists(cacheFile));
+    // the second load must use the counts of every bank without rewriting the side-car file
+    const auto written = std::filesystem::last_write_time(cacheFile) - std::chrono::hours(1);
+    std::filesystem::last_write_time(cacheFile, written);
+    const auto WS2 = load("cncs_precount_cache_bad_ids_read");
+    TS_ASSERT_EQUALS(std::filesystem::last_write_time(cacheFile), written);
+
+    TS_ASSERT_EQUALS(WS->getNumberEvents(), 112265);
+    TS_ASSERT_EQUALS(WS2->getNumberEvents(), WS->getNumberEvents());
+
+    AnalysisDataService::Instance().remove("cncs_precount_cache_bad_ids_write");
+    AnalysisDataService::Instance().remove("cncs_precount_cache_bad_ids_read");
+    std::filesystem::remove_all(cacheDirectory);
+  }
+
   void test_TOF_filtered_loading() {
     std::cout << "test TOF filtering\n" << std::flush;
     const std::string wsName = "test_filtering";
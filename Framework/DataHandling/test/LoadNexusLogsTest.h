@@ -116,6 +116,31 @@ public:
     TS_ASSERT_EQUALS(dlog->size(), 172);
   }
 
+  void test_existing_logs_are_kept_if_not_overwriting() {
+    MatrixWorkspace_sptr testWS = createTestWorkspace();
+    auto existing = new TimeSeriesProperty<double>("proton_charge");
+    existing->addValue("2009-04-28T09:20:29", 42.0);
+    testWS->mutableRun().addProperty(existing);
+
+    LoadNexusLogs loader;
+    loader.initialize();
+    TS_ASSERT_THROWS_NOTHING(loader.setProperty("Workspace", testWS));
+    TS_ASSERT_THROWS_NOTHING(loader.setPropertyValue("Filename", "LOQ49886.nxs"));
+    TS_ASSERT_THROWS_NOTHING(loader.setProperty("OverwriteLogs", false));
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+    TS_ASSERT(loader.isExecuted());
+
+    const API::Run &run = testWS->run();
+    auto dlog = dynamic_cast<TimeSeriesProperty<double> *>(run.getLogData("proton_charge"));
+    TS_ASSERT(dlog);
+    TS_ASSERT_EQUALS(dlog->size(), 1);
+    TS_ASSERT_DELTA(dlog->nthValue(0), 42.0, 1e-10);
+    // the other logs are still loaded
+    auto ilog = dynamic_cast<TimeSeriesProperty<int> *>(run.getLogData("total_counts"));
+    TS_ASSERT(ilog);
+    TS_ASSERT_EQUALS(ilog->size(), 172);
+  }
+
   void test_File_With_Bad_Property() {
     LoadNexusLogs loader;
     loader.initialize();
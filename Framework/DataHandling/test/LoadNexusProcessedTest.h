@@ -437,6 +437,39 @@ public:
     doCommonEventLoadChecks(alg, 5, 2);
   }
 
+  void test_loadEventNexus_List_reads_only_the_events_of_the_listed_spectra() {
+    writeTmpEventNexus();
+
+    LoadNexusProcessed loadAll;
+    loadAll.initialize();
+    loadAll.setChild(true);
+    loadAll.setPropertyValue("Filename", m_savedTmpEventFile);
+    loadAll.setPropertyValue("OutputWorkspace", "all");
+    loadAll.execute();
+    Workspace_sptr all = loadAll.getProperty("OutputWorkspace");
+    const auto allEvents = std::dynamic_pointer_cast<EventWorkspace>(all);
+
+    LoadNexusProcessed alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setPropertyValue("Filename", m_savedTmpEventFile);
+    alg.setPropertyValue("OutputWorkspace", "some");
+    alg.setPropertyValue("SpectrumList", "2,4,6");
+    alg.execute();
+    Workspace_sptr some = alg.getProperty("OutputWorkspace");
+    const auto someEvents = std::dynamic_pointer_cast<EventWorkspace>(some);
+
+    TS_ASSERT_EQUALS(someEvents->getNumberHistograms(), 3);
+    for (size_t i = 0; i < 3; ++i) {
+      const auto &loaded = someEvents->getSpectrum(i);
+      const auto &expected = allEvents->getSpectrum(2 * i + 1);
+      TS_ASSERT_EQUALS(loaded.getEvents(), expected.getEvents());
+    }
+    TS_ASSERT_EQUALS(someEvents->getNumberEvents(), allEvents->getSpectrum(1).getNumberEvents() +
+                                                        allEvents->getSpectrum(3).getNumberEvents() +
+                                                        allEvents->getSpectrum(5).getNumberEvents());
+  }
+
   void test_load_saved_workspace_group() {
     LoadNexusProcessed alg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize());
@@ -45,4 +45,39 @@ public:
     TS_ASSERT_EQUALS(task.y_temp[0], 2); // 1000(1), 1500(3)
     TS_ASSERT_EQUALS(task.y_temp[1], 2); // 2000(2), 3000(3)
   }
+
+  void test_ProcessEventsTask_multiple_blocks() {
+    // use a number of events that isn't a multiple of the block size
+    constexpr size_t NUM_EVENTS{1000 * Mantid::DataHandling::AlignAndFocusPowderSlim::EVENT_BLOCK_SIZE + 7};
+    std::vector<uint32_t> detIDs(NUM_EVENTS);
+    std::vector<float> tofs(NUM_EVENTS);
+    for (size_t i = 0; i < NUM_EVENTS; ++i) {
+      detIDs[i] = static_cast<uint32_t>(i % 4 + 1);
+      tofs[i] = static_cast<float>(i % 3000);
+    }
+    std::vector<double> binEdges = {1000., 2000., 5000.};
+
+    std::map<detid_t, double> calibration_map;
+    for (const auto &id : std::views::iota(1, 5))
+      calibration_map[id] = id;
+
+    std::set<detid_t> mask{4}; // mask detID 4
+
+    BankCalibration bankCal(1, 4, 1., calibration_map, std::map<detid_t, double>(), mask);
+
+    // calculate the expected answer one event at a time
+    std::vector<uint32_t> expected(binEdges.size() - 1, 0);
+    for (size_t i = 0; i < NUM_EVENTS; ++i) {
+      if (detIDs[i] == 4)
+        continue;
+      const double tof = static_cast<double>(tofs[i]) * static_cast<double>(detIDs[i]);
+      if (tof >= binEdges.front() && tof < binEdges.back())
+        expected[std::distance(binEdges.cbegin(), std::upper_bound(binEdges.cbegin(), binEdges.cend(), tof)) - 1]++;
+    }
+
+    ProcessEventsTask task(&detIDs, &tofs, &bankCal, &binEdges);
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, tofs.size(), 100), task);
+
+    TS_ASSERT_EQUALS(task.y_temp, expected);
+  }
 };
@@ -957,6 +957,59 @@ public:
     AnalysisDataService::Instance().remove("testSpaceReloaded");
   }
 
+  void test_compressed_readback_with_multiple_spectra_per_chunk() {
+    // enough spectra for several chunks, the last of which is only partly filled
+    constexpr size_t numSpectra(700), numBins(300);
+    Workspace2D_sptr ws = WorkspaceCreationHelper::create2DWorkspace(numSpectra, numBins);
+    for (size_t i = 0; i < numSpectra; ++i) {
+      auto &y = ws->mutableY(i);
+      auto &e = ws->mutableE(i);
+      for (size_t j = 0; j < numBins; ++j) {
+        y[j] = static_cast<double>(i * numBins + j);
+        e[j] = 0.5 * static_cast<double>(i + j);
+      }
+    }
+    AnalysisDataService::Instance().addOrReplace("testSpace", ws);
+
+    for (const auto &[level, shuffle] : {std::make_pair("6", "1"), std::make_pair("1", "0")}) {
+      SaveNexusProcessed saveAlg;
+      saveAlg.initialize();
+      saveAlg.setPropertyValue("InputWorkspace", "testSpace");
+      FileResource fileName("SaveNexusProcessedTest_test_compressed_readback.nxs", !clearfiles);
+      saveAlg.setPropertyValue("Filename", fileName.fullPath());
+      saveAlg.setPropertyValue("CompressionLevel", level);
+      saveAlg.setPropertyValue("CompressionShuffle", shuffle);
+      TS_ASSERT_THROWS_NOTHING(saveAlg.execute());
+      TS_ASSERT(saveAlg.isExecuted());
+
+      LoadNexus loadAlg;
+      loadAlg.initialize();
+      loadAlg.setPropertyValue("Filename", fileName.fullPath());
+      loadAlg.setPropertyValue("OutputWorkspace", "testSpaceReloaded");
+      TS_ASSERT_THROWS_NOTHING(loadAlg.execute());
+      auto wsReloaded =
+          std::dynamic_pointer_cast<Workspace2D>(AnalysisDataService::Instance().retrieve("testSpaceReloaded"));
+      TS_ASSERT(wsReloaded);
+      if (!wsReloaded)
+        break;
+      TS_ASSERT_EQUALS(wsReloaded->getNumberHistograms(), numSpectra);
+      for (size_t i = 0; i < numSpectra; ++i) {
+        TS_ASSERT_EQUALS(wsReloaded->readY(i), ws->readY(i));
+        TS_ASSERT_EQUALS(wsReloaded->readE(i), ws->readE(i));
+      }
+    }
+
+    AnalysisDataService::Instance().remove("testSpace");
+    AnalysisDataService::Instance().remove("testSpaceReloaded");
+  }
+
+  void test_invalid_compression_level() {
+    SaveNexusProcessed saveAlg;
+    saveAlg.initialize();
+    TS_ASSERT_THROWS(saveAlg.setPropertyValue("CompressionLevel", "0"), const std::invalid_argument &);
+    TS_ASSERT_THROWS(saveAlg.setPropertyValue("CompressionLevel", "10"), const std::invalid_argument &);
+  }
+
   void test_nexus_spectraDetectorMap() {
     NexusTestHelper th(true);
     th.createFile("MatrixWorkspaceTest.nxs");
@@ -1165,3 +1218,37 @@ private:
 
   bool clearfiles;
 };
+
+class SaveNexusProcessedTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SaveNexusProcessedTestPerformance *createSuite() { return new SaveNexusProcessedTestPerformance(); }
+  static void destroySuite(SaveNexusProcessedTestPerformance *suite) { delete suite; }
+
+  SaveNexusProcessedTestPerformance() : m_outputFile("SaveNexusProcessedTestPerformance.nxs") {
+    m_ws = WorkspaceCreationHelper::create2DWorkspaceBinned(50000, 1000);
+    AnalysisDataService::Instance().addOrReplace("SaveNexusProcessedTestPerformance_ws", m_ws);
+  }
+
+  ~SaveNexusProcessedTestPerformance() override {
+    AnalysisDataService::Instance().remove("SaveNexusProcessedTestPerformance_ws");
+  }
+
+  void test_save_compressed_workspace2D() { save("6"); }
+
+  void test_save_fast_compressed_workspace2D() { save("1"); }
+
+private:
+  void save(const std::string &level) {
+    SaveNexusProcessed saveAlg;
+    saveAlg.initialize();
+    saveAlg.setPropertyValue("InputWorkspace", "SaveNexusProcessedTestPerformance_ws");
+    saveAlg.setPropertyValue("Filename", m_outputFile.fullPath());
+    saveAlg.setPropertyValue("CompressionLevel", level);
+    TS_ASSERT_THROWS_NOTHING(saveAlg.execute());
+  }
+
+  Workspace2D_sptr m_ws;
+  FileResource m_outputFile;
+};
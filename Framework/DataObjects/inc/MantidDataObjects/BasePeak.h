@@ -89,8 +89,9 @@ public:
   void setBinCount(double m_binCount) override;
 
   Mantid::Kernel::Matrix<double> getGoniometerMatrix() const override;
-  Mantid::Kernel::Matrix<double> getInverseGoniometerMatrix() const;
+  const Mantid::Kernel::Matrix<double> &getInverseGoniometerMatrix() const;
   void setGoniometerMatrix(const Mantid::Kernel::Matrix<double> &goniometerMatrix) override;
+  bool shareGoniometerWith(const BasePeak &other);
 
   void setPeakNumber(int m_peakNumber) override;
   int getPeakNumber() const override;
@@ -143,12 +144,17 @@ private:
   /// absorption weighted path length (aka t bar)
   double m_absorptionWeightedPathLength;
 
-  /// Orientation matrix of the goniometer angles.
-  Mantid::Kernel::Matrix<double> m_GoniometerMatrix;
-
-  /// Inverse of the goniometer rotation matrix; used to go from Q in lab frame
-  /// to Q in sample frame
-  Mantid::Kernel::Matrix<double> m_InverseGoniometerMatrix;
+  /// A goniometer rotation matrix and its inverse, which is used to go from Q in lab frame to Q in sample frame
+  struct GoniometerRotation {
+    Mantid::Kernel::Matrix<double> matrix;
+    Mantid::Kernel::Matrix<double> inverse;
+  };
+  static std::shared_ptr<const GoniometerRotation> makeGoniometerRotation(const Mantid::Kernel::Matrix<double> &matrix,
+                                                                          const std::string &caller);
+  static const std::shared_ptr<const GoniometerRotation> &identityGoniometer();
+
+  /// Orientation of the goniometer, shared with the other peaks measured at the same orientation
+  std::shared_ptr<const GoniometerRotation> m_goniometer;
 
   /// Originating run number for this peak
   int m_runNumber;
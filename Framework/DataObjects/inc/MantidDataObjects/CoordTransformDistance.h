@@ -52,10 +52,14 @@ public:
   void apply(const coord_t *inputVector, coord_t *outVector) const override;
 
   /// Return the center coordinate array
-  const std::vector<coord_t> &getCenter() { return m_center; }
+  const std::vector<coord_t> &getCenter() const { return m_center; }
 
   /// Return the dimensions used bool array
-  const std::vector<bool> &getDimensionsUsed() { return m_dimensionsUsed; }
+  const std::vector<bool> &getDimensionsUsed() const { return m_dimensionsUsed; }
+
+  /// @return true if the output is the squared distance to the centre in the used dimensions, not an ellipsoid or a
+  /// cylinder
+  bool isSphere() const { return outD == 1 && m_eigenvals.size() != 3; }
 
 protected:
   /// Coordinates at the center
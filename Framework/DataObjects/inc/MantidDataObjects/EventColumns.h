@@ -0,0 +1,80 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidKernel/cow_ptr.h"
+#include "MantidTypes/Core/DateAndTime.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+class EventList;
+class EventWorkspace;
+
+//==========================================================================================
+/** @class Mantid::DataObjects::EventColumns
+
+    Structure-of-arrays copy of the events in an EventList. Each field of the events is held in its own contiguous
+    array so operations that only touch the time-of-flight do not stream the rest of the event through the cache and
+    can be vectorised by the compiler.
+
+    The columns that are filled depend on the event type
+      - TOF: time-of-flight and pulse time
+      - WEIGHTED: time-of-flight, pulse time, weight and error squared
+      - WEIGHTED_NOTIME: time-of-flight, weight and error squared
+
+    The conversion is reversible: copyTo() writes the events back into an EventList with the original event type.
+    The columns are not sorted.
+*/
+class MANTID_DATAOBJECTS_DLL EventColumns {
+public:
+  EventColumns(const Mantid::API::EventType event_type = Mantid::API::EventType::TOF);
+  explicit EventColumns(const EventList &eventList);
+
+  void copyTo(EventList &eventList) const;
+
+  Mantid::API::EventType getEventType() const;
+  std::size_t size() const;
+  bool empty() const;
+  void reserve(const std::size_t num);
+  void clear();
+
+  const std::vector<double> &tofs() const;
+  std::vector<double> &mutableTofs();
+  const std::vector<int64_t> &pulseTimes() const;
+  const std::vector<float> &weights() const;
+  const std::vector<float> &errorSquareds() const;
+
+  void convertTof(const double factor, const double offset = 0.);
+  std::size_t maskTof(const double tofMin, const double tofMax);
+  void filterByPulseTime(const Types::Core::DateAndTime &start, const Types::Core::DateAndTime &stop,
+                         EventColumns &output) const;
+  void generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E, bool skipError = false) const;
+  void generateHistogram(const double step, const MantidVec &X, MantidVec &Y, MantidVec &E,
+                         bool skipError = false) const;
+
+private:
+  template <typename FindBin>
+  void histogramHelper(const MantidVec &X, MantidVec &Y, MantidVec &E, bool skipError, FindBin &&findBin) const;
+
+  Mantid::API::EventType m_eventType;
+  std::vector<double> m_tofs;
+  /// total nanoseconds of the pulse time
+  std::vector<int64_t> m_pulseTimes;
+  std::vector<float> m_weights;
+  std::vector<float> m_errorSquareds;
+};
+
+MANTID_DATAOBJECTS_DLL std::vector<EventColumns> toEventColumns(const EventWorkspace &workspace);
+MANTID_DATAOBJECTS_DLL void fromEventColumns(const std::vector<EventColumns> &columns, EventWorkspace &workspace);
+
+} // namespace DataObjects
+} // namespace Mantid
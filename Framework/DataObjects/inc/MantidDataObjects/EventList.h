@@ -130,6 +130,34 @@ public:
       this->setSortOrder(UNSORTED);
   }
 
+  // --------------------------------------------------------------------------
+  /** Append a range of events to the histogram, without clearing the cache, to
+   * make it faster.
+   * NOTE: Only call this on a un-weighted event list!
+   *
+   * @param first :: the first TofEvent to add at the end of the list.
+   * @param last :: one past the last TofEvent to add.
+   * */
+  inline void addEventsQuickly(std::vector<Types::Event::TofEvent>::const_iterator first,
+                               std::vector<Types::Event::TofEvent>::const_iterator last) {
+    this->events->insert(this->events->end(), first, last);
+    if (this->order != UNSORTED)
+      this->setSortOrder(UNSORTED);
+  }
+
+  // --------------------------------------------------------------------------
+  /** Append a range of events to the histogram, without clearing the cache, to
+   * make it faster.
+   * @param first :: the first WeightedEvent to add at the end of the list.
+   * @param last :: one past the last WeightedEvent to add.
+   * */
+  inline void addEventsQuickly(std::vector<WeightedEvent>::const_iterator first,
+                               std::vector<WeightedEvent>::const_iterator last) {
+    this->weightedEvents->insert(this->weightedEvents->end(), first, last);
+    if (this->order != UNSORTED)
+      this->setSortOrder(UNSORTED);
+  }
+
   Mantid::API::EventType getEventType() const override;
 
   void switchTo(Mantid::API::EventType newType) override;
@@ -259,6 +287,21 @@ public:
   /// Return the list of event weight error values
   void getWeightErrors(std::vector<double> &weightErrors) const override;
 
+  /** Describes where one field of the stored events is found, for reading it in place without a copy. The view is
+   * invalidated by anything that changes the list of events.
+   */
+  template <typename T> struct FieldView {
+    /// The value of the first event, or nullptr if there are no events
+    const T *data;
+    /// The number of events
+    std::size_t size;
+    /// The number of bytes from the value of one event to the next
+    std::ptrdiff_t stride;
+  };
+  FieldView<double> getTofsView() const;
+  FieldView<float> getWeightsView() const;
+  FieldView<float> getErrorSquaredView() const;
+
   std::vector<Types::Core::DateAndTime> getPulseTimes() const override;
 
   /// Get the Pulse-time + TOF for each event in this EventList
@@ -19,6 +19,7 @@ class Progress;
 }
 
 namespace DataObjects {
+class EventWorkspaceFileBacking;
 class EventWorkspaceMRU;
 
 /** \class EventWorkspace
@@ -145,6 +146,15 @@ public:
 
   void getIntegratedSpectra(std::vector<double> &out, const double minX, const double maxX,
                             const bool entireRange) const override;
+
+  // Keep the events in a scratch file, holding only recently used event lists in memory
+  void setFileBacked(const std::string &directory, const size_t memoryBudget);
+  /// @return true if the events are kept in a scratch file
+  bool isFileBacked() const { return static_cast<bool>(m_fileBacking); }
+  void pinSpectrum(const size_t index) const;
+  void unpinSpectrum(const size_t index) const;
+  /// @return the scratch file holding the events, or nullptr if the workspace is not file backed
+  const EventWorkspaceFileBacking *getFileBacking() const { return m_fileBacking.get(); }
   EventWorkspace &operator=(const EventWorkspace &other) = delete;
 
 protected:
@@ -164,6 +174,9 @@ private:
 
   /// Container for the MRU lists of the event lists contained.
   mutable std::unique_ptr<EventWorkspaceMRU> mru;
+
+  /// Scratch file holding the events when the workspace is file backed
+  std::unique_ptr<EventWorkspaceFileBacking> m_fileBacking;
 };
 
 /// shared pointer to the EventWorkspace class
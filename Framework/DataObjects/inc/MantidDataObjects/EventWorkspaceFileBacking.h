@@ -0,0 +1,117 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/DllConfig.h"
+
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+class EventList;
+
+/** EventWorkspaceFileBacking : Keeps the events of an EventWorkspace in a scratch file and only holds the event lists
+ * that were used recently in memory.
+ *
+ * Each event list has a slot in the file which is reused while the list does not grow. An event list is read back from
+ * the file when it is accessed and written out again once the events held in memory exceed the memory budget. Each
+ * thread keeps track of the lists it used, and a list is only written out once it is neither among the last
+ * MIN_RESIDENT lists used by any thread that accessed it nor pinned, so the lists an algorithm is working on stay in
+ * memory. Lists are only written out during a call to access() or unpin(), and only the events are paged: the
+ * histogram, sort order and detector IDs of a list always stay in memory.
+ */
+class MANTID_DATAOBJECTS_DLL EventWorkspaceFileBacking {
+public:
+  /// Number of lists each thread keeps in memory regardless of the memory budget
+  static constexpr size_t MIN_RESIDENT{8};
+
+  EventWorkspaceFileBacking(std::string filename, const size_t memoryBudget, const size_t numberOfLists);
+  EventWorkspaceFileBacking(const EventWorkspaceFileBacking &) = delete;
+  EventWorkspaceFileBacking &operator=(const EventWorkspaceFileBacking &) = delete;
+  ~EventWorkspaceFileBacking();
+
+  void access(const size_t index, EventList &list);
+  void pin(const size_t index, EventList &list);
+  void unpin(const size_t index);
+  void pageOut(const size_t index, EventList &list);
+  void pageOutAll(const std::vector<std::unique_ptr<EventList>> &lists);
+
+  size_t getNumberEvents(const size_t index, const EventList &list) const;
+  bool isInMemory(const size_t index) const;
+  bool isPinned(const size_t index) const;
+
+  /// @return the path of the scratch file
+  const std::string &filename() const { return m_filename; }
+  /// @return the number of bytes of events that may be held in memory
+  size_t memoryBudget() const { return m_memoryBudget; }
+  size_t getMemoryUsed() const;
+  size_t getFileSize() const;
+
+private:
+  /// Where the events of one list are kept
+  struct Slot {
+    /// Position of the events in the file
+    uint64_t position{0};
+    /// Number of bytes reserved in the file
+    uint64_t capacity{0};
+    /// Number of events written to the file
+    size_t numberOfEvents{0};
+    /// Type of the events written to the file
+    API::EventType eventType{API::TOF};
+    /// True while the events are held in memory
+    bool inMemory{true};
+    /// Bytes of events counted against the budget while in memory
+    size_t memory{0};
+    /// The list, which is only known once it has been accessed or paged out
+    EventList *list{nullptr};
+    /// Each thread that used the list, with the position of the slot in its recently used list
+    std::vector<std::pair<std::thread::id, std::list<size_t>::iterator>> users;
+    /// Number of calls to pin() not yet matched by a call to unpin()
+    size_t pins{0};
+
+    /// @return true while a thread or a pin may hold a reference to the events
+    bool isHeld() const { return !users.empty() || pins > 0; }
+  };
+
+  void pageOutSlot(const size_t index, EventList &list);
+  void pageInSlot(Slot &slot, EventList &list);
+  void touch(const size_t index);
+  void release(const size_t index, const std::thread::id thread);
+  void forget(const size_t index);
+  void remeasure(Slot &slot);
+
+  /// Path of the scratch file
+  const std::string m_filename;
+  /// Bytes of events that may be held in memory
+  const size_t m_memoryBudget;
+  /// One slot per event list
+  std::vector<Slot> m_slots;
+  /// The lists used by each thread, most recent first
+  std::unordered_map<std::thread::id, std::list<size_t>> m_recentlyUsed;
+  /// Bytes of events held in memory by the lists that are used or pinned
+  size_t m_memoryUsed{0};
+  /// Length of the scratch file
+  uint64_t m_fileSize{0};
+  /// The scratch file
+  std::fstream m_file;
+  /// Protects the slots and the file
+  mutable std::mutex m_mutex;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -26,7 +26,7 @@ public:
   FakeMD(const std::vector<double> &uniformParams, const std::vector<double> &peakParams,
          const std::vector<double> &ellipsoidParams, const int randomSeed, const bool randomizeSignal);
 
-  void fill(const API::IMDEventWorkspace_sptr &workspace);
+  void fill(const API::IMDEventWorkspace_sptr &workspace, const bool splitBoxes = true);
 
 private:
   void setupDetectorCache(const API::IMDEventWorkspace &workspace);
@@ -39,6 +39,7 @@ private:
   void addFakeRandomData(const std::vector<double> &params, typename MDEventWorkspace<MDE, nd>::sptr ws);
   template <typename MDE, size_t nd>
   void addFakeRegularData(const std::vector<double> &params, typename MDEventWorkspace<MDE, nd>::sptr ws);
+  template <typename MDE, size_t nd> void splitAllIfNeeded(typename MDEventWorkspace<MDE, nd>::sptr ws);
 
   detid_t pickDetectorID();
 
@@ -48,6 +49,7 @@ private:
   std::vector<double> m_ellipsoidParams;
   const int m_randomSeed;
   const bool m_randomizeSignal;
+  bool m_splitBoxes;
   mutable std::vector<detid_t> m_detIDs;
   std::mt19937 m_randGen;
   Kernel::uniform_int_distribution<size_t> m_uniformDist;
@@ -17,6 +17,7 @@
 
 namespace Mantid {
 namespace DataObjects {
+class CoordTransformDistance;
 
 #ifndef __INTEL_COMPILER // As of July 13, the packing has no effect for the
                          // Intel compiler and produces a warning
@@ -211,6 +212,7 @@ private:
   void initMDBox(const size_t nBoxEvents);
   /// member to avoid reallocation
   std::vector<coord_t> m_tableData;
+  const CoordTransformDistance *columnarSphere(const Mantid::API::CoordTransform &radiusTransform) const;
 
 public:
   /// Typedef for a shared pointer to a MDBox
@@ -4,9 +4,11 @@
 //   NScD Oak Ridge National Laboratory, European Spallation Source,
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/CoordTransformDistance.h"
 #include "MantidDataObjects/MDBox.h"
 #include "MantidDataObjects/MDBoxSaveable.h"
 #include "MantidDataObjects/MDEvent.h"
+#include "MantidDataObjects/MDEventColumns.h"
 #include "MantidDataObjects/MDGridBox.h"
 #include "MantidDataObjects/MDLeanEvent.h"
 #include "MantidKernel/DiskBuffer.h"
@@ -546,6 +548,18 @@ TMDE(void MDBox)::generalBin(MDBin<MDE, nd> &bin, Mantid::Geometry::MDImplicitFu
   }
 }
 
+/** Check whether the events can be integrated with the columnar kernels
+ * @param radiusTransform :: the transform to the distance (squared) from the center of a sphere
+ * @return the transform as a spherical CoordTransformDistance if the box controller asks for columnar events and the
+ * transform is one, otherwise nullptr
+ */
+TMDE(const CoordTransformDistance *MDBox)::columnarSphere(const Mantid::API::CoordTransform &radiusTransform) const {
+  if (!this->m_BoxController || !this->m_BoxController->useColumnarEvents() || radiusTransform.getInD() != nd)
+    return nullptr;
+  const auto *sphere = dynamic_cast<const CoordTransformDistance *>(&radiusTransform);
+  return sphere && sphere->isSphere() ? sphere : nullptr;
+}
+
 /** Integrate the signal within a sphere; for example, to perform single-crystal
  * peak integration.
  * The CoordTransform object could be used for more complex shapes, e.g.
@@ -566,7 +580,21 @@ TMDE(void MDBox)::integrateSphere(Mantid::API::CoordTransform &radiusTransform,
                                   const bool useOnePercentBackgroundCorrection) const {
   // If the box is cached to disk, you need to retrieve it
   const std::vector<MDE> &events = this->getConstEvents();
-  if (innerRadiusSquared == 0.0) {
+  const auto *sphere = columnarSphere(radiusTransform);
+  if (innerRadiusSquared == 0.0 && sphere) {
+    auto &columns = MDEventColumns<nd>::threadLocal();
+    for (size_t next = 0; next < events.size();) {
+      next = columns.gather(events, next);
+      columns.distanceSquared(sphere->getCenter().data(), sphere->getDimensionsUsed());
+      const coord_t *distanceSquared = columns.results(0);
+      for (size_t i = 0; i < columns.size(); ++i) {
+        if (distanceSquared[i] < radiusSquared) {
+          integratedSignal += columns.signals()[i];
+          errorSquared += columns.errorsSquared()[i];
+        }
+      }
+    }
+  } else if (innerRadiusSquared == 0.0) {
     // For each MDLeanEvent
     for (const auto &it : events) {
       coord_t out[nd];
@@ -676,15 +704,32 @@ TMDE(void MDBox)::centroidSphere(Mantid::API::CoordTransform &radiusTransform, c
   // If the box is cached to disk, you need to retrieve it
   const std::vector<MDE> &events = this->getConstEvents();
 
-  // For each MDLeanEvent
-  for (const auto &evnt : events) {
-    coord_t out[nd];
-    radiusTransform.apply(evnt.getCenter(), out);
-    if (out[0] < radiusSquared) {
-      coord_t eventSignal = static_cast<coord_t>(evnt.getSignal());
-      signal += eventSignal;
-      for (size_t d = 0; d < nd; d++)
-        centroid[d] += evnt.getCenter(d) * eventSignal;
+  if (const auto *sphere = columnarSphere(radiusTransform)) {
+    auto &columns = MDEventColumns<nd>::threadLocal();
+    for (size_t next = 0; next < events.size();) {
+      next = columns.gather(events, next);
+      columns.distanceSquared(sphere->getCenter().data(), sphere->getDimensionsUsed());
+      const coord_t *distanceSquared = columns.results(0);
+      for (size_t i = 0; i < columns.size(); ++i) {
+        if (distanceSquared[i] < radiusSquared) {
+          const auto eventSignal = static_cast<coord_t>(columns.signals()[i]);
+          signal += eventSignal;
+          for (size_t d = 0; d < nd; d++)
+            centroid[d] += columns.coordinates(d)[i] * eventSignal;
+        }
+      }
+    }
+  } else {
+    // For each MDLeanEvent
+    for (const auto &evnt : events) {
+      coord_t out[nd];
+      radiusTransform.apply(evnt.getCenter(), out);
+      if (out[0] < radiusSquared) {
+        coord_t eventSignal = static_cast<coord_t>(evnt.getSignal());
+        signal += eventSignal;
+        for (size_t d = 0; d < nd; d++)
+          centroid[d] += evnt.getCenter(d) * eventSignal;
+      }
     }
   }
   // it is constant access, so no saving or fiddling with the buffer is needed.
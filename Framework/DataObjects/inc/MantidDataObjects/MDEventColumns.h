@@ -0,0 +1,216 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/CoordTransform.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidGeometry/MDGeometry/MDTypes.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+//==========================================================================================
+/** @class Mantid::DataObjects::MDColumnTransform
+
+    The coefficients of a linear CoordTransform, copied out of it so they can be applied to whole columns of
+    coordinates by MDEventColumns. An axis aligned transform keeps its origin and scaling, any other transform must
+    have an affine matrix.
+*/
+class MANTID_DATAOBJECTS_DLL MDColumnTransform {
+public:
+  explicit MDColumnTransform(const API::CoordTransform &transform);
+
+  /// @return the number of input dimensions
+  size_t getInD() const { return m_inD; }
+  /// @return the number of output dimensions
+  size_t getOutD() const { return m_outD; }
+  /// @return true if each output dimension is a shifted and scaled input dimension
+  bool isAligned() const { return m_aligned; }
+  /// @return for each output dimension of an aligned transform, the input dimension it is taken from
+  const std::vector<size_t> &getDimensionToBinFrom() const { return m_dimensionToBinFrom; }
+  /// @return the origin of each output dimension of an aligned transform
+  const std::vector<coord_t> &getOrigin() const { return m_origin; }
+  /// @return the scaling of each output dimension of an aligned transform
+  const std::vector<coord_t> &getScaling() const { return m_scaling; }
+  /// @return the row of the affine matrix for an output dimension, inD coefficients then the translation
+  const coord_t *getRow(const size_t out) const { return m_matrix.data() + out * (m_inD + 1); }
+
+private:
+  size_t m_inD;
+  size_t m_outD;
+  bool m_aligned;
+  std::vector<size_t> m_dimensionToBinFrom;
+  std::vector<coord_t> m_origin;
+  std::vector<coord_t> m_scaling;
+  /// outD rows of inD + 1 coefficients
+  std::vector<coord_t> m_matrix;
+};
+
+//==========================================================================================
+/** @class Mantid::DataObjects::MDEventColumns
+
+    A block of MD events copied into structure-of-arrays form: one array for each coordinate, one for the signals
+    and one for the squared errors. Transforming, selecting and binning the block then run as loops over contiguous
+    arrays which the compiler vectorises, rather than as one virtual CoordTransform::apply() call per event.
+
+    The kernels perform the same floating point operations in the same order as the per event code they replace,
+    and the accumulation into the output is done in event order, so the results are identical.
+
+    A block is large enough to be reused between calls: use threadLocal() rather than creating one per box.
+*/
+template <size_t nd> class MDEventColumns {
+public:
+  /// The number of events held by a block
+  static constexpr size_t BLOCK_SIZE{512};
+
+  /// @return the block owned by the calling thread
+  static MDEventColumns &threadLocal() {
+    static thread_local MDEventColumns columns;
+    return columns;
+  }
+
+  /**
+   * Copy events into the block
+   * @param events :: the events of a box
+   * @param first :: index of the first event to copy
+   * @return the index after the last event copied
+   */
+  template <typename MDE> size_t gather(const std::vector<MDE> &events, const size_t first) {
+    m_size = std::min(BLOCK_SIZE, events.size() - first);
+    for (size_t i = 0; i < m_size; ++i) {
+      const MDE &event = events[first + i];
+      for (size_t d = 0; d < nd; ++d)
+        m_coordinates[d][i] = event.getCenter(d);
+      m_signals[i] = static_cast<signal_t>(event.getSignal());
+      m_errorsSquared[i] = static_cast<signal_t>(event.getErrorSquared());
+    }
+    return first + m_size;
+  }
+
+  /// @return the number of events in the block
+  size_t size() const { return m_size; }
+  /// @return the coordinates of the events in one dimension
+  const coord_t *coordinates(const size_t d) const { return m_coordinates[d]; }
+  /// @return the signals of the events
+  const signal_t *signals() const { return m_signals; }
+  /// @return the squared errors of the events
+  const signal_t *errorsSquared() const { return m_errorsSquared; }
+  /// @return the output of the last transform() or distanceSquared() in one dimension
+  const coord_t *results(const size_t d) const { return m_results[d]; }
+
+  /**
+   * Transform the coordinates of the events, as CoordTransform::apply() would, into results()
+   * @param transform :: a transform from nd dimensions to at most nd dimensions
+   */
+  void transform(const MDColumnTransform &transform) {
+    if (transform.getInD() != nd || transform.getOutD() > nd)
+      throw std::invalid_argument("MDEventColumns: the transform does not match the number of dimensions");
+    m_outD = transform.getOutD();
+    const size_t n = m_size;
+    for (size_t out = 0; out < m_outD; ++out) {
+      coord_t *result = m_results[out];
+      if (transform.isAligned()) {
+        const coord_t *x = m_coordinates[transform.getDimensionToBinFrom()[out]];
+        const coord_t origin = transform.getOrigin()[out];
+        const coord_t scaling = transform.getScaling()[out];
+        for (size_t i = 0; i < n; ++i)
+          result[i] = (x[i] - origin) * scaling;
+      } else {
+        const coord_t *row = transform.getRow(out);
+        std::fill_n(result, n, coord_t(0));
+        for (size_t in = 0; in < nd; ++in) {
+          const coord_t *x = m_coordinates[in];
+          const coord_t coefficient = row[in];
+          for (size_t i = 0; i < n; ++i)
+            result[i] += coefficient * x[i];
+        }
+        const coord_t translation = row[nd];
+        for (size_t i = 0; i < n; ++i)
+          result[i] += translation;
+      }
+    }
+  }
+
+  /**
+   * Calculate the squared distance of the events from a point into results(0), as the spherical
+   * CoordTransformDistance does
+   * @param centre :: the point, sized nd
+   * @param dimensionsUsed :: the dimensions included in the distance, sized nd
+   */
+  void distanceSquared(const coord_t *centre, const std::vector<bool> &dimensionsUsed) {
+    m_outD = 1;
+    const size_t n = m_size;
+    coord_t *result = m_results[0];
+    std::fill_n(result, n, coord_t(0));
+    for (size_t d = 0; d < nd; ++d) {
+      if (!dimensionsUsed[d])
+        continue;
+      const coord_t *x = m_coordinates[d];
+      const coord_t c = centre[d];
+      for (size_t i = 0; i < n; ++i) {
+        const coord_t dist = x[i] - c;
+        result[i] += dist * dist;
+      }
+    }
+  }
+
+  /**
+   * Add the events to a dense histogram using the output of the last transform(), which is in units of bins.
+   * Events outside [chunkMin, chunkMax) in any dimension are skipped.
+   * @param chunkMin :: the first bin of the chunk in each output dimension
+   * @param chunkMax :: the bin after the last of the chunk in each output dimension
+   * @param indexMultiplier :: the stride of each output dimension in the histogram
+   * @param signals :: the summed signals of the histogram
+   * @param errorsSquared :: the summed squared errors of the histogram
+   * @param numEvents :: the number of events in each bin of the histogram
+   */
+  void bin(const size_t *chunkMin, const size_t *chunkMax, const size_t *indexMultiplier, signal_t *signals,
+           signal_t *errorsSquared, signal_t *numEvents) {
+    const size_t n = m_size;
+    std::fill_n(m_inside, n, true);
+    std::fill_n(m_linearIndices, n, size_t(0));
+    for (size_t d = 0; d < m_outD; ++d) {
+      const coord_t *x = m_results[d];
+      // the bins are whole numbers so comparing with them matches truncating the coordinate first
+      const auto low = static_cast<coord_t>(chunkMin[d]);
+      const auto high = static_cast<coord_t>(chunkMax[d]);
+      const size_t multiplier = indexMultiplier[d];
+      for (size_t i = 0; i < n; ++i) {
+        const bool inside = x[i] >= 0 && x[i] >= low && x[i] < high;
+        m_inside[i] = m_inside[i] && inside;
+        m_linearIndices[i] += multiplier * static_cast<size_t>(inside ? x[i] : coord_t(0));
+      }
+    }
+    for (size_t i = 0; i < n; ++i) {
+      if (!m_inside[i])
+        continue;
+      const size_t index = m_linearIndices[i];
+      signals[index] += m_signals[i];
+      errorsSquared[index] += m_errorsSquared[i];
+      numEvents[index] += 1.0;
+    }
+  }
+
+private:
+  MDEventColumns() = default;
+
+  size_t m_size{0};
+  size_t m_outD{0};
+  alignas(64) coord_t m_coordinates[nd][BLOCK_SIZE];
+  alignas(64) coord_t m_results[nd][BLOCK_SIZE];
+  alignas(64) signal_t m_signals[BLOCK_SIZE];
+  alignas(64) signal_t m_errorsSquared[BLOCK_SIZE];
+  alignas(64) size_t m_linearIndices[BLOCK_SIZE];
+  bool m_inside[BLOCK_SIZE];
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -159,6 +159,7 @@ public:
    * Used in file loading */
   void setBox(API::IMDNode *box) override {
     data = std::unique_ptr<MDBoxBase<MDE, nd>>(dynamic_cast<MDBoxBase<MDE, nd> *>(box));
+    this->incrementModificationCount();
   }
 
   /// Apply masking
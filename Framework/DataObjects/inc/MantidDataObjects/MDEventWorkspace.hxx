@@ -190,6 +190,7 @@ TMDE(void MDEventWorkspace)::setMinRecursionDepth(size_t minDepth) {
       }
     }
   }
+  this->incrementModificationCount();
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -563,6 +564,7 @@ TMDE(void MDEventWorkspace)::splitBox() {
 
     data = std::move(tempGridBox);
   }
+  this->incrementModificationCount();
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -572,7 +574,10 @@ TMDE(void MDEventWorkspace)::splitBox() {
  * @param ts :: optional ThreadScheduler * that will be used to parallelize
  *        recursive splitting. Set to NULL to do it serially.
  */
-TMDE(void MDEventWorkspace)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) { data->splitAllIfNeeded(ts); }
+TMDE(void MDEventWorkspace)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
+  data->splitAllIfNeeded(ts);
+  this->incrementModificationCount();
+}
 
 //-----------------------------------------------------------------------------------------------
 /** Goes through the MDBoxes that were tracked by the BoxController
@@ -610,6 +615,7 @@ TMDE(void MDEventWorkspace)::refreshCache() {
   // Function is overloaded and recursive; will check all sub-boxes
   data->refreshCache();
   // TODO ThreadPool
+  this->incrementModificationCount();
 }
 
 //----------------------------------------------------------------------------------------------
@@ -794,6 +800,7 @@ TMDE(void MDEventWorkspace)::setMDMasking(std::unique_ptr<Mantid::Geometry::MDIm
       box->mask();
     }
   }
+  this->incrementModificationCount();
 }
 
 /**
@@ -806,6 +813,7 @@ TMDE(void MDEventWorkspace)::clearMDMasking() {
   for (const auto box : allBoxes) {
     box->unmask();
   }
+  this->incrementModificationCount();
 }
 
 /**
@@ -80,6 +80,27 @@ template <> inline uint16_t compact<1, uint16_t, uint64_t>(uint64_t x) {
   return (uint16_t)x;
 }
 
+template <> inline uint64_t pad<1, uint32_t, uint64_t>(uint32_t v) {
+  uint64_t x(v);
+  x &= 0xffffffff;
+  x = (x | x << 16) & 0xffff0000ffff;
+  x = (x | x << 8) & 0xff00ff00ff00ff;
+  x = (x | x << 4) & 0xf0f0f0f0f0f0f0f;
+  x = (x | x << 2) & 0x3333333333333333;
+  x = (x | x << 1) & 0x5555555555555555;
+  return x;
+}
+
+template <> inline uint32_t compact<1, uint32_t, uint64_t>(uint64_t x) {
+  x &= 0x5555555555555555;
+  x = (x | x >> 1) & 0x3333333333333333;
+  x = (x | x >> 2) & 0xf0f0f0f0f0f0f0f;
+  x = (x | x >> 4) & 0xff00ff00ff00ff;
+  x = (x | x >> 8) & 0xffff0000ffff;
+  x = (x | x >> 16) & 0xffffffff;
+  return (uint32_t)x;
+}
+
 template <> inline uint32_t pad<2, uint8_t, uint32_t>(uint8_t v) {
   uint32_t x(v);
   x &= 0xff;
@@ -166,6 +166,8 @@ private:
   void initColumns();
   /// Adds a new PeakColumn of the given type
   void addPeakColumn(const std::string &name);
+  /// Shares the goniometer rotation of the last peak with the one before, if they are the same
+  void shareGoniometerWithPrevious();
 
   // ====================================== ITableWorkspace Methods
   // ==================================
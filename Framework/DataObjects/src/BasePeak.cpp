@@ -25,13 +25,32 @@ using namespace Mantid::Geometry;
 
 namespace Mantid::DataObjects {
 
+namespace {
+/// @return true if the two matrices are exactly the same
+bool isSameMatrix(const Matrix<double> &a, const Matrix<double> &b) {
+  if (a.numRows() != b.numRows() || a.numCols() != b.numCols())
+    return false;
+  for (size_t i = 0; i < a.numRows(); ++i) {
+    if (!std::equal(a[i], a[i] + a.numCols(), b[i]))
+      return false;
+  }
+  return true;
+}
+
+/// The shape of peaks which have not been given one, shared by all of them
+const PeakShape_const_sptr &noShape() {
+  static const PeakShape_const_sptr shape = std::make_shared<NoShape>();
+  return shape;
+}
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Default constructor */
 BasePeak::BasePeak()
     : m_convention(Kernel::ConfigService::Instance().getString("Q.convention")), m_samplePos(V3D(0, 0, 0)), m_H(0),
       m_K(0), m_L(0), m_intensity(0), m_sigmaIntensity(0), m_binCount(0), m_absorptionWeightedPathLength(0),
-      m_GoniometerMatrix(3, 3, true), m_InverseGoniometerMatrix(3, 3, true), m_runNumber(0), m_monitorCount(0),
-      m_peakNumber(0), m_intHKL(V3D(0, 0, 0)), m_intMNP(V3D(0, 0, 0)), m_peakShape(std::make_shared<NoShape>()) {}
+      m_goniometer(identityGoniometer()), m_runNumber(0), m_monitorCount(0), m_peakNumber(0), m_intHKL(V3D(0, 0, 0)),
+      m_intMNP(V3D(0, 0, 0)), m_peakShape(noShape()) {}
 
 //----------------------------------------------------------------------------------------------
 /** Constructor including goniometer
@@ -40,20 +59,17 @@ BasePeak::BasePeak()
  */
 BasePeak::BasePeak(const Mantid::Kernel::Matrix<double> &goniometer)
     : m_convention(Kernel::ConfigService::Instance().getString("Q.convention")), m_H(0), m_K(0), m_L(0), m_intensity(0),
-      m_sigmaIntensity(0), m_binCount(0), m_absorptionWeightedPathLength(0), m_GoniometerMatrix(goniometer),
-      m_InverseGoniometerMatrix(goniometer), m_runNumber(0), m_monitorCount(0), m_peakNumber(0), m_intHKL(V3D(0, 0, 0)),
-      m_intMNP(V3D(0, 0, 0)), m_peakShape(std::make_shared<NoShape>()) {
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
-    throw std::invalid_argument("BasePeak::ctor(): Goniometer matrix must non-singular.");
-}
+      m_sigmaIntensity(0), m_binCount(0), m_absorptionWeightedPathLength(0),
+      m_goniometer(makeGoniometerRotation(goniometer, "BasePeak::ctor()")), m_runNumber(0), m_monitorCount(0),
+      m_peakNumber(0), m_intHKL(V3D(0, 0, 0)), m_intMNP(V3D(0, 0, 0)), m_peakShape(noShape()) {}
 
 BasePeak::BasePeak(const BasePeak &other)
     : m_convention(other.m_convention), m_samplePos(other.m_samplePos), m_H(other.m_H), m_K(other.m_K), m_L(other.m_L),
       m_intensity(other.m_intensity), m_sigmaIntensity(other.m_sigmaIntensity), m_binCount(other.m_binCount),
       m_absorptionWeightedPathLength(other.m_absorptionWeightedPathLength),
-      m_GoniometerMatrix(other.m_GoniometerMatrix), m_InverseGoniometerMatrix(other.m_InverseGoniometerMatrix),
-      m_runNumber(other.m_runNumber), m_monitorCount(other.m_monitorCount), m_peakNumber(other.m_peakNumber),
-      m_intHKL(other.m_intHKL), m_intMNP(other.m_intMNP), m_peakShape(other.m_peakShape->clone()) {}
+      m_goniometer(other.m_goniometer), m_runNumber(other.m_runNumber), m_monitorCount(other.m_monitorCount),
+      m_peakNumber(other.m_peakNumber), m_intHKL(other.m_intHKL), m_intMNP(other.m_intMNP),
+      m_peakShape(other.m_peakShape) {}
 
 //----------------------------------------------------------------------------------------------
 /** Constructor making a LeanPeak from IPeak interface
@@ -65,12 +81,9 @@ BasePeak::BasePeak(const Geometry::IPeak &ipeak)
       m_K(ipeak.getK()), m_L(ipeak.getL()), m_intensity(ipeak.getIntensity()),
       m_sigmaIntensity(ipeak.getSigmaIntensity()), m_binCount(ipeak.getBinCount()),
       m_absorptionWeightedPathLength(ipeak.getAbsorptionWeightedPathLength()),
-      m_GoniometerMatrix(ipeak.getGoniometerMatrix()), m_InverseGoniometerMatrix(ipeak.getGoniometerMatrix()),
+      m_goniometer(makeGoniometerRotation(ipeak.getGoniometerMatrix(), "Peak::ctor()")),
       m_runNumber(ipeak.getRunNumber()), m_monitorCount(ipeak.getMonitorCount()), m_peakNumber(ipeak.getPeakNumber()),
-      m_intHKL(ipeak.getIntHKL()), m_intMNP(ipeak.getIntMNP()), m_peakShape(std::make_shared<NoShape>()) {
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
-    throw std::invalid_argument("Peak::ctor(): Goniometer matrix must non-singular.");
-}
+      m_intHKL(ipeak.getIntHKL()), m_intMNP(ipeak.getIntMNP()), m_peakShape(noShape()) {}
 
 //----------------------------------------------------------------------------------------------
 /** Return the run number this peak was measured at. */
@@ -206,27 +219,65 @@ void BasePeak::setSigmaIntensity(double m_sigmaIntensity) { this->m_sigmaIntensi
 
 // -------------------------------------------------------------------------------------
 /** Get the goniometer rotation matrix at which this peak was measured. */
-Mantid::Kernel::Matrix<double> BasePeak::getGoniometerMatrix() const { return this->m_GoniometerMatrix; }
+Mantid::Kernel::Matrix<double> BasePeak::getGoniometerMatrix() const { return m_goniometer->matrix; }
 
 // -------------------------------------------------------------------------------------
-/** Get the goniometer rotation matrix at which this peak was measured. */
-Mantid::Kernel::Matrix<double> BasePeak::getInverseGoniometerMatrix() const { return this->m_InverseGoniometerMatrix; }
+/** Get the inverse of the goniometer rotation matrix at which this peak was measured. */
+const Mantid::Kernel::Matrix<double> &BasePeak::getInverseGoniometerMatrix() const { return m_goniometer->inverse; }
 
 /** Set the goniometer rotation matrix at which this peak was measured.
  * @param goniometerMatrix :: 3x3 matrix that represents the rotation matrix of
  * the goniometer
  * @throw std::invalid_argument if matrix is not 3x3*/
 void BasePeak::setGoniometerMatrix(const Mantid::Kernel::Matrix<double> &goniometerMatrix) {
+  if (isSameMatrix(goniometerMatrix, m_goniometer->matrix))
+    return;
   if ((goniometerMatrix.numCols() != 3) || (goniometerMatrix.numRows() != 3))
     throw std::invalid_argument("BasePeak::setGoniometerMatrix(): Goniometer matrix must be 3x3.");
-  this->m_GoniometerMatrix = goniometerMatrix;
-  // Calc the inverse rotation matrix
-  m_InverseGoniometerMatrix = m_GoniometerMatrix;
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
+  auto rotation = std::make_shared<GoniometerRotation>(GoniometerRotation{goniometerMatrix, goniometerMatrix});
+  const double determinant = rotation->inverse.Invert();
+  // The matrix is kept even if it is singular
+  m_goniometer = std::move(rotation);
+  if (fabs(determinant) < 1e-8)
     throw std::invalid_argument("BasePeak::setGoniometerMatrix(): Goniometer "
                                 "matrix must be non-singular.");
 }
 
+/** Use the goniometer rotation of another peak if it is the same as the rotation of this one, so that the two
+ * peaks share a single copy of the matrices. This saves memory when there are many peaks.
+ * @param other :: a peak which may have been measured at the same goniometer rotation
+ * @return true if the peaks now share their goniometer rotation
+ */
+bool BasePeak::shareGoniometerWith(const BasePeak &other) {
+  if (m_goniometer == other.m_goniometer)
+    return true;
+  if (!isSameMatrix(m_goniometer->matrix, other.m_goniometer->matrix))
+    return false;
+  m_goniometer = other.m_goniometer;
+  return true;
+}
+
+/** Make a goniometer rotation from its matrix
+ * @param matrix :: 3x3 rotation matrix of the goniometer
+ * @param caller :: the name of the calling method, for the error messages
+ * @throw std::invalid_argument if matrix is not 3x3 or is singular */
+std::shared_ptr<const BasePeak::GoniometerRotation>
+BasePeak::makeGoniometerRotation(const Mantid::Kernel::Matrix<double> &matrix, const std::string &caller) {
+  if ((matrix.numCols() != 3) || (matrix.numRows() != 3))
+    throw std::invalid_argument(caller + ": Goniometer matrix must be 3x3.");
+  auto rotation = std::make_shared<GoniometerRotation>(GoniometerRotation{matrix, matrix});
+  if (fabs(rotation->inverse.Invert()) < 1e-8)
+    throw std::invalid_argument(caller + ": Goniometer matrix must be non-singular.");
+  return rotation;
+}
+
+/// @return the rotation of peaks which have not been given a goniometer, shared by all of them
+const std::shared_ptr<const BasePeak::GoniometerRotation> &BasePeak::identityGoniometer() {
+  static const std::shared_ptr<const GoniometerRotation> identity =
+      std::make_shared<GoniometerRotation>(GoniometerRotation{Matrix<double>(3, 3, true), Matrix<double>(3, 3, true)});
+  return identity;
+}
+
 // -------------------------------------------------------------------------------------
 /**Returns the unique peak number
  * Returns -1 if it could not find it. */
@@ -321,14 +372,13 @@ BasePeak &BasePeak::operator=(const BasePeak &other) {
     m_intensity = other.m_intensity;
     m_sigmaIntensity = other.m_sigmaIntensity;
     m_binCount = other.m_binCount;
-    m_GoniometerMatrix = other.m_GoniometerMatrix;
-    m_InverseGoniometerMatrix = other.m_InverseGoniometerMatrix;
+    m_goniometer = other.m_goniometer;
     m_runNumber = other.m_runNumber;
     m_monitorCount = other.m_monitorCount;
     m_peakNumber = other.m_peakNumber;
     m_intHKL = other.m_intHKL;
     m_intMNP = other.m_intMNP;
-    m_peakShape.reset(other.m_peakShape->clone());
+    m_peakShape = other.m_peakShape;
     m_absorptionWeightedPathLength = other.m_absorptionWeightedPathLength;
     m_convention = other.m_convention;
   }
@@ -0,0 +1,349 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidDataObjects/EventList.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using Mantid::API::EventType;
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// Remove the entries of a column where keep is false, preserving the order of the others
+template <typename T> void compactColumn(std::vector<T> &column, const std::vector<char> &keep) {
+  if (column.empty())
+    return;
+  size_t out = 0;
+  for (size_t i = 0; i < column.size(); ++i) {
+    column[out] = column[i];
+    out += static_cast<size_t>(keep[i]);
+  }
+  column.resize(out);
+}
+
+/// Copy the entries of a column where keep is true, preserving their order
+template <typename T>
+void copyColumn(const std::vector<T> &column, const std::vector<char> &keep, const size_t numKept,
+                std::vector<T> &output) {
+  output.clear();
+  // the columns that are not used by the event type are empty
+  if (column.empty() || numKept == 0)
+    return;
+  output.resize(numKept);
+  size_t out = 0;
+  for (size_t i = 0; out < numKept; ++i) {
+    output[out] = column[i];
+    out += static_cast<size_t>(keep[i]);
+  }
+}
+} // namespace
+
+/// Constructor (empty)
+EventColumns::EventColumns(const EventType event_type) : m_eventType(event_type) {}
+
+/** Constructor copying the events out of an EventList
+ *
+ * @param eventList :: the events to copy
+ */
+EventColumns::EventColumns(const EventList &eventList) : m_eventType(eventList.getEventType()) {
+  this->reserve(eventList.getNumberEvents());
+
+  switch (m_eventType) {
+  case EventType::TOF:
+    for (const auto &event : eventList.getEvents()) {
+      m_tofs.emplace_back(event.tof());
+      m_pulseTimes.emplace_back(event.pulseTime().totalNanoseconds());
+    }
+    break;
+  case EventType::WEIGHTED:
+    for (const auto &event : eventList.getWeightedEvents()) {
+      m_tofs.emplace_back(event.tof());
+      m_pulseTimes.emplace_back(event.pulseTime().totalNanoseconds());
+      m_weights.emplace_back(static_cast<float>(event.weight()));
+      m_errorSquareds.emplace_back(static_cast<float>(event.errorSquared()));
+    }
+    break;
+  case EventType::WEIGHTED_NOTIME:
+    for (const auto &event : eventList.getWeightedEventsNoTime()) {
+      m_tofs.emplace_back(event.tof());
+      m_weights.emplace_back(static_cast<float>(event.weight()));
+      m_errorSquareds.emplace_back(static_cast<float>(event.errorSquared()));
+    }
+    break;
+  }
+}
+
+/** Replace the events in the EventList with the ones held in the columns. The EventList is switched to the event type
+ * of the columns. The histogram x-values and detector ids of the EventList are unchanged.
+ *
+ * @param eventList :: the EventList to write into
+ * @throws std::runtime_error if the EventList can not be switched to the event type of the columns
+ */
+void EventColumns::copyTo(EventList &eventList) const {
+  eventList.clear(false);
+  eventList.switchTo(m_eventType);
+  eventList.reserve(this->size());
+
+  switch (m_eventType) {
+  case EventType::TOF: {
+    std::vector<TofEvent> *events;
+    getEventsFrom(eventList, events);
+    for (size_t i = 0; i < m_tofs.size(); ++i)
+      events->emplace_back(m_tofs[i], DateAndTime(m_pulseTimes[i]));
+    break;
+  }
+  case EventType::WEIGHTED: {
+    std::vector<WeightedEvent> *events;
+    getEventsFrom(eventList, events);
+    for (size_t i = 0; i < m_tofs.size(); ++i)
+      events->emplace_back(m_tofs[i], DateAndTime(m_pulseTimes[i]), m_weights[i], m_errorSquareds[i]);
+    break;
+  }
+  case EventType::WEIGHTED_NOTIME: {
+    std::vector<WeightedEventNoTime> *events;
+    getEventsFrom(eventList, events);
+    for (size_t i = 0; i < m_tofs.size(); ++i)
+      events->emplace_back(m_tofs[i], m_weights[i], m_errorSquareds[i]);
+    break;
+  }
+  }
+  eventList.setSortOrder(UNSORTED);
+}
+
+EventType EventColumns::getEventType() const { return m_eventType; }
+
+std::size_t EventColumns::size() const { return m_tofs.size(); }
+
+bool EventColumns::empty() const { return m_tofs.empty(); }
+
+/// Reserve space in the columns that are used by the event type
+void EventColumns::reserve(const std::size_t num) {
+  m_tofs.reserve(num);
+  if (m_eventType != EventType::WEIGHTED_NOTIME)
+    m_pulseTimes.reserve(num);
+  if (m_eventType != EventType::TOF) {
+    m_weights.reserve(num);
+    m_errorSquareds.reserve(num);
+  }
+}
+
+void EventColumns::clear() {
+  m_tofs.clear();
+  m_pulseTimes.clear();
+  m_weights.clear();
+  m_errorSquareds.clear();
+}
+
+const std::vector<double> &EventColumns::tofs() const { return m_tofs; }
+
+std::vector<double> &EventColumns::mutableTofs() { return m_tofs; }
+
+/// Pulse times in total nanoseconds. This is empty for WEIGHTED_NOTIME.
+const std::vector<int64_t> &EventColumns::pulseTimes() const { return m_pulseTimes; }
+
+/// This is empty for TOF.
+const std::vector<float> &EventColumns::weights() const { return m_weights; }
+
+/// This is empty for TOF.
+const std::vector<float> &EventColumns::errorSquareds() const { return m_errorSquareds; }
+
+/** Convert the time-of-flight by tof -> tof * factor + offset. Unlike EventList::convertTof this does not modify any
+ * histogram x-values.
+ *
+ * @param factor :: multiply by this
+ * @param offset :: add this
+ */
+void EventColumns::convertTof(const double factor, const double offset) {
+  double *tofs = m_tofs.data();
+  const size_t numEvents = m_tofs.size();
+  for (size_t i = 0; i < numEvents; ++i)
+    tofs[i] = tofs[i] * factor + offset;
+}
+
+/** Remove events that have a tof between tofMin and tofMax (inclusively). This is the same selection as
+ * EventList::maskTof but the columns do not need to be sorted first.
+ *
+ * @param tofMin :: lower bound of TOF to filter out
+ * @param tofMax :: upper bound of TOF to filter out
+ * @returns The number of events deleted.
+ */
+std::size_t EventColumns::maskTof(const double tofMin, const double tofMax) {
+  if (tofMax <= tofMin)
+    throw std::runtime_error("EventColumns::maskTof: tofMax must be > tofMin");
+
+  // build the mask from the time-of-flight only
+  const size_t numOrig = m_tofs.size();
+  std::vector<char> keep(numOrig);
+  const double *tofs = m_tofs.data();
+  for (size_t i = 0; i < numOrig; ++i)
+    keep[i] = static_cast<char>((tofs[i] < tofMin) || (tofs[i] > tofMax));
+
+  compactColumn(m_tofs, keep);
+  compactColumn(m_pulseTimes, keep);
+  compactColumn(m_weights, keep);
+  compactColumn(m_errorSquareds, keep);
+
+  return numOrig - m_tofs.size();
+}
+
+/** Filter into output columns keeping only the events with pulse times >= start and < stop. This is the same selection
+ * as EventList::filterByPulseTime but the columns do not need to be sorted by pulse time first.
+ *
+ * @param start :: start time (absolute)
+ * @param stop :: end time (absolute)
+ * @param output :: columns to write the events into
+ * @throws std::invalid_argument If output is a reference to these columns
+ * @throws std::runtime_error If the events have no pulse times
+ */
+void EventColumns::filterByPulseTime(const DateAndTime &start, const DateAndTime &stop, EventColumns &output) const {
+  if (this == &output)
+    throw std::invalid_argument("In-place filtering is not allowed");
+  if (m_eventType == EventType::WEIGHTED_NOTIME)
+    throw std::runtime_error("EventColumns::filterByPulseTime() called on columns that have no time information.");
+
+  // build the mask from the pulse time only
+  const int64_t startNanoseconds = start.totalNanoseconds();
+  const int64_t stopNanoseconds = stop.totalNanoseconds();
+  const size_t numEvents = m_pulseTimes.size();
+  std::vector<char> keep(numEvents);
+  const int64_t *pulseTimes = m_pulseTimes.data();
+  size_t numKept = 0;
+  for (size_t i = 0; i < numEvents; ++i) {
+    keep[i] = static_cast<char>((pulseTimes[i] >= startNanoseconds) && (pulseTimes[i] < stopNanoseconds));
+    numKept += static_cast<size_t>(keep[i]);
+  }
+
+  output.m_eventType = m_eventType;
+  copyColumn(m_tofs, keep, numKept, output.m_tofs);
+  copyColumn(m_pulseTimes, keep, numKept, output.m_pulseTimes);
+  copyColumn(m_weights, keep, numKept, output.m_weights);
+  copyColumn(m_errorSquareds, keep, numKept, output.m_errorSquareds);
+}
+
+/** Generates both the Y and E (error) histograms w.r.t TOF. This will zero out the Y array as part of the process.
+ * The columns are not sorted so the bin of each event is found with a binary search.
+ *
+ * @param X: x-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error for unweighted events
+ */
+void EventColumns::generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E, bool skipError) const {
+  histogramHelper(X, Y, E, skipError, [&X](const double tof) -> std::optional<size_t> {
+    const auto it = std::upper_bound(X.cbegin(), X.cend(), tof);
+    return static_cast<size_t>(std::distance(X.cbegin(), it) - 1);
+  });
+}
+
+/** Generates both the Y and E (error) histograms w.r.t TOF using the step size to calculate the bin number. This only
+ * works for logarithmic (negative step) or linear binning, see EventList::findLinearBin and EventList::findLogBin.
+ *
+ * @param step: bin step size
+ * @param X: x-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error for unweighted events
+ */
+void EventColumns::generateHistogram(const double step, const MantidVec &X, MantidVec &Y, MantidVec &E,
+                                     bool skipError) const {
+  if (X.size() <= 1) {
+    generateHistogram(X, Y, E, skipError);
+  } else if (step < 0) {
+    const double divisor = 1. / log1p(std::abs(step)); // use this to do change of base
+    const double offset = log(X.front()) * divisor;
+    histogramHelper(X, Y, E, skipError, [&X, divisor, offset](const double tof) {
+      return EventList::findLogBin(X, tof, divisor, offset);
+    });
+  } else {
+    const double divisor = 1. / step;
+    const double offset = X.front() * divisor;
+    histogramHelper(X, Y, E, skipError, [&X, divisor, offset](const double tof) {
+      return EventList::findLinearBin(X, tof, divisor, offset);
+    });
+  }
+}
+
+template <typename FindBin>
+void EventColumns::histogramHelper(const MantidVec &X, MantidVec &Y, MantidVec &E, bool skipError,
+                                   FindBin &&findBin) const {
+  if (X.size() <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    E.resize(0, 0);
+    return;
+  }
+  Y.assign(X.size() - 1, 0.);
+  const bool weighted = (m_eventType != EventType::TOF);
+  if (weighted || !skipError)
+    E.assign(X.size() - 1, 0.);
+
+  const auto xmin = X.front();
+  const auto xmax = X.back();
+  const size_t numEvents = m_tofs.size();
+  for (size_t i = 0; i < numEvents; ++i) {
+    const double tof = m_tofs[i];
+    if (tof < xmin || tof >= xmax)
+      continue;
+    const std::optional<size_t> bin = findBin(tof);
+    if (!bin)
+      continue;
+    if (weighted) {
+      Y[bin.value()] += m_weights[i];
+      E[bin.value()] += m_errorSquareds[i];
+    } else {
+      Y[bin.value()]++;
+    }
+  }
+
+  // errors are sqrt of counts or sum of errors squared
+  if (weighted)
+    std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+  else if (!skipError)
+    std::transform(Y.cbegin(), Y.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+}
+
+/** Copy all of the events of an EventWorkspace into columns. There is one EventColumns for each spectrum.
+ *
+ * @param workspace :: the workspace to copy the events from
+ */
+std::vector<EventColumns> toEventColumns(const EventWorkspace &workspace) {
+  const auto numHist = static_cast<int64_t>(workspace.getNumberHistograms());
+  std::vector<EventColumns> columns(static_cast<size_t>(numHist));
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numHist; ++i) {
+    columns[i] = EventColumns(workspace.getSpectrum(static_cast<size_t>(i)));
+  }
+  return columns;
+}
+
+/** Replace the events of an EventWorkspace with those from columns created by toEventColumns.
+ *
+ * @param columns :: one EventColumns for each spectrum
+ * @param workspace :: the workspace to copy the events into
+ * @throws std::invalid_argument if the number of columns does not match the number of spectra
+ */
+void fromEventColumns(const std::vector<EventColumns> &columns, EventWorkspace &workspace) {
+  if (columns.size() != workspace.getNumberHistograms())
+    throw std::invalid_argument("Number of EventColumns does not match the number of spectra in the workspace");
+  const auto numHist = static_cast<int64_t>(columns.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numHist; ++i) {
+    columns[i].copyTo(workspace.getSpectrum(static_cast<size_t>(i)));
+  }
+  workspace.clearMRU();
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -3315,6 +3315,63 @@ std::vector<double> EventList::getWeightErrors() const {
   return weightErrors;
 }
 
+// --------------------------------------------------------------------------
+namespace {
+/** Describe a member of every event in a list
+ * @param events :: source vector of events
+ * @param field :: pointer to the member
+ */
+template <typename FieldType, class T, class Owner>
+EventList::FieldView<FieldType> makeFieldView(const std::vector<T> &events, const FieldType Owner::*field) {
+  return {events.empty() ? nullptr : &(events.front().*field), events.size(), static_cast<std::ptrdiff_t>(sizeof(T))};
+}
+} // namespace
+
+/** Get the times-of-flight of the events in place
+ * @return the location of the tof() values
+ */
+EventList::FieldView<double> EventList::getTofsView() const {
+  switch (eventType) {
+  case TOF:
+    return makeFieldView(*this->events, &TofEvent::m_tof);
+  case WEIGHTED:
+    return makeFieldView(*this->weightedEvents, &WeightedEvent::m_tof);
+  case WEIGHTED_NOTIME:
+    return makeFieldView(*this->weightedEventsNoTime, &WeightedEventNoTime::m_tof);
+  }
+  throw std::runtime_error("EventList::getTofsView() called on an EventList of unknown type");
+}
+
+/** Get the weights of the events in place
+ * @return the location of the weight() values
+ * @throws std::runtime_error if the events are not weighted, as their weights are not stored
+ */
+EventList::FieldView<float> EventList::getWeightsView() const {
+  switch (eventType) {
+  case WEIGHTED:
+    return makeFieldView(*this->weightedEvents, &WeightedEvent::m_weight);
+  case WEIGHTED_NOTIME:
+    return makeFieldView(*this->weightedEventsNoTime, &WeightedEventNoTime::m_weight);
+  default:
+    throw std::runtime_error("EventList::getWeightsView() called on an EventList that does not store weights");
+  }
+}
+
+/** Get the squared errors of the weights of the events in place
+ * @return the location of the errorSquared() values
+ * @throws std::runtime_error if the events are not weighted, as their errors are not stored
+ */
+EventList::FieldView<float> EventList::getErrorSquaredView() const {
+  switch (eventType) {
+  case WEIGHTED:
+    return makeFieldView(*this->weightedEvents, &WeightedEvent::m_errorSquared);
+  case WEIGHTED_NOTIME:
+    return makeFieldView(*this->weightedEventsNoTime, &WeightedEventNoTime::m_errorSquared);
+  default:
+    throw std::runtime_error("EventList::getErrorSquaredView() called on an EventList that does not store errors");
+  }
+}
+
 /**
  * Compute a time (for instance, pulse-time plus TOF) associated to each event in the list.
  * @param timesCalc : anonymous function that computes a time from an input event
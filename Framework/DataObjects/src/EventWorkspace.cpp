@@ -13,6 +13,7 @@
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
+#include "MantidDataObjects/EventWorkspaceFileBacking.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
@@ -24,8 +25,11 @@
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 
+#include <Poco/TemporaryFile.h>
+
 #include "tbb/parallel_for.h"
 #include <algorithm>
+#include <filesystem>
 #include <limits>
 #include <numeric>
 
@@ -48,11 +52,18 @@ EventWorkspace::EventWorkspace() : IEventWorkspace(), mru(std::make_unique<Event
 
 EventWorkspace::EventWorkspace(const EventWorkspace &other)
     : IEventWorkspace(other), mru(std::make_unique<EventWorkspaceMRU>()) {
-  for (const auto &el : other.data) {
+  // a copy of a file backed workspace gets its own scratch file next to the original
+  if (other.m_fileBacking)
+    m_fileBacking = std::make_unique<EventWorkspaceFileBacking>(
+        Poco::TemporaryFile::tempName(std::filesystem::path(other.m_fileBacking->filename()).parent_path().string()),
+        other.m_fileBacking->memoryBudget(), other.data.size());
+  for (size_t i = 0; i < other.data.size(); ++i) {
     // Create a new event list, copying over the events
-    auto newel = std::make_unique<EventList>(*el);
+    auto newel = std::make_unique<EventList>(other.getSpectrum(i));
     // Make sure to update the MRU to point to THIS event workspace.
     newel->setMRU(this->mru.get());
+    if (m_fileBacking)
+      m_fileBacking->pageOut(i, *newel);
     this->data.emplace_back(std::move(newel));
   }
 }
@@ -212,6 +223,8 @@ EventList &EventWorkspace::getSpectrumWithoutInvalidation(const size_t index) {
 const EventList &EventWorkspace::getSpectrum(const size_t index) const {
   if (index >= data.size())
     throw std::range_error("EventWorkspace::getSpectrum, workspace index out of range");
+  if (m_fileBacking)
+    m_fileBacking->access(index, *data[index]);
   return *data[index];
 }
 
@@ -226,7 +239,11 @@ const EventList &EventWorkspace::getSpectrum(const size_t index) const {
  * @param index Workspace index
  * @return Pointer to EventList
  */
-EventList *EventWorkspace::getSpectrumUnsafe(const size_t index) { return data[index].get(); }
+EventList *EventWorkspace::getSpectrumUnsafe(const size_t index) {
+  if (m_fileBacking)
+    m_fileBacking->access(index, *data[index]);
+  return data[index].get();
+}
 
 double EventWorkspace::getTofMin() const { return this->getEventXMin(); }
 
@@ -435,6 +452,13 @@ void EventWorkspace::getEventXMinMax(double &xmin, double &xmax) const {
 /// The total number of events across all of the spectra.
 /// @returns The total number of events
 size_t EventWorkspace::getNumberEvents() const {
+  if (m_fileBacking) {
+    // count without reading the events back from the file
+    size_t total{0};
+    for (size_t i = 0; i < data.size(); ++i)
+      total += m_fileBacking->getNumberEvents(i, *data[i]);
+    return total;
+  }
   return std::accumulate(data.cbegin(), data.cend(), size_t{0},
                          [](const auto total, const auto &list) { return total + list->getNumberEvents(); });
 }
@@ -462,8 +486,8 @@ Mantid::API::EventType EventWorkspace::getEventType() const {
  * @param type :: EventType to switch to
  */
 void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
-  for (auto &eventList : this->data)
-    eventList->switchTo(type);
+  for (size_t i = 0; i < data.size(); ++i)
+    getSpectrumUnsafe(i)->switchTo(type);
 }
 
 /// Returns true always - an EventWorkspace always represents histogramm-able
@@ -567,7 +591,7 @@ void EventWorkspace::generateHistogram(const std::size_t index, const MantidVec
                                        bool skipError) const {
   if (index >= data.size())
     throw std::range_error("EventWorkspace::generateHistogram, histogram number out of range");
-  this->data[index]->generateHistogram(X, Y, E, skipError);
+  this->getSpectrum(index).generateHistogram(X, Y, E, skipError);
 }
 
 /** Using the event data in the event list, generate a histogram of it w.r.t
@@ -585,7 +609,7 @@ void EventWorkspace::generateHistogramPulseTime(const std::size_t index, const M
   if (index >= data.size())
     throw std::range_error("EventWorkspace::generateHistogramPulseTime, "
                            "histogram number out of range");
-  this->data[index]->generateHistogramPulseTime(X, Y, E, skipError);
+  this->getSpectrum(index).generateHistogramPulseTime(X, Y, E, skipError);
 }
 
 /** Set all histogram X vectors.
@@ -688,6 +712,52 @@ void EventWorkspace::sortAll(EventSortType sortType, Mantid::API::Progress *prog
   tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size(), grainsize), task);
 }
 
+/** Keep the events in a scratch file rather than in memory. All of the events are written to the file straight away
+ * and each event list is read back when it is accessed through getSpectrum() or getSpectrumUnsafe(). Once the events
+ * in memory exceed the budget, each thread writes out the event lists it used least recently. The histograms, sort
+ * orders and detector IDs stay in memory and the MRU lists of the histograms are unaffected.
+ *
+ * References to the events of a list are only valid while it is one of the last
+ * EventWorkspaceFileBacking::MIN_RESIDENT lists used by a thread that accessed it, which is the case for the
+ * algorithms that work through the workspace one spectrum at a time. Code that holds on to more lists has to pin them
+ * with pinSpectrum(). Algorithms, views of the events and the Python exports do not pin the lists they read, so no
+ * algorithm makes a workspace file backed yet.
+ *
+ * @param directory :: directory for the scratch file, the system temporary directory if empty
+ * @param memoryBudget :: bytes of events that may be held in memory
+ */
+void EventWorkspace::setFileBacked(const std::string &directory, const size_t memoryBudget) {
+  if (m_fileBacking)
+    throw std::runtime_error("EventWorkspace::setFileBacked, the workspace is already file backed");
+  if (data.empty())
+    throw std::runtime_error("EventWorkspace::setFileBacked, the workspace has not been initialized");
+  m_fileBacking = std::make_unique<EventWorkspaceFileBacking>(Poco::TemporaryFile::tempName(directory), memoryBudget,
+                                                              data.size());
+  m_fileBacking->pageOutAll(data);
+}
+
+/** Keep the events of a spectrum of a file backed workspace in memory until unpinSpectrum() is called, so that a
+ * reference to them stays valid however many other spectra are used meanwhile. Does nothing if the workspace is not
+ * file backed.
+ * @param index :: workspace index
+ */
+void EventWorkspace::pinSpectrum(const size_t index) const {
+  if (index >= data.size())
+    throw std::range_error("EventWorkspace::pinSpectrum, workspace index out of range");
+  if (m_fileBacking)
+    m_fileBacking->pin(index, *data[index]);
+}
+
+/** Undo a call to pinSpectrum()
+ * @param index :: workspace index
+ */
+void EventWorkspace::unpinSpectrum(const size_t index) const {
+  if (index >= data.size())
+    throw std::range_error("EventWorkspace::unpinSpectrum, workspace index out of range");
+  if (m_fileBacking)
+    m_fileBacking->unpin(index);
+}
+
 /** Integrate all the spectra in the matrix workspace within the range given.
  * Default implementation, can be overridden by base classes if they know
  *something smarter!
@@ -709,10 +779,10 @@ void EventWorkspace::getIntegratedSpectra(std::vector<double> &out, const double
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int wksp_index = 0; wksp_index < int(this->getNumberHistograms()); wksp_index++) {
     // Get Handle to data
-    EventList const *el = this->data[wksp_index].get();
+    const EventList &el = this->getSpectrum(wksp_index);
 
     // Let the eventList do the integration
-    out[wksp_index] = el->integrate(minX, maxX, entireRange);
+    out[wksp_index] = el.integrate(minX, maxX, entireRange);
   }
 }
 
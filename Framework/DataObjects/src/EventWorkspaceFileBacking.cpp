@@ -0,0 +1,265 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventWorkspaceFileBacking.h"
+#include "MantidDataObjects/EventList.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Mantid::DataObjects {
+
+namespace {
+/// Call func with the vector holding the events of the list
+template <typename Func> auto visitEvents(EventList &list, Func &&func) {
+  switch (list.getEventType()) {
+  case API::TOF:
+    return func(list.getEvents());
+  case API::WEIGHTED:
+    return func(list.getWeightedEvents());
+  case API::WEIGHTED_NOTIME:
+    return func(list.getWeightedEventsNoTime());
+  }
+  throw std::runtime_error("EventWorkspaceFileBacking: unknown event type");
+}
+
+/// @return the bytes allocated for the events of the list
+size_t eventBytes(EventList &list) {
+  return visitEvents(list, [](const auto &events) { return events.capacity() * sizeof(events.front()); });
+}
+} // namespace
+
+/**
+ * Constructor. Creates the scratch file, which is removed again by the destructor.
+ * @param filename :: path of the scratch file
+ * @param memoryBudget :: bytes of events that may be held in memory
+ * @param numberOfLists :: number of event lists in the workspace
+ */
+EventWorkspaceFileBacking::EventWorkspaceFileBacking(std::string filename, const size_t memoryBudget,
+                                                     const size_t numberOfLists)
+    : m_filename(std::move(filename)), m_memoryBudget(memoryBudget), m_slots(numberOfLists),
+      m_file(m_filename, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc) {
+  if (!m_file)
+    throw std::runtime_error("EventWorkspaceFileBacking: could not create the scratch file " + m_filename);
+}
+
+EventWorkspaceFileBacking::~EventWorkspaceFileBacking() {
+  m_file.close();
+  std::error_code ec;
+  std::filesystem::remove(m_filename, ec);
+}
+
+/**
+ * Make sure the events of a list are in memory before it is used. This may write out the lists the calling thread
+ * used least recently to keep within the memory budget, unless another thread still uses them or they are pinned.
+ * @param index :: workspace index of the list
+ * @param list :: the event list
+ */
+void EventWorkspaceFileBacking::access(const size_t index, EventList &list) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto &slot = m_slots[index];
+  slot.list = &list;
+  if (!slot.inMemory)
+    pageInSlot(slot, list);
+  touch(index);
+}
+
+/**
+ * Make sure the events of a list are in memory and keep them there until unpin() is called, for code that holds on to
+ * more than MIN_RESIDENT lists at a time.
+ * @param index :: workspace index of the list
+ * @param list :: the event list
+ */
+void EventWorkspaceFileBacking::pin(const size_t index, EventList &list) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto &slot = m_slots[index];
+  slot.list = &list;
+  if (!slot.inMemory)
+    pageInSlot(slot, list);
+  ++slot.pins;
+  touch(index);
+}
+
+/**
+ * Undo a call to pin(). The list is written out if no thread has it among its recently used lists.
+ * @param index :: workspace index of the list
+ */
+void EventWorkspaceFileBacking::unpin(const size_t index) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto &slot = m_slots[index];
+  if (slot.pins == 0)
+    throw std::runtime_error("EventWorkspaceFileBacking: the list at index " + std::to_string(index) +
+                             " is not pinned");
+  remeasure(slot);
+  --slot.pins;
+  if (!slot.isHeld())
+    pageOutSlot(index, *slot.list);
+}
+
+/**
+ * Write the events of a list to the file and free them, unless it is pinned
+ * @param index :: workspace index of the list
+ * @param list :: the event list
+ */
+void EventWorkspaceFileBacking::pageOut(const size_t index, EventList &list) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_slots[index].inMemory && m_slots[index].pins == 0)
+    pageOutSlot(index, list);
+}
+
+/**
+ * Write the events of all the lists that are not pinned to the file and free them
+ * @param lists :: the event lists of the workspace
+ */
+void EventWorkspaceFileBacking::pageOutAll(const std::vector<std::unique_ptr<EventList>> &lists) {
+  if (lists.size() != m_slots.size())
+    throw std::invalid_argument("EventWorkspaceFileBacking: wrong number of event lists");
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (size_t index = 0; index < lists.size(); ++index) {
+    if (m_slots[index].inMemory && m_slots[index].pins == 0)
+      pageOutSlot(index, *lists[index]);
+  }
+}
+
+/**
+ * @param index :: workspace index of the list
+ * @param list :: the event list
+ * @return the number of events of the list, without reading them from the file
+ */
+size_t EventWorkspaceFileBacking::getNumberEvents(const size_t index, const EventList &list) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto &slot = m_slots[index];
+  return slot.inMemory ? list.getNumberEvents() : slot.numberOfEvents;
+}
+
+/// @return true if the events of the list at the workspace index are in memory
+bool EventWorkspaceFileBacking::isInMemory(const size_t index) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_slots[index].inMemory;
+}
+
+/// @return true if the list at the workspace index is pinned
+bool EventWorkspaceFileBacking::isPinned(const size_t index) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_slots[index].pins > 0;
+}
+
+/// @return the bytes of events held in memory, as measured when the lists were last accessed
+size_t EventWorkspaceFileBacking::getMemoryUsed() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_memoryUsed;
+}
+
+/// @return the length of the scratch file in bytes
+size_t EventWorkspaceFileBacking::getFileSize() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return static_cast<size_t>(m_fileSize);
+}
+
+/// Write the events to the slot of the list, moving the slot to the end of the file if they no longer fit
+void EventWorkspaceFileBacking::pageOutSlot(const size_t index, EventList &list) {
+  forget(index);
+  auto &slot = m_slots[index];
+  visitEvents(list, [&](auto &events) {
+    using EventVector = std::remove_reference_t<decltype(events)>;
+    const uint64_t bytes = events.size() * sizeof(typename EventVector::value_type);
+    if (bytes > slot.capacity) {
+      slot.position = m_fileSize;
+      slot.capacity = bytes;
+      m_fileSize += bytes;
+    }
+    m_file.seekp(static_cast<std::streamoff>(slot.position));
+    m_file.write(reinterpret_cast<const char *>(events.data()), static_cast<std::streamsize>(bytes));
+    if (!m_file)
+      throw std::runtime_error("EventWorkspaceFileBacking: could not write to " + m_filename);
+    slot.numberOfEvents = events.size();
+    // swap rather than clear so the memory is released
+    EventVector().swap(events);
+  });
+  slot.eventType = list.getEventType();
+  slot.inMemory = false;
+  slot.list = &list;
+}
+
+/// Read the events of the list back from its slot
+void EventWorkspaceFileBacking::pageInSlot(Slot &slot, EventList &list) {
+  if (list.getEventType() != slot.eventType)
+    throw std::runtime_error("EventWorkspaceFileBacking: the event type of a list changed while it was on file");
+  visitEvents(list, [&](auto &events) {
+    using EventVector = std::remove_reference_t<decltype(events)>;
+    events.resize(slot.numberOfEvents);
+    m_file.seekg(static_cast<std::streamoff>(slot.position));
+    m_file.read(reinterpret_cast<char *>(events.data()),
+                static_cast<std::streamsize>(slot.numberOfEvents * sizeof(typename EventVector::value_type)));
+    if (!m_file)
+      throw std::runtime_error("EventWorkspaceFileBacking: could not read from " + m_filename);
+  });
+  slot.inMemory = true;
+}
+
+/// Make the list the one the calling thread used most recently and write out the lists it used least recently
+void EventWorkspaceFileBacking::touch(const size_t index) {
+  const auto thread = std::this_thread::get_id();
+  auto &slot = m_slots[index];
+  auto &recent = m_recentlyUsed[thread];
+  if (!recent.empty() && recent.front() == index) {
+    remeasure(slot);
+    return;
+  }
+  // the list used last by this thread has probably been filled or emptied since
+  if (!recent.empty())
+    remeasure(m_slots[recent.front()]);
+  const auto user = std::find_if(slot.users.begin(), slot.users.end(),
+                                 [thread](const auto &entry) { return entry.first == thread; });
+  if (user == slot.users.end()) {
+    recent.push_front(index);
+    slot.users.emplace_back(thread, recent.begin());
+  } else {
+    recent.splice(recent.begin(), recent, user->second);
+  }
+  remeasure(slot);
+
+  while (m_memoryUsed > m_memoryBudget && recent.size() > MIN_RESIDENT) {
+    const auto oldest = recent.back();
+    remeasure(m_slots[oldest]);
+    release(oldest, thread);
+  }
+}
+
+/// Remove the slot from the recently used list of a thread and write it out if nothing else holds it
+void EventWorkspaceFileBacking::release(const size_t index, const std::thread::id thread) {
+  auto &slot = m_slots[index];
+  const auto user = std::find_if(slot.users.begin(), slot.users.end(),
+                                 [thread](const auto &entry) { return entry.first == thread; });
+  m_recentlyUsed[thread].erase(user->second);
+  slot.users.erase(user);
+  // another thread, or a pin, may still hold a reference to the events
+  if (!slot.isHeld())
+    pageOutSlot(index, *slot.list);
+}
+
+/// Remove the slot from the recently used lists holding it and stop counting its memory
+void EventWorkspaceFileBacking::forget(const size_t index) {
+  auto &slot = m_slots[index];
+  for (const auto &[thread, position] : slot.users)
+    m_recentlyUsed[thread].erase(position);
+  slot.users.clear();
+  m_memoryUsed -= slot.memory;
+  slot.memory = 0;
+}
+
+/// Update the memory counted for a slot that is used or pinned
+void EventWorkspaceFileBacking::remeasure(Slot &slot) {
+  if (!slot.isHeld() || !slot.inMemory)
+    return;
+  m_memoryUsed -= slot.memory;
+  slot.memory = eventBytes(*slot.list);
+  m_memoryUsed += slot.memory;
+}
+
+} // namespace Mantid::DataObjects
@@ -38,7 +38,8 @@ using Kernel::ThreadSchedulerFIFO;
 FakeMD::FakeMD(const std::vector<double> &uniformParams, const std::vector<double> &peakParams,
                const std::vector<double> &ellipsoidParams, const int randomSeed, const bool randomizeSignal)
     : m_uniformParams(uniformParams), m_peakParams(peakParams), m_ellipsoidParams(ellipsoidParams),
-      m_randomSeed(randomSeed), m_randomizeSignal(randomizeSignal), m_detIDs(), m_randGen(1), m_uniformDist() {
+      m_randomSeed(randomSeed), m_randomizeSignal(randomizeSignal), m_splitBoxes(true), m_detIDs(), m_randGen(1),
+      m_uniformDist() {
   if (uniformParams.empty() && peakParams.empty() && ellipsoidParams.empty()) {
     throw std::invalid_argument("You must specify at least one of peakParams, "
                                 "ellipsoidParams or uniformParams");
@@ -49,8 +50,11 @@ FakeMD::FakeMD(const std::vector<double> &uniformParams, const std::vector<doubl
  * Add the fake data to the given workspace
  * @param workspace A pointer to MD event workspace to fill using the object
  * parameters
+ * @param splitBoxes If false, the events are added to the existing boxes
+ * without splitting them, for the caller to build the boxes
  */
-void FakeMD::fill(const API::IMDEventWorkspace_sptr &workspace) {
+void FakeMD::fill(const API::IMDEventWorkspace_sptr &workspace, const bool splitBoxes) {
+  m_splitBoxes = splitBoxes;
   setupDetectorCache(*workspace);
 
   CALL_MDEVENT_FUNCTION(this->addFakePeak, workspace)
@@ -140,12 +144,7 @@ template <typename MDE, size_t nd> void FakeMD::addFakePeak(typename MDEventWork
                               centers); // 0 = associated experiment-info index
   }
 
-  ws->splitBox();
-  auto *ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-  ws->splitAllIfNeeded(ts);
-  tp.joinAll();
-  ws->refreshCache();
+  splitAllIfNeeded<MDE, nd>(ws);
 }
 
 /**
@@ -249,12 +248,7 @@ template <typename MDE, size_t nd> void FakeMD::addFakeEllipsoid(typename MDEven
                               eventCenter); // 0 = associated experiment-info index
   }
 
-  ws->splitBox();
-  auto *ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-  ws->splitAllIfNeeded(ts);
-  tp.joinAll();
-  ws->refreshCache();
+  splitAllIfNeeded<MDE, nd>(ws);
 }
 
 /**
@@ -308,12 +302,7 @@ template <typename MDE, size_t nd> void FakeMD::addFakeUniformData(typename MDEv
   else
     addFakeRegularData<MDE, nd>(m_uniformParams, ws);
 
-  ws->splitBox();
-  auto *ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-  ws->splitAllIfNeeded(ts);
-  tp.joinAll();
-  ws->refreshCache();
+  splitAllIfNeeded<MDE, nd>(ws);
 }
 
 /**
@@ -432,6 +421,22 @@ void FakeMD::addFakeRegularData(const std::vector<double> &params, typename MDEv
   }
 }
 
+/**
+ * Split the boxes of the workspace that hold too many events and refresh the
+ * cached signals, unless the caller builds the boxes
+ * @param ws The workspace that received the events
+ */
+template <typename MDE, size_t nd> void FakeMD::splitAllIfNeeded(typename MDEventWorkspace<MDE, nd>::sptr ws) {
+  if (!m_splitBoxes)
+    return;
+  ws->splitBox();
+  auto *ts = new ThreadSchedulerFIFO();
+  ThreadPool tp(ts);
+  ws->splitAllIfNeeded(ts);
+  tp.joinAll();
+  ws->refreshCache();
+}
+
 /**
  *  Pick a detector ID for a particular event
  *  @returns A detector ID randomly selected from the instrument
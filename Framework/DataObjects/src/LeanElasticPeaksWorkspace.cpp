@@ -146,6 +146,7 @@ void LeanElasticPeaksWorkspace::addPeak(const Geometry::IPeak &ipeak) {
   } else {
     m_peaks.emplace_back(LeanElasticPeak(ipeak));
   }
+  shareGoniometerWithPrevious();
 }
 
 //---------------------------------------------------------------------------------------------
@@ -162,7 +163,18 @@ void LeanElasticPeaksWorkspace::addPeak(const V3D &position, const SpecialCoordi
 /** Add a peak to the list
  * @param peak :: Peak object to add (move) into this.
  */
-void LeanElasticPeaksWorkspace::addPeak(LeanElasticPeak &&peak) { m_peaks.emplace_back(peak); }
+void LeanElasticPeaksWorkspace::addPeak(LeanElasticPeak &&peak) {
+  m_peaks.emplace_back(std::move(peak));
+  shareGoniometerWithPrevious();
+}
+
+/** Share the goniometer rotation of the last peak with the peak before it, if it is the same. Peaks are usually
+ * added in runs at one goniometer setting, so this keeps a single copy of each rotation.
+ */
+void LeanElasticPeaksWorkspace::shareGoniometerWithPrevious() {
+  if (m_peaks.size() > 1)
+    m_peaks.back().shareGoniometerWith(m_peaks[m_peaks.size() - 2]);
+}
 
 //---------------------------------------------------------------------------------------------
 /** Return a reference to the Peak
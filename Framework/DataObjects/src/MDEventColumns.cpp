@@ -0,0 +1,34 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/MDEventColumns.h"
+#include "MantidDataObjects/CoordTransformAligned.h"
+
+namespace Mantid::DataObjects {
+
+/**
+ * Constructor
+ * @param transform :: the transform to copy
+ * @throw std::runtime_error if the transform is neither axis aligned nor affine
+ */
+MDColumnTransform::MDColumnTransform(const API::CoordTransform &transform)
+    : m_inD(transform.getInD()), m_outD(transform.getOutD()), m_aligned(false) {
+  if (const auto *aligned = dynamic_cast<const CoordTransformAligned *>(&transform)) {
+    m_aligned = true;
+    m_dimensionToBinFrom = aligned->getDimensionToBinFrom();
+    m_origin = aligned->getOrigin();
+    m_scaling = aligned->getScaling();
+    return;
+  }
+  const auto matrix = transform.makeAffineMatrix();
+  m_matrix.resize(m_outD * (m_inD + 1));
+  for (size_t out = 0; out < m_outD; ++out) {
+    for (size_t in = 0; in <= m_inD; ++in)
+      m_matrix[out * (m_inD + 1) + in] = matrix[out][in];
+  }
+}
+
+} // namespace Mantid::DataObjects
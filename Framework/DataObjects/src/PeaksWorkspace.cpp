@@ -12,10 +12,13 @@
 #include "MantidGeometry/Instrument/Goniometer.h"
 #include "MantidKernel/IPropertyManager.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/UnitConversion.h"
 #include "MantidNexus/NexusFile.h"
 
 #include <cmath>
+#include <map>
+#include <numeric>
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -49,52 +52,35 @@ PeaksWorkspace::PeaksWorkspace(const PeaksWorkspace &other)
   setNumberOfDetectorGroups(0);
 }
 
-/** Comparator class for sorting peaks by one or more criteria
+namespace {
+/** Read a sort criterion of all the peaks into one array. Bank names are replaced by their position in alphabetical
+ * order, so that every criterion is compared as a number.
+ * @param peaks :: the peaks to sort
+ * @param column :: the name of the column to sort by
+ * @return the value of the column for each peak
  */
-class PeakComparator {
-public:
-  using ColumnAndDirection = PeaksWorkspace::ColumnAndDirection;
-  std::vector<ColumnAndDirection> &criteria;
-
-  /** Constructor for the comparator for sorting peaks
-   * @param criteria : a vector with a list of pairs: column name, bool;
-   *        where bool = true for ascending, false for descending sort.
-   */
-  explicit PeakComparator(std::vector<ColumnAndDirection> &criteria) : criteria(criteria) {}
-
-  /** Compare two peaks using the stored criteria */
-  inline bool operator()(const Peak &a, const Peak &b) {
-    for (const auto &name : criteria) {
-      const auto &col = name.first;
-      const bool ascending = name.second;
-      bool lessThan = false;
-      if (col == "BankName") {
-        // If this criterion is equal, move on to the next one
-        const std::string valA = a.getBankName();
-        const std::string valB = b.getBankName();
-        // Move on to lesser criterion if equal
-        if (valA == valB)
-          continue;
-        lessThan = (valA < valB);
-      } else {
-        // General double comparison
-        const double valA = a.getValueByColName(col);
-        const double valB = b.getValueByColName(col);
-        // Move on to lesser criterion if equal
-        if (valA == valB)
-          continue;
-        lessThan = (valA < valB);
-      }
-      // Flip the sign of comparison if descending.
-      if (ascending)
-        return lessThan;
-      else
-        return !lessThan;
-    }
-    // If you reach here, all criteria were ==; so not <, so return false
-    return false;
+std::vector<double> getSortKeys(const std::vector<Peak> &peaks, const std::string &column) {
+  std::vector<double> keys(peaks.size());
+  if (column == "BankName") {
+    std::map<std::string, double> ranks;
+    for (const auto &peak : peaks)
+      ranks.emplace(peak.getBankName(), 0.0);
+    double rank = 0.0;
+    for (auto &nameAndRank : ranks)
+      nameAndRank.second = rank++;
+    std::transform(peaks.cbegin(), peaks.cend(), keys.begin(),
+                   [&ranks](const Peak &peak) { return ranks.at(peak.getBankName()); });
+    return keys;
   }
-};
+  // An unknown column throws here, outside the parallel loop
+  keys[0] = peaks[0].getValueByColName(column);
+  const auto numPeaks = static_cast<int64_t>(peaks.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 1; i < numPeaks; ++i)
+    keys[i] = peaks[i].getValueByColName(column);
+  return keys;
+}
+} // namespace
 
 //---------------------------------------------------------------------------------------------
 /** Sort the peaks by one or more criteria
@@ -105,8 +91,35 @@ public:
  *equal, etc.
  */
 void PeaksWorkspace::sort(std::vector<ColumnAndDirection> &criteria) {
-  PeakComparator comparator(criteria);
-  std::stable_sort(m_peaks.begin(), m_peaks.end(), comparator);
+  if (m_peaks.size() < 2)
+    return;
+  // Read each criterion once, rather than on every comparison, and sort the indices of the peaks
+  std::vector<std::vector<double>> keys;
+  keys.reserve(criteria.size());
+  for (const auto &criterion : criteria)
+    keys.emplace_back(getSortKeys(m_peaks, criterion.first));
+
+  std::vector<size_t> order(m_peaks.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&criteria, &keys](const size_t a, const size_t b) {
+    for (size_t i = 0; i < criteria.size(); ++i) {
+      const double valA = keys[i][a];
+      const double valB = keys[i][b];
+      // Move on to lesser criterion if equal
+      if (valA == valB)
+        continue;
+      // Flip the sign of comparison if descending.
+      return criteria[i].second ? valA < valB : !(valA < valB);
+    }
+    // If you reach here, all criteria were ==; so not <, so return false
+    return false;
+  });
+
+  std::vector<Peak> sorted;
+  sorted.reserve(m_peaks.size());
+  for (const auto index : order)
+    sorted.emplace_back(std::move(m_peaks[index]));
+  m_peaks.swap(sorted);
 }
 
 //---------------------------------------------------------------------------------------------
@@ -156,6 +169,7 @@ void PeaksWorkspace::addPeak(const Geometry::IPeak &ipeak) {
   } else {
     m_peaks.emplace_back(Peak(ipeak));
   }
+  shareGoniometerWithPrevious();
 }
 
 //---------------------------------------------------------------------------------------------
@@ -172,7 +186,18 @@ void PeaksWorkspace::addPeak(const V3D &position, const SpecialCoordinateSystem
 /** Add a peak to the list
  * @param peak :: Peak object to add (move) into this.
  */
-void PeaksWorkspace::addPeak(Peak &&peak) { m_peaks.emplace_back(peak); }
+void PeaksWorkspace::addPeak(Peak &&peak) {
+  m_peaks.emplace_back(std::move(peak));
+  shareGoniometerWithPrevious();
+}
+
+/** Share the goniometer rotation of the last peak with the peak before it, if it is the same. Peaks are usually
+ * added in runs at one goniometer setting, so this keeps a single copy of each rotation.
+ */
+void PeaksWorkspace::shareGoniometerWithPrevious() {
+  if (m_peaks.size() > 1)
+    m_peaks.back().shareGoniometerWith(m_peaks[m_peaks.size() - 2]);
+}
 
 //---------------------------------------------------------------------------------------------
 /** Return a reference to the Peak
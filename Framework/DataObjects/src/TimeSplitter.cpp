@@ -11,6 +11,8 @@
 #include "MantidKernel/SplittingInterval.h"
 #include "MantidKernel/TimeROI.h"
 
+#include <unordered_map>
+
 namespace Mantid {
 using API::EventType;
 using Kernel::SplittingInterval;
@@ -521,6 +523,39 @@ const std::map<int, std::string> &TimeSplitter::getTargetNameMap() const { retur
  */
 void TimeSplitter::splitEventList(const EventList &events, std::map<int, EventList *> &partials, const bool pulseTof,
                                   const bool tofCorrect, const double factor, const double shift) const {
+  const auto getPartial = [&partials](const int destination) -> EventList * {
+    const auto partial = partials.find(destination);
+    return partial == partials.end() ? nullptr : partial->second;
+  };
+  this->splitEventList(events, getPartial, pulseTof, tofCorrect, factor, shift);
+
+  if (this->empty())
+    return;
+  // set the sort order on the EventLists since we know the sorting already
+  const EventSortType sortOrder = pulseTof ? EventSortType::PULSETIMETOF_SORT : EventSortType::PULSETIME_SORT;
+  for (auto &partial : partials) {
+    if (!partial.second->empty())
+      partial.second->setSortOrder(sortOrder);
+  }
+}
+
+/**
+ * Split a list of events according to Pulse time or Pulse + TOF time.
+ * This does not clear out the partial EventLists. The partial list of a destination index is only looked up if
+ * events are sent to it, which avoids creating a map of all of them when there are many destinations.
+ *
+ * Events with masked times are allocated to destination index -1.
+ * @param events : list of input events
+ * @param getPartial : returns the partial list of events for a destination index, or nullptr to drop its events
+ * @param pulseTof : if True, split according to Pulse + TOF time, otherwise split by Pulse time
+ * @param tofCorrect : rescale and shift the TOF values (factor*TOF + shift)
+ * @param factor : rescale the TOF values by a dimensionless factor.
+ * @param shift : shift the TOF values after rescaling, in units of microseconds.
+ * @throws invalid_argument : the event list is of type Mantid::API::EventType::WEIGHTED_NOTIME
+ */
+void TimeSplitter::splitEventList(const EventList &events, const std::function<EventList *(const int)> &getPartial,
+                                  const bool pulseTof, const bool tofCorrect, const double factor,
+                                  const double shift) const {
 
   if (events.getEventType() == EventType::WEIGHTED_NOTIME)
     throw std::invalid_argument("EventList::splitEventList() called on an EventList "
@@ -540,21 +575,21 @@ void TimeSplitter::splitEventList(const EventList &events, std::map<int, EventLi
   }
 
   // split the events
+  std::vector<EventList *> filled;
   switch (events.getEventType()) {
   case EventType::TOF:
-    this->splitEventVec(events.getEvents(), partials, pulseTof, tofCorrect, factor, shift);
+    filled = this->splitEventVec(events.getEvents(), getPartial, pulseTof, tofCorrect, factor, shift);
     break;
   case EventType::WEIGHTED:
-    this->splitEventVec(events.getWeightedEvents(), partials, pulseTof, tofCorrect, factor, shift);
+    filled = this->splitEventVec(events.getWeightedEvents(), getPartial, pulseTof, tofCorrect, factor, shift);
     break;
   default:
     throw std::runtime_error("Unhandled event type");
   }
 
   // set the sort order on the EventLists since we know the sorting already
-  for (auto &partial : partials) {
-    if (!partial.second->empty())
-      partial.second->setSortOrder(sortOrder);
+  for (auto partial : filled) {
+    partial->setSortOrder(sortOrder);
   }
 }
 
@@ -564,40 +599,46 @@ void TimeSplitter::splitEventList(const EventList &events, std::map<int, EventLi
  * For each event in `events` we calculate the event time using a timeCalc function. The function definition
  * depends on the input flags (pulseTof, tofCorrect) and input parameters (factor, shift).
  * The calculated time is then used to find a destination index for the event in the TimeSplitter object.
- * The destination index, in turn, is the key to find the target event list in the partials map.
+ * The destination index, in turn, is used to find the target event list.
  *
  * @tparam EventType : one of EventType::TOF or EventType::WEIGHTED
  * @param events : list of input events
- * @param partials : target list of partial event lists associated with different destination indexes
+ * @param getPartial : returns the partial event list associated with a destination index
  * @param pulseTof : if true, split according to Pulse + TOF time, otherwise split by Pulse time
  * @param tofCorrect : rescale and shift the TOF values (factor*TOF + shift)
  * @param factor : rescale the TOF values by a dimensionless factor.
  * @param shift : shift the TOF values after rescaling, in units of microseconds.
+ * @return the partial event lists that received events
  */
 template <typename EventType>
-
-void TimeSplitter::splitEventVec(const std::vector<EventType> &events, std::map<int, EventList *> &partials,
-                                 const bool pulseTof, const bool tofCorrect, const double factor,
-                                 const double shift) const {
-  // determine the right function for getting the "pulse time" for the event
-  std::function<const DateAndTime(const EventType &)> timeCalc;
+std::vector<EventList *> TimeSplitter::splitEventVec(const std::vector<EventType> &events,
+                                                     const std::function<EventList *(const int)> &getPartial,
+                                                     const bool pulseTof, const bool tofCorrect, const double factor,
+                                                     const double shift) const {
+  // determine the right function for getting the "pulse time" for the event. The time is calculated twice for most
+  // events, so the lambdas are passed on as they are rather than through a std::function to allow them to be inlined.
   if (pulseTof) {
     if (tofCorrect) {
-      timeCalc = [factor, shift](const EventType &event) { return event.pulseTOFTimeAtSample(factor, shift); };
+      return this->splitEventVec(
+          [factor, shift](const EventType &event) { return event.pulseTOFTimeAtSample(factor, shift); }, events,
+          getPartial);
     } else {
-      timeCalc = [](const EventType &event) { return event.pulseTOFTime(); };
+      return this->splitEventVec([](const EventType &event) { return event.pulseTOFTime(); }, events, getPartial);
     }
   } else {
-    timeCalc = [](const EventType &event) { return event.pulseTime(); };
+    return this->splitEventVec([](const EventType &event) { return event.pulseTime(); }, events, getPartial);
   }
-
-  // do the actual event splitting
-  this->splitEventVec(timeCalc, events, partials);
 }
 
-template <typename EventType>
-void TimeSplitter::splitEventVec(const std::function<const DateAndTime(const EventType &)> &timeCalc,
-                                 const std::vector<EventType> &events, std::map<int, EventList *> &partials) const {
+/**
+ * Distribute a list of events, sorted by the time given by timeCalc, in two steps. The first walks the events and the
+ * splitting intervals together to find the range of events going to each destination. The second reserves the final
+ * size of each partial list of events and appends every range with one copy.
+ * @return the partial event lists that received events
+ */
+template <typename EventType, typename TimeCalc>
+std::vector<EventList *> TimeSplitter::splitEventVec(const TimeCalc &timeCalc, const std::vector<EventType> &events,
+                                                     const std::function<EventList *(const int)> &getPartial) const {
   // get a reference of the splitters as a vector
   const auto &splittersVec = getSplittingIntervals(true);
 
@@ -606,24 +647,42 @@ void TimeSplitter::splitEventVec(const std::function<const DateAndTime(const Eve
   const auto itSplitterEnd = splittersVec.cend();
 
   // initialize iterator over the events
-  auto itEvent = events.cbegin();
+  const auto itEventBegin = events.cbegin();
+  auto itEvent = itEventBegin;
   const auto itEventEnd = events.cend();
 
-  // copy all events before first splitter to NO_TARGET
-  auto partial = partials.find(TimeSplitter::NO_TARGET);
+  // the [begin, end) ranges of events going to each partial
+  struct EventRange {
+    EventList *partial;
+    std::size_t begin;
+    std::size_t end;
+  };
+  std::vector<EventRange> ranges;
+  // the partial list of the most recent destination, as consecutive splitters often share one
+  int lastDestination{TimeSplitter::NO_TARGET};
+  EventList *lastPartial = getPartial(TimeSplitter::NO_TARGET);
+  const auto addRange = [&](const int destination, const std::size_t begin, const std::size_t end) {
+    if (begin == end)
+      return;
+    if (destination != lastDestination) {
+      lastDestination = destination;
+      lastPartial = getPartial(destination);
+    }
+    if (lastPartial)
+      ranges.push_back({lastPartial, begin, end});
+  };
+  const auto position = [&itEventBegin](const auto &it) { return static_cast<std::size_t>(it - itEventBegin); };
+
+  // all events before first splitter go to NO_TARGET
   {
     const auto stop = itSplitter->start();
-    const bool shouldAppend = (partial != partials.end());
-    while (itEvent != itEventEnd && timeCalc(*itEvent) < stop) {
-      if (shouldAppend)
-        partial->second->addEventQuickly(*itEvent); // emplaces a copy of *itEvent in partial
-      // advance event iterator
+    while (itEvent != itEventEnd && timeCalc(*itEvent) < stop)
       itEvent++;
-    }
+    addRange(TimeSplitter::NO_TARGET, 0, position(itEvent));
   }
 
   // iterate over all events. For each event try finding its destination event list, a.k.a. partial.
-  // If the partial is found, append the event to it. It is assumed events are sorted by (possibly corrected) time
+  // It is assumed events are sorted by (possibly corrected) time
   while (itEvent != itEventEnd && itSplitter != itSplitterEnd) {
     // Check if we need to advance the splitter and therefore select a different partial event list
     const auto eventTime = timeCalc(*itEvent);
@@ -647,35 +706,36 @@ void TimeSplitter::splitEventVec(const std::function<const DateAndTime(const Eve
     if (itSplitter == itSplitterEnd)
       break;
 
-    // determine the new stop time and destination
-    const int destination = itSplitter->index();
+    // find the events up to the end of the roi
     const auto stop = itSplitter->stop();
-
-    // find the new partial to add to
-    partial = partials.find(destination);
-
-    // loop over events up to the end of the roi
-    const bool shouldAppend = (partial != partials.end());
-    while (itEvent != itEventEnd && timeCalc(*itEvent) < stop) {
-      if (shouldAppend)
-        partial->second->addEventQuickly(*itEvent); // emplaces a copy of *itEvent in partial
-      // advance event iterator
+    const auto begin = position(itEvent);
+    while (itEvent != itEventEnd && timeCalc(*itEvent) < stop)
       itEvent++;
-    }
+    addRange(itSplitter->index(), begin, position(itEvent));
 
     // increment to the next interval
     itSplitter++;
   }
 
-  // copy all events after last splitter to NO_TARGET
-  if (itEvent != itEventEnd) {
-    partial = partials.find(TimeSplitter::NO_TARGET);
-    if (partial != partials.end()) {
-      for (; itEvent != itEventEnd; ++itEvent) {
-        partial->second->addEventQuickly(*itEvent); // emplaces a copy of *itEvent in partial
-      }
-    }
+  // all events after last splitter go to NO_TARGET
+  addRange(TimeSplitter::NO_TARGET, position(itEvent), events.size());
+
+  // reserve the final size of each partial so the copies below never reallocate
+  std::unordered_map<EventList *, std::size_t> sizes;
+  for (const auto &range : ranges) {
+    auto size = sizes.try_emplace(range.partial, range.partial->getNumberEvents()).first;
+    size->second += range.end - range.begin;
   }
+  for (const auto &[partial, size] : sizes)
+    partial->reserve(size);
+
+  for (const auto &range : ranges)
+    range.partial->addEventsQuickly(itEventBegin + range.begin, itEventBegin + range.end);
+
+  std::vector<EventList *> filled;
+  filled.reserve(sizes.size());
+  std::transform(sizes.cbegin(), sizes.cend(), std::back_inserter(filled), [](const auto &size) { return size.first; });
+  return filled;
 }
 
 /**
@@ -0,0 +1,236 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidDataObjects/EventList.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
+#include "MantidKernel/DateAndTime.h"
+
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+EventList createEventList(const EventType eventType, const size_t numEvents) {
+  EventList eventList;
+  for (size_t i = 0; i < numEvents; ++i) {
+    // time-of-flight is not sorted
+    const auto tof = static_cast<double>((i * 7919) % numEvents) + 0.5;
+    eventList += TofEvent(tof, DateAndTime(static_cast<int64_t>(i * 1000)));
+  }
+  if (eventType != EventType::TOF) {
+    eventList.switchTo(EventType::WEIGHTED);
+    eventList *= 2.; // make the weights interesting
+  }
+  if (eventType == EventType::WEIGHTED_NOTIME)
+    eventList.switchTo(EventType::WEIGHTED_NOTIME);
+  return eventList;
+}
+
+MantidVec createBinEdges(const double xmin, const double step, const double xmax) {
+  MantidVec X;
+  for (double x = xmin; x <= xmax; x += step)
+    X.emplace_back(x);
+  return X;
+}
+} // namespace
+
+class EventColumnsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventColumnsTest *createSuite() { return new EventColumnsTest(); }
+  static void destroySuite(EventColumnsTest *suite) { delete suite; }
+
+  void test_empty() {
+    EventColumns columns;
+    TS_ASSERT(columns.empty());
+    TS_ASSERT_EQUALS(columns.size(), 0);
+    TS_ASSERT_EQUALS(columns.getEventType(), EventType::TOF);
+  }
+
+  void test_columns_filled_by_event_type() {
+    const EventColumns tofColumns(createEventList(EventType::TOF, 10));
+    TS_ASSERT_EQUALS(tofColumns.tofs().size(), 10);
+    TS_ASSERT_EQUALS(tofColumns.pulseTimes().size(), 10);
+    TS_ASSERT(tofColumns.weights().empty());
+    TS_ASSERT(tofColumns.errorSquareds().empty());
+
+    const EventColumns weightedColumns(createEventList(EventType::WEIGHTED, 10));
+    TS_ASSERT_EQUALS(weightedColumns.pulseTimes().size(), 10);
+    TS_ASSERT_EQUALS(weightedColumns.weights().size(), 10);
+    TS_ASSERT_EQUALS(weightedColumns.weights()[0], 2.);
+    TS_ASSERT_EQUALS(weightedColumns.errorSquareds()[0], 4.);
+
+    const EventColumns noTimeColumns(createEventList(EventType::WEIGHTED_NOTIME, 10));
+    TS_ASSERT(noTimeColumns.pulseTimes().empty());
+    TS_ASSERT_EQUALS(noTimeColumns.weights().size(), 10);
+  }
+
+  void test_round_trip() {
+    for (const auto eventType : {EventType::TOF, EventType::WEIGHTED, EventType::WEIGHTED_NOTIME}) {
+      const auto original = createEventList(eventType, 100);
+      const EventColumns columns(original);
+      TS_ASSERT_EQUALS(columns.getEventType(), eventType);
+      TS_ASSERT_EQUALS(columns.size(), 100);
+
+      EventList copy;
+      columns.copyTo(copy);
+      TS_ASSERT_EQUALS(copy.getEventType(), eventType);
+      TS_ASSERT(copy.equals(original, 0., 0., 0));
+    }
+  }
+
+  void test_convertTof() {
+    auto eventList = createEventList(EventType::WEIGHTED, 100);
+    EventColumns columns(eventList);
+    columns.convertTof(2.5, 1.);
+    eventList.convertTof(2.5, 1.);
+    TS_ASSERT_EQUALS(columns.tofs(), eventList.getTofs());
+  }
+
+  void test_maskTof() {
+    for (const auto eventType : {EventType::TOF, EventType::WEIGHTED, EventType::WEIGHTED_NOTIME}) {
+      auto eventList = createEventList(eventType, 100);
+      EventColumns columns(eventList);
+      TS_ASSERT_EQUALS(columns.maskTof(10.5, 20.5), 11);
+      eventList.maskTof(10.5, 20.5);
+      TS_ASSERT_EQUALS(columns.size(), eventList.getNumberEvents());
+
+      // the order of the remaining events is unchanged
+      TS_ASSERT(std::none_of(columns.tofs().cbegin(), columns.tofs().cend(),
+                             [](const auto tof) { return tof >= 10.5 && tof <= 20.5; }));
+      TS_ASSERT_EQUALS(columns.tofs().front(), 0.5);
+      TS_ASSERT_EQUALS(columns.tofs()[1], 38.5); // 7919 % 100 = 19 is masked, 2 * 7919 % 100 = 38
+    }
+    EventColumns columns;
+    TS_ASSERT_THROWS(columns.maskTof(20., 10.), const std::runtime_error &);
+  }
+
+  void test_filterByPulseTime() {
+    const DateAndTime start(static_cast<int64_t>(20000));
+    const DateAndTime stop(static_cast<int64_t>(50000));
+    for (const auto eventType : {EventType::TOF, EventType::WEIGHTED}) {
+      const auto eventList = createEventList(eventType, 100);
+      EventList expected;
+      eventList.filterByPulseTime(start, stop, expected);
+
+      const EventColumns columns(eventList);
+      EventColumns filtered;
+      columns.filterByPulseTime(start, stop, filtered);
+      TS_ASSERT_EQUALS(filtered.getEventType(), eventType);
+      TS_ASSERT_EQUALS(filtered.size(), 30);
+      EventList copy;
+      filtered.copyTo(copy);
+      TS_ASSERT(copy.equals(expected, 0., 0., 0));
+      EventColumns inPlace(eventList);
+      TS_ASSERT_THROWS(inPlace.filterByPulseTime(start, stop, inPlace), const std::invalid_argument &);
+    }
+    const EventColumns noTimeColumns(createEventList(EventType::WEIGHTED_NOTIME, 10));
+    EventColumns filtered;
+    TS_ASSERT_THROWS(noTimeColumns.filterByPulseTime(start, stop, filtered), const std::runtime_error &);
+  }
+
+  void test_generateHistogram() {
+    const auto X = createBinEdges(0., 5., 80.);
+    for (const auto eventType : {EventType::TOF, EventType::WEIGHTED, EventType::WEIGHTED_NOTIME}) {
+      const auto eventList = createEventList(eventType, 100);
+      const EventColumns columns(eventList);
+
+      MantidVec Y_expected, E_expected;
+      eventList.generateHistogram(X, Y_expected, E_expected);
+
+      MantidVec Y, E;
+      columns.generateHistogram(X, Y, E);
+      TS_ASSERT_EQUALS(Y, Y_expected);
+      TS_ASSERT_EQUALS(E, E_expected);
+
+      // the same using the bin step
+      columns.generateHistogram(5., X, Y, E);
+      TS_ASSERT_EQUALS(Y, Y_expected);
+      TS_ASSERT_EQUALS(E, E_expected);
+    }
+  }
+
+  void test_workspace_round_trip() {
+    auto workspace = WorkspaceCreationHelper::createEventWorkspace(10, 20, 30);
+    const auto numEvents = workspace->getNumberEvents();
+    auto columns = toEventColumns(*workspace);
+    TS_ASSERT_EQUALS(columns.size(), workspace->getNumberHistograms());
+
+    for (auto &spectrum : columns)
+      spectrum.convertTof(2.);
+    fromEventColumns(columns, *workspace);
+    TS_ASSERT_EQUALS(workspace->getNumberEvents(), numEvents);
+    TS_ASSERT_EQUALS(workspace->getSpectrum(0).getTofs(), columns[0].tofs());
+
+    columns.pop_back();
+    TS_ASSERT_THROWS(fromEventColumns(columns, *workspace), const std::invalid_argument &);
+  }
+};
+
+/** Compare the operations that only use the time-of-flight for EventList (array of structs) and EventColumns
+ * (structure of arrays). These are the operations at the heart of ConvertUnits, MaskBins, Rebin and, for the pulse
+ * time, FilterEvents.
+ */
+class EventColumnsTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventColumnsTestPerformance *createSuite() { return new EventColumnsTestPerformance(); }
+  static void destroySuite(EventColumnsTestPerformance *suite) { delete suite; }
+
+  EventColumnsTestPerformance() : m_X(createBinEdges(0., 10., static_cast<double>(NUM_EVENTS))) {}
+
+  void setUp() override {
+    m_eventList = createEventList(EventType::WEIGHTED, NUM_EVENTS);
+    m_columns = EventColumns(m_eventList);
+  }
+
+  void test_convertTof_EventList() { m_eventList.convertTof(1.5, 2.); }
+
+  void test_convertTof_EventColumns() { m_columns.convertTof(1.5, 2.); }
+
+  void test_maskTof_EventList() { m_eventList.maskTof(1000., 2000.); }
+
+  void test_maskTof_EventColumns() { m_columns.maskTof(1000., 2000.); }
+
+  void test_generateHistogram_EventList() {
+    MantidVec Y, E;
+    m_eventList.generateHistogram(10., m_X, Y, E);
+  }
+
+  void test_generateHistogram_EventColumns() {
+    MantidVec Y, E;
+    m_columns.generateHistogram(10., m_X, Y, E);
+  }
+
+  void test_filterByPulseTime_EventList() {
+    EventList output;
+    m_eventList.filterByPulseTime(m_start, m_stop, output);
+  }
+
+  void test_filterByPulseTime_EventColumns() {
+    EventColumns output;
+    m_columns.filterByPulseTime(m_start, m_stop, output);
+  }
+
+private:
+  static constexpr size_t NUM_EVENTS{10000000};
+  const MantidVec m_X;
+  const DateAndTime m_start{static_cast<int64_t>(NUM_EVENTS / 4 * 1000)};
+  const DateAndTime m_stop{static_cast<int64_t>(NUM_EVENTS / 2 * 1000)};
+  EventList m_eventList;
+  EventColumns m_columns;
+};
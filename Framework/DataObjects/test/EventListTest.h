@@ -2167,6 +2167,46 @@ public:
     // last value
   }
 
+  void test_getTofsView() {
+    // Go through each possible EventType as the input
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_uniform_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      const auto tofs = el.getTofs();
+      const auto view = el.getTofsView();
+      TSM_ASSERT_EQUALS(this_type, view.size, tofs.size());
+      const auto *bytes = reinterpret_cast<const char *>(view.data);
+      for (size_t i = 0; i < view.size; ++i)
+        TSM_ASSERT_EQUALS(this_type, *reinterpret_cast<const double *>(bytes + i * view.stride), tofs[i]);
+    }
+
+    EventList empty;
+    TS_ASSERT_EQUALS(empty.getTofsView().size, 0);
+    TS_ASSERT(!empty.getTofsView().data);
+  }
+
+  void test_getWeightsView_and_getErrorSquaredView() {
+    fake_data();
+    TS_ASSERT_THROWS(el.getWeightsView(), const std::runtime_error &);
+    TS_ASSERT_THROWS(el.getErrorSquaredView(), const std::runtime_error &);
+
+    // weighted data test data has 2.0 uniform weights and 2.5 uniform errors
+    fake_uniform_data_weights();
+    auto weights = el.getWeightsView();
+    auto errorSquared = el.getErrorSquaredView();
+    TS_ASSERT_EQUALS(weights.size, el.getNumberEvents());
+    TS_ASSERT_EQUALS(weights.stride, static_cast<std::ptrdiff_t>(sizeof(WeightedEvent)));
+    TS_ASSERT_DELTA(*weights.data, 2.0, 0.000001);
+    TS_ASSERT_DELTA(*errorSquared.data, 2.5 * 2.5, 0.000001);
+
+    // compress the events to no time weighted events
+    el.compressEvents(0, &el);
+    weights = el.getWeightsView();
+    TS_ASSERT_EQUALS(weights.size, el.getNumberEvents());
+    TS_ASSERT_EQUALS(weights.stride, static_cast<std::ptrdiff_t>(sizeof(WeightedEventNoTime)));
+    TS_ASSERT_DELTA(*weights.data, 2.0, 0.000001);
+  }
+
   void test_compressEvents_log() {
     this->fake_uniform_data(10000.);
 
@@ -0,0 +1,251 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/EventWorkspaceFileBacking.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
+
+#include <filesystem>
+#include <thread>
+
+using namespace Mantid::DataObjects;
+using Mantid::Types::Event::TofEvent;
+
+class EventWorkspaceFileBackingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventWorkspaceFileBackingTest *createSuite() { return new EventWorkspaceFileBackingTest(); }
+  static void destroySuite(EventWorkspaceFileBackingTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_directory = std::filesystem::temp_directory_path() / "EventWorkspaceFileBackingTest";
+    std::filesystem::create_directories(m_directory);
+  }
+
+  void tearDown() override { std::filesystem::remove_all(m_directory); }
+
+  void test_setFileBacked_writes_out_all_events() {
+    auto ws = createWorkspace();
+    ws->setFileBacked(m_directory.string(), 0);
+
+    TS_ASSERT(ws->isFileBacked());
+    const auto *backing = ws->getFileBacking();
+    TS_ASSERT(std::filesystem::exists(backing->filename()));
+    TS_ASSERT_EQUALS(std::filesystem::path(backing->filename()).parent_path(), m_directory);
+    for (size_t i = 0; i < NUMPIXELS; ++i)
+      TS_ASSERT(!backing->isInMemory(i));
+    TS_ASSERT_EQUALS(backing->getMemoryUsed(), 0);
+    TS_ASSERT_EQUALS(backing->getFileSize(), NUMPIXELS * NUMEVENTS * sizeof(TofEvent));
+    // counting the events does not read them back
+    TS_ASSERT_EQUALS(ws->getNumberEvents(), NUMPIXELS * NUMEVENTS);
+    TS_ASSERT(!backing->isInMemory(0));
+    TS_ASSERT_THROWS(ws->setFileBacked(m_directory.string(), 0), const std::runtime_error &);
+  }
+
+  void test_events_are_read_back_on_access() {
+    auto ws = createWorkspace();
+    const auto reference = ws->clone();
+    ws->setFileBacked(m_directory.string(), 0);
+
+    for (size_t i = 0; i < NUMPIXELS; ++i) {
+      TS_ASSERT_EQUALS(ws->getSpectrum(i).getEvents(), reference->getSpectrum(i).getEvents());
+      TS_ASSERT_EQUALS(ws->y(i), reference->y(i));
+    }
+    std::vector<double> integrated;
+    std::vector<double> expected;
+    ws->getIntegratedSpectra(integrated, 0., 0., true);
+    reference->getIntegratedSpectra(expected, 0., 0., true);
+    TS_ASSERT_EQUALS(integrated, expected);
+  }
+
+  void test_least_recently_used_lists_are_written_out() {
+    auto ws = createWorkspace();
+    ws->setFileBacked(m_directory.string(), 0);
+    const auto *backing = ws->getFileBacking();
+
+    for (size_t i = 0; i < NUMPIXELS; ++i)
+      ws->getSpectrum(i);
+    for (size_t i = 0; i < NUMPIXELS; ++i)
+      TS_ASSERT_EQUALS(backing->isInMemory(i), i >= NUMPIXELS - EventWorkspaceFileBacking::MIN_RESIDENT);
+    TS_ASSERT_EQUALS(backing->getMemoryUsed(), EventWorkspaceFileBacking::MIN_RESIDENT * NUMEVENTS * sizeof(TofEvent));
+
+    // using a list again makes it the most recent one
+    ws->getSpectrum(NUMPIXELS - EventWorkspaceFileBacking::MIN_RESIDENT);
+    ws->getSpectrum(0);
+    TS_ASSERT(backing->isInMemory(0));
+    TS_ASSERT(backing->isInMemory(NUMPIXELS - EventWorkspaceFileBacking::MIN_RESIDENT));
+    TS_ASSERT(!backing->isInMemory(NUMPIXELS - EventWorkspaceFileBacking::MIN_RESIDENT + 1));
+  }
+
+  void test_lists_within_the_budget_stay_in_memory() {
+    auto ws = createWorkspace();
+    ws->setFileBacked(m_directory.string(), NUMPIXELS * NUMEVENTS * sizeof(TofEvent));
+    const auto *backing = ws->getFileBacking();
+
+    for (size_t i = 0; i < NUMPIXELS; ++i)
+      ws->getSpectrum(i);
+    for (size_t i = 0; i < NUMPIXELS; ++i)
+      TS_ASSERT(backing->isInMemory(i));
+  }
+
+  void test_list_used_by_another_thread_stays_in_memory() {
+    auto ws = createWorkspace();
+    const auto reference = ws->clone();
+    ws->setFileBacked(m_directory.string(), 0);
+    const auto *backing = ws->getFileBacking();
+
+    const auto &events = ws->getSpectrum(0).getEvents();
+    // another thread uses the same list and then moves on to enough lists to write out the ones it used first
+    std::thread other([&ws]() {
+      for (size_t i = 0; i < NUMPIXELS; ++i)
+        ws->getSpectrum(i);
+    });
+    other.join();
+    TS_ASSERT(backing->isInMemory(0));
+    TS_ASSERT_EQUALS(events, reference->getSpectrum(0).getEvents());
+    TS_ASSERT(!backing->isInMemory(1));
+
+    // once this thread moves on as well the list is written out
+    for (size_t i = 1; i <= EventWorkspaceFileBacking::MIN_RESIDENT; ++i)
+      ws->getSpectrum(i);
+    TS_ASSERT(!backing->isInMemory(0));
+    TS_ASSERT_EQUALS(ws->getSpectrum(0).getEvents(), reference->getSpectrum(0).getEvents());
+  }
+
+  void test_threads_sharing_lists_read_the_right_events() {
+    auto ws = createWorkspace();
+    const auto reference = ws->clone();
+    ws->setFileBacked(m_directory.string(), 0);
+
+    // every thread keeps using list 0 while walking through the others
+    const auto walk = [&ws, &reference](const size_t offset, bool &good) {
+      for (size_t repeat = 0; repeat < 20; ++repeat) {
+        const auto &shared = ws->getSpectrum(0).getEvents();
+        for (size_t i = 1; i < EventWorkspaceFileBacking::MIN_RESIDENT; ++i) {
+          const auto index = 1 + (offset + repeat + i) % (NUMPIXELS - 1);
+          good = good && ws->getSpectrum(index).getEvents() == reference->getSpectrum(index).getEvents();
+        }
+        good = good && shared == reference->getSpectrum(0).getEvents();
+      }
+    };
+    bool good1{true};
+    bool good2{true};
+    std::thread thread1(walk, 0, std::ref(good1));
+    std::thread thread2(walk, NUMPIXELS / 2, std::ref(good2));
+    thread1.join();
+    thread2.join();
+    TS_ASSERT(good1);
+    TS_ASSERT(good2);
+  }
+
+  void test_pinned_lists_stay_in_memory() {
+    auto ws = createWorkspace();
+    ws->setFileBacked(m_directory.string(), 0);
+    const auto *backing = ws->getFileBacking();
+
+    ws->pinSpectrum(0);
+    TS_ASSERT(backing->isPinned(0));
+    for (size_t i = 1; i < NUMPIXELS; ++i)
+      ws->getSpectrum(i);
+    TS_ASSERT(backing->isInMemory(0));
+    TS_ASSERT_EQUALS(backing->getMemoryUsed(),
+                     (EventWorkspaceFileBacking::MIN_RESIDENT + 1) * NUMEVENTS * sizeof(TofEvent));
+
+    // unpinning a list the thread has moved on from writes it out
+    ws->unpinSpectrum(0);
+    TS_ASSERT(!backing->isPinned(0));
+    TS_ASSERT(!backing->isInMemory(0));
+    TS_ASSERT_EQUALS(backing->getMemoryUsed(), EventWorkspaceFileBacking::MIN_RESIDENT * NUMEVENTS * sizeof(TofEvent));
+    TS_ASSERT_THROWS(ws->unpinSpectrum(0), const std::runtime_error &);
+  }
+
+  void test_modified_lists_are_written_back() {
+    auto ws = createWorkspace();
+    ws->setFileBacked(m_directory.string(), 0);
+    const auto *backing = ws->getFileBacking();
+    const auto fileSize = backing->getFileSize();
+
+    // the list grows so it has to move to the end of the file
+    auto &list = ws->getSpectrum(0);
+    list += TofEvent(123.5);
+    // the list shrinks so it stays where it is
+    ws->getSpectrum(1).clear(false);
+    for (size_t i = 2; i < NUMPIXELS; ++i)
+      ws->getSpectrum(i);
+    TS_ASSERT(!backing->isInMemory(0));
+    TS_ASSERT(!backing->isInMemory(1));
+    TS_ASSERT_EQUALS(backing->getFileSize(), fileSize + (NUMEVENTS + 1) * sizeof(TofEvent));
+    TS_ASSERT_EQUALS(ws->getNumberEvents(), NUMPIXELS * NUMEVENTS + 1 - NUMEVENTS);
+
+    const auto &events = ws->getSpectrum(0).getEvents();
+    TS_ASSERT_EQUALS(events.size(), NUMEVENTS + 1);
+    TS_ASSERT_EQUALS(events.back().tof(), 123.5);
+    TS_ASSERT(ws->getSpectrum(1).empty());
+  }
+
+  void test_weighted_events() {
+    auto ws = createWorkspace();
+    ws->setFileBacked(m_directory.string(), 0);
+    ws->switchEventType(Mantid::API::WEIGHTED_NOTIME);
+    ws->getSpectrum(3).getWeightedEventsNoTime()[0] = WeightedEventNoTime(1.5, 2., 4.);
+    for (size_t i = 0; i < NUMPIXELS; ++i)
+      ws->getSpectrum(i);
+    TS_ASSERT(!ws->getFileBacking()->isInMemory(3));
+
+    TS_ASSERT_EQUALS(ws->getEventType(), Mantid::API::WEIGHTED_NOTIME);
+    const auto &events = ws->getSpectrum(3).getWeightedEventsNoTime();
+    TS_ASSERT_EQUALS(events.size(), NUMEVENTS);
+    TS_ASSERT_EQUALS(events[0].tof(), 1.5);
+    TS_ASSERT_EQUALS(events[0].weight(), 2.);
+    TS_ASSERT_EQUALS(events[0].errorSquared(), 4.);
+  }
+
+  void test_clone_has_its_own_scratch_file() {
+    auto ws = createWorkspace();
+    const auto reference = ws->clone();
+    ws->setFileBacked(m_directory.string(), 0);
+    std::string filename;
+    {
+      const auto clone = ws->clone();
+      TS_ASSERT(clone->isFileBacked());
+      filename = clone->getFileBacking()->filename();
+      TS_ASSERT_DIFFERS(filename, ws->getFileBacking()->filename());
+      TS_ASSERT_EQUALS(std::filesystem::path(filename).parent_path(), m_directory);
+      for (size_t i = 0; i < NUMPIXELS; ++i)
+        TS_ASSERT_EQUALS(clone->getSpectrum(i).getEvents(), reference->getSpectrum(i).getEvents());
+    }
+    // the scratch file is removed with the workspace
+    TS_ASSERT(!std::filesystem::exists(filename));
+    TS_ASSERT(std::filesystem::exists(ws->getFileBacking()->filename()));
+  }
+
+  void test_sortAll() {
+    auto ws = WorkspaceCreationHelper::createRandomEventWorkspace(10, NUMPIXELS);
+    ws->setFileBacked(m_directory.string(), 0);
+    ws->sortAll(PULSETIME_SORT, nullptr);
+    for (size_t i = 0; i < NUMPIXELS; ++i) {
+      const auto &events = ws->getSpectrum(i).getEvents();
+      TS_ASSERT(std::is_sorted(events.cbegin(), events.cend(), [](const auto &lhs, const auto &rhs) {
+        return lhs.pulseTime() < rhs.pulseTime();
+      }));
+    }
+  }
+
+private:
+  static constexpr size_t NUMPIXELS{20};
+  static constexpr size_t NUMEVENTS{100};
+
+  EventWorkspace_sptr createWorkspace() {
+    return WorkspaceCreationHelper::createEventWorkspace(static_cast<int>(NUMPIXELS), 10, static_cast<int>(NUMEVENTS));
+  }
+
+  std::filesystem::path m_directory;
+};
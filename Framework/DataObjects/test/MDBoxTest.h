@@ -512,6 +512,59 @@ public:
     dotest_integrateSphereWithInnerRadius(box, 5.6f, 5.0f, 5.0f, 0.7f, 0.4f, false, 2.0);
   }
 
+  void test_integrateSphere_columnarEvents() {
+    BoxController_sptr bc(new BoxController(3));
+    MDBox<MDLeanEvent<3>, 3> box(bc.get());
+    addScatteredEvents(box, 2000);
+    bool dimensionsUsed[3] = {true, false, true};
+    coord_t center[3] = {4.2f, 5.f, 5.7f};
+    CoordTransformDistance sphere(3, center, dimensionsUsed);
+
+    signal_t signal(0.), errorSquared(0.);
+    box.integrateSphere(sphere, 4.f, signal, errorSquared);
+    bc->setColumnarEvents(true);
+    signal_t columnarSignal(0.), columnarErrorSquared(0.);
+    box.integrateSphere(sphere, 4.f, columnarSignal, columnarErrorSquared);
+
+    TS_ASSERT_LESS_THAN(0., signal);
+    TS_ASSERT_EQUALS(columnarSignal, signal);
+    TS_ASSERT_EQUALS(columnarErrorSquared, errorSquared);
+  }
+
+  void test_centroidSphere_columnarEvents() {
+    BoxController_sptr bc(new BoxController(3));
+    MDBox<MDLeanEvent<3>, 3> box(bc.get());
+    addScatteredEvents(box, 2000);
+    bool dimensionsUsed[3] = {true, true, true};
+    coord_t center[3] = {4.2f, 5.f, 5.7f};
+    CoordTransformDistance sphere(3, center, dimensionsUsed);
+
+    coord_t centroid[3] = {0, 0, 0};
+    signal_t signal(0.);
+    box.centroidSphere(sphere, 9.f, centroid, signal);
+    bc->setColumnarEvents(true);
+    coord_t columnarCentroid[3] = {0, 0, 0};
+    signal_t columnarSignal(0.);
+    box.centroidSphere(sphere, 9.f, columnarCentroid, columnarSignal);
+
+    TS_ASSERT_LESS_THAN(0., signal);
+    TS_ASSERT_EQUALS(columnarSignal, signal);
+    for (size_t d = 0; d < 3; ++d)
+      TS_ASSERT_EQUALS(columnarCentroid[d], centroid[d]);
+  }
+
+  /// Add events spread over [0, 10) in each dimension, with varying signal
+  void addScatteredEvents(MDBox<MDLeanEvent<3>, 3> &box, const size_t number) {
+    for (size_t i = 0; i < number; ++i) {
+      MDLeanEvent<3> ev(1.0 + static_cast<double>(i % 5), 0.5 + static_cast<double>(i % 3));
+      const auto x = static_cast<double>(i);
+      ev.setCenter(0, std::fmod(x * 0.37, 10.));
+      ev.setCenter(1, std::fmod(x * 0.11, 10.));
+      ev.setCenter(2, std::fmod(x * 0.73, 10.));
+      box.addEvent(ev);
+    }
+  }
+
   //-----------------------------------------------------------------------------------------
   /** refreshCache() tracks the centroid */
   void test_calculateCentroid() {
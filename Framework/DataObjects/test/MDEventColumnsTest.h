@@ -0,0 +1,181 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/CoordTransformAffine.h"
+#include "MantidDataObjects/CoordTransformAligned.h"
+#include "MantidDataObjects/CoordTransformDistance.h"
+#include "MantidDataObjects/MDEventColumns.h"
+#include "MantidDataObjects/MDLeanEvent.h"
+#include "MantidKernel/Matrix.h"
+
+#include <cmath>
+#include <numeric>
+
+using namespace Mantid;
+using namespace Mantid::DataObjects;
+using Mantid::Kernel::Matrix;
+
+class MDEventColumnsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDEventColumnsTest *createSuite() { return new MDEventColumnsTest(); }
+  static void destroySuite(MDEventColumnsTest *suite) { delete suite; }
+
+  void test_gather_copies_events_in_blocks() {
+    const auto events = createEvents(COLUMNS::BLOCK_SIZE + 10);
+    auto &columns = COLUMNS::threadLocal();
+
+    TS_ASSERT_EQUALS(columns.gather(events, 0), COLUMNS::BLOCK_SIZE);
+    TS_ASSERT_EQUALS(columns.size(), COLUMNS::BLOCK_SIZE);
+    TS_ASSERT_EQUALS(columns.gather(events, COLUMNS::BLOCK_SIZE), events.size());
+    TS_ASSERT_EQUALS(columns.size(), 10);
+    for (size_t i = 0; i < columns.size(); ++i) {
+      const auto &event = events[COLUMNS::BLOCK_SIZE + i];
+      for (size_t d = 0; d < 3; ++d)
+        TS_ASSERT_EQUALS(columns.coordinates(d)[i], event.getCenter(d));
+      TS_ASSERT_EQUALS(columns.signals()[i], event.getSignal());
+      TS_ASSERT_EQUALS(columns.errorsSquared()[i], event.getErrorSquared());
+    }
+  }
+
+  void test_aligned_transform_matches_apply() {
+    const std::vector<size_t> dimensions{2, 0};
+    const std::vector<coord_t> origin{-1.5f, 0.25f};
+    const std::vector<coord_t> scaling{3.f, 0.7f};
+    const CoordTransformAligned transform(3, 2, dimensions, origin, scaling);
+
+    const MDColumnTransform columnTransform(transform);
+    TS_ASSERT(columnTransform.isAligned());
+    checkTransform(transform, columnTransform);
+  }
+
+  void test_affine_transform_matches_apply() {
+    CoordTransformAffine transform(3, 2);
+    Matrix<coord_t> matrix(3, 4);
+    matrix[0][0] = 0.6f;
+    matrix[0][1] = -0.8f;
+    matrix[0][3] = 2.5f;
+    matrix[1][0] = 0.8f;
+    matrix[1][1] = 0.6f;
+    matrix[1][2] = 1.3f;
+    matrix[1][3] = -0.1f;
+    matrix[2][3] = 1.f;
+    transform.setMatrix(matrix);
+
+    const MDColumnTransform columnTransform(transform);
+    TS_ASSERT(!columnTransform.isAligned());
+    checkTransform(transform, columnTransform);
+  }
+
+  void test_transform_without_affine_form_throws() {
+    const coord_t centre[3] = {0.f, 1.f, 2.f};
+    const bool used[3] = {true, true, true};
+    const CoordTransformDistance transform(3, centre, used);
+    TS_ASSERT_THROWS(MDColumnTransform{transform}, const std::runtime_error &);
+  }
+
+  void test_transform_with_wrong_dimensions_throws() {
+    const CoordTransformAffine transform(2, 2);
+    const MDColumnTransform columnTransform(transform);
+    auto &columns = COLUMNS::threadLocal();
+    columns.gather(createEvents(5), 0);
+    TS_ASSERT_THROWS(columns.transform(columnTransform), const std::invalid_argument &);
+  }
+
+  void test_distanceSquared_matches_apply() {
+    const coord_t centre[3] = {0.5f, -1.f, 2.f};
+    const bool used[3] = {true, false, true};
+    const CoordTransformDistance transform(3, centre, used);
+    TS_ASSERT(transform.isSphere());
+    const auto events = createEvents(100);
+    auto &columns = COLUMNS::threadLocal();
+    columns.gather(events, 0);
+
+    columns.distanceSquared(transform.getCenter().data(), transform.getDimensionsUsed());
+
+    for (size_t i = 0; i < events.size(); ++i) {
+      coord_t expected;
+      transform.apply(events[i].getCenter(), &expected);
+      TS_ASSERT_EQUALS(columns.results(0)[i], expected);
+    }
+  }
+
+  void test_bin_matches_per_event_binning() {
+    const std::vector<size_t> dimensions{0, 1};
+    const std::vector<coord_t> origin{-5.f, -5.f};
+    const std::vector<coord_t> scaling{1.f, 2.f};
+    const CoordTransformAligned transform(3, 2, dimensions, origin, scaling);
+    const size_t chunkMin[2] = {2, 0};
+    const size_t chunkMax[2] = {7, 20};
+    const size_t indexMultiplier[2] = {1, 10};
+    const auto events = createEvents(1000);
+
+    std::vector<signal_t> signals(200, 0.), errors(200, 0.), numEvents(200, 0.);
+    auto &columns = COLUMNS::threadLocal();
+    for (size_t next = 0; next < events.size();) {
+      next = columns.gather(events, next);
+      columns.transform(MDColumnTransform(transform));
+      columns.bin(chunkMin, chunkMax, indexMultiplier, signals.data(), errors.data(), numEvents.data());
+    }
+
+    std::vector<signal_t> expectedSignals(200, 0.), expectedErrors(200, 0.), expectedNumEvents(200, 0.);
+    for (const auto &event : events) {
+      coord_t out[2];
+      transform.apply(event.getCenter(), out);
+      if (out[0] < 0 || out[1] < 0)
+        continue;
+      const auto ix = static_cast<size_t>(out[0]);
+      const auto iy = static_cast<size_t>(out[1]);
+      if (ix < chunkMin[0] || ix >= chunkMax[0] || iy < chunkMin[1] || iy >= chunkMax[1])
+        continue;
+      expectedSignals[ix + 10 * iy] += event.getSignal();
+      expectedErrors[ix + 10 * iy] += event.getErrorSquared();
+      expectedNumEvents[ix + 10 * iy] += 1.;
+    }
+    TS_ASSERT_EQUALS(signals, expectedSignals);
+    TS_ASSERT_EQUALS(errors, expectedErrors);
+    TS_ASSERT_EQUALS(numEvents, expectedNumEvents);
+    // some events are outside the chunk
+    TS_ASSERT_LESS_THAN(std::accumulate(numEvents.cbegin(), numEvents.cend(), 0.), 1000.);
+    TS_ASSERT_LESS_THAN(0., std::accumulate(numEvents.cbegin(), numEvents.cend(), 0.));
+  }
+
+private:
+  using COLUMNS = MDEventColumns<3>;
+
+  /// Events spread over [-5, 5) in each dimension with varying signal
+  static std::vector<MDLeanEvent<3>> createEvents(const size_t number) {
+    std::vector<MDLeanEvent<3>> events;
+    events.reserve(number);
+    for (size_t i = 0; i < number; ++i) {
+      const auto x = static_cast<coord_t>(i);
+      const coord_t centre[3] = {std::fmod(x * 0.37f, 10.f) - 5.f, std::fmod(x * 0.11f, 10.f) - 5.f,
+                                 std::fmod(x * 0.73f, 10.f) - 5.f};
+      events.emplace_back(1.f + static_cast<float>(i % 7), 0.5f + static_cast<float>(i % 3), centre);
+    }
+    return events;
+  }
+
+  void checkTransform(const Mantid::API::CoordTransform &transform, const MDColumnTransform &columnTransform) {
+    const auto events = createEvents(COLUMNS::BLOCK_SIZE);
+    auto &columns = COLUMNS::threadLocal();
+    columns.gather(events, 0);
+
+    columns.transform(columnTransform);
+
+    for (size_t i = 0; i < events.size(); ++i) {
+      coord_t expected[2];
+      transform.apply(events[i].getCenter(), expected);
+      TS_ASSERT_DELTA(columns.results(0)[i], expected[0], 1e-5);
+      TS_ASSERT_DELTA(columns.results(1)[i], expected[1], 1e-5);
+    }
+  }
+};
@@ -126,4 +126,21 @@ public:
     TS_ASSERT_EQUALS(integerC, result[2]);
     TS_ASSERT_EQUALS(integerD, result[3]);
   }
+
+  void test_BitInterleaving64BitTest_Interleave_2_32_64() {
+    const uint64_t res = interleave<2, uint32_t, uint64_t>({integerA, integerB});
+
+    TS_ASSERT_EQUALS(interleaved2D, res);
+  }
+
+  void test_BitInterleaving64BitTest_Deinterleave_2_32_64() {
+    const auto result = deinterleave<2, uint32_t, uint64_t>(interleaved2D);
+
+    TS_ASSERT_EQUALS(integerA, result[0]);
+    TS_ASSERT_EQUALS(integerB, result[1]);
+  }
+
+private:
+  const uint64_t interleaved2D =
+      bit_string_to_int<uint64_t>("0100010001000100010001000100010011101110111011101110111011101110");
 };
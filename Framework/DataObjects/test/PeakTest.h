@@ -273,6 +273,26 @@ public:
     TS_ASSERT_THROWS_ANYTHING(p.setGoniometerMatrix(mat2));
   }
 
+  void test_copies_share_goniometer_rotation_until_it_is_changed() {
+    Peak p(inst, 10000, 2.0);
+    Matrix<double> mat(3, 3);
+    mat[0][0] = 1.0;
+    mat[1][2] = 1.0;
+    mat[2][1] = 1.0;
+    p.setGoniometerMatrix(mat);
+    Peak p2(p);
+    TS_ASSERT_EQUALS(&p.getInverseGoniometerMatrix(), &p2.getInverseGoniometerMatrix());
+
+    p2.setGoniometerMatrix(Matrix<double>(3, 3, true));
+    TS_ASSERT_EQUALS(p.getGoniometerMatrix(), mat);
+    TS_ASSERT_EQUALS(p2.getGoniometerMatrix(), Matrix<double>(3, 3, true));
+
+    Peak p3(inst, 10000, 2.0, V3D(1, 0, 0), mat);
+    TS_ASSERT(!p3.shareGoniometerWith(p2));
+    TS_ASSERT(p3.shareGoniometerWith(p));
+    TS_ASSERT_EQUALS(&p.getInverseGoniometerMatrix(), &p3.getInverseGoniometerMatrix());
+  }
+
   void test_HKL() {
     Peak p(inst, 10000, 2.0);
     p.setHKL(1.0, 2.0, 3.0);
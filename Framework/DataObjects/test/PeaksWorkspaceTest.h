@@ -197,6 +197,57 @@ public:
     TS_ASSERT_DELTA(pw->getPeak(4).getWavelength(), 5.0, 1e-5);
   }
 
+  void test_sort_by_bank_name() {
+    auto pw = buildPW();
+    const auto inst = pw->getInstrument();
+    pw->getPeak(0).setBankName("bank2");
+    for (const auto &bankName : {"bank10", "bank1", "bank2"}) {
+      Peak p(inst, 1, 4.0);
+      p.setBankName(bankName);
+      pw->addPeak(p);
+    }
+
+    // Sort by descending bank name then ascending wavelength
+    std::vector<std::pair<std::string, bool>> criteria{{"BankName", false}, {"wavelength", true}};
+    pw->sort(criteria);
+    TS_ASSERT_EQUALS(pw->getPeak(0).getBankName(), "bank2");
+    TS_ASSERT_DELTA(pw->getPeak(0).getWavelength(), 3.0, 1e-5);
+    TS_ASSERT_EQUALS(pw->getPeak(1).getBankName(), "bank2");
+    TS_ASSERT_DELTA(pw->getPeak(1).getWavelength(), 4.0, 1e-5);
+    TS_ASSERT_EQUALS(pw->getPeak(2).getBankName(), "bank10");
+    TS_ASSERT_EQUALS(pw->getPeak(3).getBankName(), "bank1");
+  }
+
+  void test_added_peaks_share_goniometer_rotation() {
+    auto pw = buildPW();
+    const auto inst = pw->getInstrument();
+    Goniometer goniometer;
+    goniometer.makeUniversalGoniometer();
+    goniometer.setRotationAngle("phi", 30.);
+    const auto rotation = goniometer.getR();
+    for (int i = 0; i < 3; ++i) {
+      Peak p(inst, 1, 3.0 + i);
+      p.setGoniometerMatrix(rotation);
+      pw->addPeak(p);
+    }
+    goniometer.setRotationAngle("phi", 60.);
+    Peak other(inst, 1, 3.0);
+    other.setGoniometerMatrix(goniometer.getR());
+    pw->addPeak(std::move(other));
+
+    const auto *shared = &pw->getPeak(1).getInverseGoniometerMatrix();
+    TS_ASSERT_EQUALS(&pw->getPeak(2).getInverseGoniometerMatrix(), shared);
+    TS_ASSERT_EQUALS(&pw->getPeak(3).getInverseGoniometerMatrix(), shared);
+    TS_ASSERT_DIFFERS(&pw->getPeak(4).getInverseGoniometerMatrix(), shared);
+    TS_ASSERT_EQUALS(pw->getPeak(4).getGoniometerMatrix(), goniometer.getR());
+
+    // changing the rotation of one peak leaves the others alone
+    pw->getPeak(2).setGoniometerMatrix(goniometer.getR());
+    TS_ASSERT_EQUALS(pw->getPeak(1).getGoniometerMatrix(), rotation);
+    TS_ASSERT_EQUALS(pw->getPeak(2).getGoniometerMatrix(), goniometer.getR());
+    TS_ASSERT_EQUALS(pw->getPeak(3).getGoniometerMatrix(), rotation);
+  }
+
   void test_Save_Unmodified_PeaksWorkspace_Nexus() {
     auto testPWS = createSaveTestPeaksWorkspace();
     NexusTestHelper nexusHelper(true);
@@ -662,3 +713,33 @@ private:
     TS_ASSERT_EQUALS("DetectorID", column1->name());
   }
 };
+
+class PeaksWorkspaceTestPerformance : public CxxTest::TestSuite {
+public:
+  static PeaksWorkspaceTestPerformance *createSuite() { return new PeaksWorkspaceTestPerformance(); }
+  static void destroySuite(PeaksWorkspaceTestPerformance *suite) { delete suite; }
+
+  void setUp() override {
+    m_pw = buildPW();
+    const auto inst = m_pw->getInstrument();
+    Goniometer goniometer;
+    goniometer.makeUniversalGoniometer();
+    for (int i = 0; i < 200000; ++i) {
+      if (i % 1000 == 0)
+        goniometer.setRotationAngle("phi", i / 1000);
+      Peak p(inst, i % 100, 1.0 + (i * 7919 % 1000) * 1e-3);
+      p.setGoniometerMatrix(goniometer.getR());
+      p.setRunNumber(i / 1000);
+      m_pw->addPeak(std::move(p));
+    }
+  }
+
+  void test_sort() {
+    std::vector<std::pair<std::string, bool>> criteria{{"RunNumber", false}, {"detid", true}, {"wavelength", true}};
+    m_pw->sort(criteria);
+    TS_ASSERT_EQUALS(m_pw->getPeak(0).getRunNumber(), 199);
+  }
+
+private:
+  PeaksWorkspace_sptr m_pw;
+};
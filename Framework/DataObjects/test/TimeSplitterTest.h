@@ -865,6 +865,39 @@ public:
     TS_ASSERT(timesToStr(partials[TimeSplitter::NO_TARGET], EventSortType::PULSETIMETOF_SORT) == expected);
   }
 
+  void test_splitEventListWithPartialLookup() {
+    // six events, one every 30 seconds
+    const DateAndTime startTime{TWO};
+    EventList events = this->generateEvents(startTime, 60., 3, 2, EventType::WEIGHTED);
+    // interval ["2023-Jan-01 12:00:00", "2023-Jan-01 12:01:00") with destination 0
+    // interval ["2023-Jan-01 12:01:00", "2023-Jan-01 12:01:45") with destination 1
+    // interval ["2023-Jan-01 12:01:45", "2023-Jan-01 12:02:00") with destination 2
+    // interval ["2023-Jan-01 12:02:00", "2023-Jan-01 12:02:20") with destination 0
+    TimeSplitter splitter = this->generateSplitter(startTime, {60, 45, 15, 20}, {0, 1, 2, 0});
+
+    EventList partial0, partial1;
+    partial0.switchTo(EventType::WEIGHTED);
+    partial1.switchTo(EventType::WEIGHTED);
+    std::vector<int> requested;
+    // destination 2 and the events outside of the splitter are dropped
+    const auto getPartial = [&](const int destination) -> EventList * {
+      requested.emplace_back(destination);
+      if (destination == 0)
+        return &partial0;
+      return destination == 1 ? &partial1 : nullptr;
+    };
+    const bool pulseTof{true};
+    splitter.splitEventList(events, getPartial, pulseTof);
+
+    std::vector<std::string> expected{"2023-Jan-01 12:00:00", "2023-Jan-01 12:00:30", "2023-Jan-01 12:02:00"};
+    TS_ASSERT_EQUALS(timesToStr(&partial0, EventSortType::PULSETIMETOF_SORT), expected);
+    expected = {"2023-Jan-01 12:01:00", "2023-Jan-01 12:01:30"};
+    TS_ASSERT_EQUALS(timesToStr(&partial1, EventSortType::PULSETIMETOF_SORT), expected);
+    TS_ASSERT_EQUALS(partial0.getSortType(), EventSortType::PULSETIMETOF_SORT);
+    // destination 2 receives no events so it is never looked up
+    TS_ASSERT_EQUALS(std::count(requested.cbegin(), requested.cend(), 2), 0);
+  }
+
   void test_copyAndAssignment() {
     // Create a small table workspace with some targets
     // By design, for a table workspace all times must be in seconds
@@ -973,3 +1006,46 @@ public:
     }
   }
 };
+
+class TimeSplitterTestPerformance : public CxxTest::TestSuite {
+public:
+  static TimeSplitterTestPerformance *createSuite() { return new TimeSplitterTestPerformance(); }
+  static void destroySuite(TimeSplitterTestPerformance *suite) { delete suite; }
+
+  TimeSplitterTestPerformance() {
+    // 2000 one second slices cycling over 1000 destinations, and events every millisecond
+    DateAndTime start{TWO};
+    for (int i = 0; i < 2000; ++i) {
+      m_splitter.addROI(start, start + 1.0, i % NUM_DESTINATIONS);
+      start += 1.0;
+    }
+    DateAndTime pulseTime{TWO};
+    for (int i = 0; i < 2000000; ++i) {
+      m_events.addEventQuickly(TofEvent(100., pulseTime));
+      pulseTime += static_cast<int64_t>(1000000);
+    }
+  }
+
+  void test_splitEventList() {
+    std::vector<EventList> partials(NUM_DESTINATIONS);
+    std::map<int, EventList *> partialsMap;
+    for (int i = 0; i < NUM_DESTINATIONS; ++i)
+      partialsMap.emplace(i, &partials[i]);
+    m_splitter.splitEventList(m_events, partialsMap);
+    TS_ASSERT_EQUALS(partials[0].getNumberEvents(), 2000);
+  }
+
+  void test_splitEventListWithPartialLookup() {
+    std::vector<EventList> partials(NUM_DESTINATIONS);
+    const auto getPartial = [&partials](const int destination) -> EventList * {
+      return destination == TimeSplitter::NO_TARGET ? nullptr : &partials[destination];
+    };
+    m_splitter.splitEventList(m_events, getPartial);
+    TS_ASSERT_EQUALS(partials[0].getNumberEvents(), 2000);
+  }
+
+private:
+  static constexpr int NUM_DESTINATIONS{1000};
+  TimeSplitter m_splitter;
+  EventList m_events;
+};
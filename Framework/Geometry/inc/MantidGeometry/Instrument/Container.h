@@ -56,6 +56,10 @@ public:
 
   int interceptSurface(Geometry::Track &t) const override { return m_shape->interceptSurface(t); }
   double distance(const Geometry::Track &t) const override { return m_shape->distance(t); }
+  void distancesInside(const std::vector<Kernel::V3D> &startPoints, const std::vector<Kernel::V3D> &directions,
+                       std::vector<double> &distances) const override {
+    m_shape->distancesInside(startPoints, directions, distances);
+  }
   double solidAngle(const SolidAngleParams &params) const override { return m_shape->solidAngle(params); }
   double solidAngle(const SolidAngleParams &params, const Kernel::V3D &scaleFactor) const override {
     return m_shape->solidAngle(params, scaleFactor);
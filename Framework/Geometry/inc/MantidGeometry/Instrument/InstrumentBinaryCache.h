@@ -0,0 +1,55 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class IObject;
+class Instrument;
+
+/** InstrumentBinaryCache : Saves an Instrument created by the InstrumentDefinitionParser to a binary file and
+ * recreates it without parsing the XML again.
+ *
+ * The file holds the component tree as an array of fixed size records (kind, parent, name, detector ID, relative
+ * position and rotation) that is memory mapped and read in place, followed by the shapes, the parameters of grid
+ * detectors, the <parameter> elements and the instrument level information such as the validity range and reference
+ * frame. Shapes are stored as their XML, and the pixels of grid detectors are created again by initialize() so only
+ * their rotation is stored.
+ *
+ * The file records a key, normally the mangled name of the IDF which includes the checksum of its XML, and the
+ * version of Mantid that wrote it. It is ignored if either does not match. Instruments using components or shapes
+ * that cannot be saved, e.g. mesh shapes or neutronic positions, are not cached.
+ */
+class MANTID_GEOMETRY_DLL InstrumentBinaryCache {
+public:
+  InstrumentBinaryCache(std::string filename, std::string key);
+
+  bool save(const Instrument &instrument, const bool validToIsLoadTime) const;
+  std::shared_ptr<Instrument> load(const std::string &instrumentName);
+
+  /// @return the path of the cache file
+  const std::string &filename() const { return m_filename; }
+  /// @return the shapes used by the instrument created by the last call to load()
+  const std::vector<std::shared_ptr<IObject>> &shapes() const { return m_shapes; }
+
+private:
+  /// Path of the cache file
+  std::string m_filename;
+  /// Identifies the IDF the cache file was written for
+  std::string m_key;
+  /// Shapes of the instrument created by load()
+  std::vector<std::shared_ptr<IObject>> m_shapes;
+};
+
+} // namespace Geometry
+} // namespace Mantid
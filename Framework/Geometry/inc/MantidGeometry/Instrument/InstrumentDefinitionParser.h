@@ -29,6 +29,7 @@ namespace Geometry {
 class ICompAssembly;
 class IComponent;
 class Instrument;
+class InstrumentBinaryCache;
 class ObjComponent;
 class IObject;
 class ShapeFactory;
@@ -76,6 +77,12 @@ public:
   /// creates a vtp filename from a given xml filename
   const std::string createVTPFileName();
 
+  /// creates the filename of the binary instrument cache from a given xml filename
+  const std::string createInstrumentCacheFileName();
+
+  /// Whether the instrument was read from the binary instrument cache
+  bool isReadFromInstrumentCache() const;
+
 private:
   /// shared Constructor logic
   void initialise(const std::string &filename, const std::string &instName, const std::string &xmlText,
@@ -98,6 +105,9 @@ private:
   /// Check the validity range and add it to the instrument object
   void setValidityRange(const Poco::XML::Element *pRootElem);
 
+  /// Create the instrument from the binary instrument cache
+  bool loadInstrumentCache(InstrumentBinaryCache &cache);
+
   /// Reads the contents of the \<defaults\> element to set member variables,
   void readDefaults(Poco::XML::Element *defaults);
 
@@ -353,6 +363,12 @@ private:
 
   /// Caching applied.
   CachingOption m_cachingOption;
+
+  /// True if the IDF has no valid-to date so the instrument is valid until it is loaded
+  bool m_validToIsLoadTime;
+
+  /// True if the instrument was read from the binary instrument cache
+  bool m_readFromInstrumentCache;
 };
 
 } // namespace Geometry
@@ -39,6 +39,8 @@ public:
   /// Gets the pointing horizontal direction, i.e perpendicular to up & along
   /// beam
   PointingAlong pointingHorizontal() const;
+  /// Gets the axis defining the 2theta sign
+  PointingAlong pointingThetaSign() const;
   /// Gets the handedness
   Handedness getHandedness() const;
   /// Gets the origin
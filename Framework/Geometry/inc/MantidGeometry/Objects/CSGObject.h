@@ -122,6 +122,8 @@ public:
   // INTERSECTION
   int interceptSurface(Geometry::Track &track) const override;
   double distance(const Track &track) const override;
+  void distancesInside(const std::vector<Kernel::V3D> &startPoints, const std::vector<Kernel::V3D> &directions,
+                       std::vector<double> &distances) const override;
 
   // Solid angle - uses triangleSolidAngle unless many (>30000) triangles
   double solidAngle(const SolidAngleParams &params) const override;
@@ -54,6 +54,9 @@ public:
 
   virtual int interceptSurface(Geometry::Track &) const = 0;
   virtual double distance(const Geometry::Track &) const = 0;
+  // Path lengths inside the object for a batch of rays
+  virtual void distancesInside(const std::vector<Kernel::V3D> &startPoints, const std::vector<Kernel::V3D> &directions,
+                               std::vector<double> &distances) const;
   // Solid angle
   virtual double solidAngle(const SolidAngleParams &params) const = 0;
   // Solid angle with a scaling of the object
@@ -0,0 +1,61 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+
+/** MeshBVH : Bounding volume hierarchy over the triangles of a mesh. It is used to find the few triangles that a ray
+ * could intersect without testing every triangle of the mesh.
+ *
+ * The boxes are padded slightly so that the candidates include every triangle that
+ * MeshObjectCommon::rayIntersectsTriangle can report an intersection with, including the ones just behind the start of
+ * the ray. The hierarchy only depends on the vertex positions at construction and must be rebuilt if the mesh is
+ * moved.
+ */
+class MANTID_GEOMETRY_DLL MeshBVH {
+public:
+  /// Maximum number of triangles in a leaf node
+  static constexpr uint32_t MAX_LEAF_SIZE{4};
+
+  MeshBVH(const std::vector<uint32_t> &triangles, const std::vector<Kernel::V3D> &vertices);
+
+  void getCandidateTriangles(const Kernel::V3D &start, const Kernel::V3D &direction,
+                             std::vector<size_t> &candidates) const;
+
+  size_t numberOfNodes() const;
+  size_t numberOfTriangles() const;
+
+private:
+  struct Node {
+    std::array<double, 3> minPoint;
+    std::array<double, 3> maxPoint;
+    /// first entry in m_triangleOrder for a leaf, index of the second child for an internal node
+    uint32_t offset;
+    /// number of triangles in a leaf, zero for an internal node
+    uint32_t count;
+  };
+
+  uint32_t buildNode(const uint32_t first, const uint32_t last, const std::vector<std::array<double, 3>> &centroids,
+                     const std::vector<Node> &triangleBoxes);
+  static bool rayIntersectsBox(const Node &node, const Kernel::V3D &start, const Kernel::V3D &direction);
+
+  /// nodes stored depth first so the first child of a node immediately follows it
+  std::vector<Node> m_nodes;
+  /// triangle indices grouped so each leaf covers a contiguous range
+  std::vector<uint32_t> m_triangleOrder;
+};
+
+} // namespace Geometry
+} // namespace Mantid
@@ -16,8 +16,10 @@
 #include "MantidGeometry/Rendering/ShapeInfo.h"
 #include "MantidKernel/Material.h"
 #include "MantidKernel/Matrix.h"
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace Mantid {
 //----------------------------------------------------------------------
@@ -31,6 +33,7 @@ class V3D;
 namespace Geometry {
 class CompGrp;
 class GeometryHandler;
+class MeshBVH;
 class Track;
 class vtkGeometryCacheReader;
 class vtkGeometryCacheWriter;
@@ -59,7 +62,7 @@ public:
   /// Assignment operator
   MeshObject &operator=(const MeshObject &) = delete;
   /// Destructor
-  virtual ~MeshObject() = default;
+  virtual ~MeshObject();
   /// Clone
   IObject *clone() const override { return new MeshObject(m_triangles, m_vertices, m_material); }
   IObject *cloneWithMaterial(const Kernel::Material &material) const override {
@@ -145,6 +148,11 @@ private:
                         std::vector<Kernel::V3D> &intersectionPoints,
                         std::vector<Mantid::Geometry::TrackDirection> &entryExitFlags) const;
 
+  /// Get the bounding volume hierarchy, building it if needed
+  const MeshBVH &getBVH() const;
+  /// Discard the cached bounding box and bounding volume hierarchy after the vertices have moved
+  void clearGeometryCache();
+
   /// Get triangle
   bool getTriangle(const size_t index, Kernel::V3D &v1, Kernel::V3D &v2, Kernel::V3D &v3) const;
   /// Search object for valid point
@@ -153,6 +161,13 @@ private:
   /// Cache for object's bounding box
   mutable BoundingBox m_boundingBox;
 
+  /// Spatial index of the triangles used for ray intersections. Built on first use.
+  mutable std::unique_ptr<MeshBVH> m_bvh;
+  /// Set once m_bvh has been built so queries do not need to lock
+  mutable std::atomic<bool> m_bvhBuilt{false};
+  /// Guards building m_bvh
+  mutable std::mutex m_bvhMutex;
+
   /// Tolerence distance
   const double M_TOLERANCE = 0.000001;
 
@@ -0,0 +1,814 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Instrument/InstrumentBinaryCache.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/CompAssembly.h"
+#include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/GridDetector.h"
+#include "MantidGeometry/Instrument/ObjCompAssembly.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/StructuredDetector.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/ShapeFactory.h"
+#include "MantidKernel/Interpolation.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MantidVersion.h"
+
+#include <Poco/File.h>
+#include <Poco/SharedMemory.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace Mantid::Geometry {
+
+using Kernel::Quat;
+using Kernel::V2D;
+using Kernel::V3D;
+using Types::Core::DateAndTime;
+
+namespace {
+Kernel::Logger g_log("InstrumentBinaryCache");
+
+/// Identifies the file format, change the version if the layout changes
+constexpr char MAGIC[8] = {'M', 'T', 'D', 'I', 'N', 'S', 'T', '\0'};
+constexpr uint32_t VERSION{2};
+/// Written in the byte order of the machine so files written on a machine of the other byte order are ignored
+constexpr uint32_t BYTE_ORDER_MARK{0x01020304};
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  /// Number of ComponentRecords
+  uint64_t numComponents;
+  /// Offset of the ComponentRecords from the start of the file. The information about the instrument, shapes, grid
+  /// detectors and parameters is between the header and the ComponentRecords.
+  uint64_t componentsOffset;
+  /// Offset of the component names from the start of the file
+  uint64_t namesOffset;
+  /// Size of the file, to detect truncated files
+  uint64_t fileSize;
+};
+static_assert(sizeof(FileHeader) == 48, "FileHeader must have the same layout on all platforms");
+
+enum class ComponentKind : uint32_t {
+  Instrument,
+  Component,
+  ObjComponent,
+  Detector,
+  CompAssembly,
+  ObjCompAssembly,
+  GridDetector,
+  RectangularDetector,
+  StructuredDetector,
+  /// A descendant of a grid detector, which is created by initializing the detector
+  Generated
+};
+
+enum ComponentFlag : uint32_t {
+  HasSideBySideViewPos = 1,
+  MarkedAsDetector = 2,
+  MarkedAsMonitor = 4,
+  MarkedAsSource = 8,
+  MarkedAsSamplePos = 16
+};
+
+/// One component. The components are stored in pre-order so that a parent comes before its children.
+struct ComponentRecord {
+  double position[3];
+  double rotation[4];
+  double sideBySideViewPos[2];
+  /// Index of the parent component, -1 for the instrument
+  int64_t parent;
+  /// Offset of the name from the start of the names
+  uint64_t nameOffset;
+  uint64_t nameLength;
+  /// Index of the shape, or of the pixel shape of a grid detector. -1 if there is none.
+  int64_t shape;
+  /// Index of the GridParameters of a grid detector, -1 for other components
+  int64_t grid;
+  int32_t detectorId;
+  ComponentKind kind;
+  uint32_t flags;
+  uint32_t padding;
+};
+static_assert(sizeof(ComponentRecord) == 128, "ComponentRecord must have the same layout on all platforms");
+
+/// The arguments of the initialize() methods of the grid detectors
+struct GridParameters {
+  int xpixels{0};
+  int ypixels{0};
+  int zpixels{0};
+  double xstart{0.};
+  double xstep{0.};
+  double ystart{0.};
+  double ystep{0.};
+  double zstart{0.};
+  double zstep{0.};
+  int idstart{0};
+  std::string idFillOrder;
+  bool idfillbyfirst_y{false};
+  int idstepbyrow{0};
+  int idstep{1};
+  /// The vertices of a StructuredDetector
+  std::vector<double> xValues;
+  std::vector<double> yValues;
+};
+
+/// Appends values to the contents of the file
+class BufferWriter {
+public:
+  template <typename T> void write(const T &value) {
+    m_buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+  void writeString(const std::string &value) {
+    write<uint64_t>(value.size());
+    m_buffer.append(value);
+  }
+  void writeStrings(const std::vector<std::string> &values) {
+    write<uint64_t>(values.size());
+    for (const auto &value : values)
+      writeString(value);
+  }
+  void writeDoubles(const std::vector<double> &values) {
+    write<uint64_t>(values.size());
+    m_buffer.append(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(double));
+  }
+  /// Pad the buffer so that the next value is 8 byte aligned
+  void align() { m_buffer.resize((m_buffer.size() + 7) / 8 * 8, '\0'); }
+  std::string &buffer() { return m_buffer; }
+
+private:
+  std::string m_buffer;
+};
+
+/// Reads values from the mapped file, throwing if a value is beyond the end
+class BufferReader {
+public:
+  BufferReader(const char *begin, const char *end) : m_position(begin), m_end(end) {}
+  template <typename T> T read() {
+    checkSize(sizeof(T));
+    T value;
+    std::memcpy(&value, m_position, sizeof(T));
+    m_position += sizeof(T);
+    return value;
+  }
+  std::string readString() {
+    const auto size = read<uint64_t>();
+    checkSize(size);
+    std::string value(m_position, size);
+    m_position += size;
+    return value;
+  }
+  std::vector<std::string> readStrings() {
+    const auto size = read<uint64_t>();
+    // every string takes at least 8 bytes for its length
+    checkSize(size * sizeof(uint64_t));
+    std::vector<std::string> values;
+    values.reserve(size);
+    for (uint64_t i = 0; i < size; ++i)
+      values.emplace_back(readString());
+    return values;
+  }
+  std::vector<double> readDoubles() {
+    const auto size = read<uint64_t>();
+    checkSize(size * sizeof(double));
+    std::vector<double> values(size);
+    std::memcpy(values.data(), m_position, size * sizeof(double));
+    m_position += size * sizeof(double);
+    return values;
+  }
+
+private:
+  void checkSize(const uint64_t size) const {
+    if (size > static_cast<uint64_t>(m_end - m_position))
+      throw std::runtime_error("unexpected end of the file");
+  }
+  const char *m_position;
+  const char *m_end;
+};
+
+/// Everything that is written about the components of an instrument
+struct InstrumentContents {
+  explicit InstrumentContents(const Instrument &instrument)
+      : instrument(instrument), source(instrument.hasSource() ? instrument.getSource().get() : nullptr),
+        samplePos(instrument.hasSample() ? instrument.getSample().get() : nullptr) {}
+
+  const Instrument &instrument;
+  const IComponent *source;
+  const IComponent *samplePos;
+  std::vector<ComponentRecord> components;
+  std::string names;
+  std::vector<const CSGObject *> shapes;
+  std::vector<GridParameters> grids;
+  std::unordered_map<const IComponent *, int64_t> componentIndices;
+  std::unordered_map<const IObject *, int64_t> shapeIndices;
+};
+
+/// @return the kind of a component, throwing for components that cannot be cached
+ComponentKind kindOf(const IComponent &component) {
+  // the exact type is compared as subclasses may hold more information
+  const auto &type = typeid(component);
+  if (type == typeid(Instrument))
+    return ComponentKind::Instrument;
+  if (type == typeid(Component))
+    return ComponentKind::Component;
+  if (type == typeid(ObjComponent))
+    return ComponentKind::ObjComponent;
+  if (type == typeid(Detector))
+    return ComponentKind::Detector;
+  if (type == typeid(CompAssembly))
+    return ComponentKind::CompAssembly;
+  if (type == typeid(ObjCompAssembly))
+    return ComponentKind::ObjCompAssembly;
+  if (type == typeid(GridDetector))
+    return ComponentKind::GridDetector;
+  if (type == typeid(RectangularDetector))
+    return ComponentKind::RectangularDetector;
+  if (type == typeid(StructuredDetector))
+    return ComponentKind::StructuredDetector;
+  throw std::runtime_error("component " + component.getName() + " has a type that cannot be cached");
+}
+
+bool isGridDetector(const ComponentKind kind) {
+  return kind == ComponentKind::GridDetector || kind == ComponentKind::RectangularDetector ||
+         kind == ComponentKind::StructuredDetector;
+}
+
+/// @return the index of a shape, adding it if it is not there yet
+int64_t addShape(InstrumentContents &contents, const std::shared_ptr<const IObject> &shape) {
+  if (!shape)
+    return -1;
+  const auto found = contents.shapeIndices.find(shape.get());
+  if (found != contents.shapeIndices.end())
+    return found->second;
+  const auto *csgObject = dynamic_cast<const CSGObject *>(shape.get());
+  if (!csgObject)
+    throw std::runtime_error("only shapes defined in XML can be cached");
+  const auto index = static_cast<int64_t>(contents.shapes.size());
+  contents.shapes.emplace_back(csgObject);
+  contents.shapeIndices.emplace(shape.get(), index);
+  return index;
+}
+
+/// @return the arguments that were used to initialize a grid detector
+GridParameters gridParameters(const IComponent &component, const ComponentKind kind) {
+  GridParameters grid;
+  if (kind == ComponentKind::StructuredDetector) {
+    const auto &detector = dynamic_cast<const StructuredDetector &>(component);
+    grid.xpixels = static_cast<int>(detector.xPixels());
+    grid.ypixels = static_cast<int>(detector.yPixels());
+    grid.idstart = detector.idStart();
+    grid.idfillbyfirst_y = detector.idFillByFirstY();
+    grid.idstepbyrow = detector.idStepByRow();
+    grid.idstep = detector.idStep();
+    grid.xValues = detector.getXValues();
+    grid.yValues = detector.getYValues();
+  } else {
+    const auto &detector = dynamic_cast<const GridDetector &>(component);
+    grid.xpixels = detector.xpixels();
+    grid.ypixels = detector.ypixels();
+    grid.zpixels = detector.zpixels();
+    grid.xstart = detector.xstart();
+    grid.xstep = detector.xstep();
+    grid.ystart = detector.ystart();
+    grid.ystep = detector.ystep();
+    grid.zstart = detector.zstart();
+    grid.zstep = detector.zstep();
+    grid.idstart = detector.idstart();
+    grid.idFillOrder = detector.idFillOrder();
+    grid.idfillbyfirst_y = detector.idfillbyfirst_y();
+    grid.idstepbyrow = detector.idstepbyrow();
+    grid.idstep = detector.idstep();
+  }
+  return grid;
+}
+
+/**
+ * Add a component and its children
+ * @param contents :: the components found so far
+ * @param component :: the component to add
+ * @param parent :: index of the parent
+ * @param generated :: true if the component is created by initializing a grid detector
+ */
+void addComponent(InstrumentContents &contents, const IComponent &component, const int64_t parent,
+                  const bool generated) {
+  ComponentRecord record{};
+  record.kind = generated ? ComponentKind::Generated : kindOf(component);
+  record.parent = parent;
+  record.shape = -1;
+  record.grid = -1;
+
+  const auto position = component.getRelativePos();
+  const auto rotation = component.getRelativeRot();
+  for (size_t i = 0; i < 3; ++i)
+    record.position[i] = position[i];
+  for (int i = 0; i < 4; ++i)
+    record.rotation[i] = rotation[i];
+  if (const auto sideBySideViewPos = component.getSideBySideViewPos()) {
+    record.flags |= HasSideBySideViewPos;
+    record.sideBySideViewPos[0] = sideBySideViewPos->X();
+    record.sideBySideViewPos[1] = sideBySideViewPos->Y();
+  }
+  const auto name = component.getName();
+  record.nameOffset = contents.names.size();
+  record.nameLength = name.size();
+  contents.names.append(name);
+
+  if (const auto *detector = dynamic_cast<const IDetector *>(&component)) {
+    record.detectorId = detector->getID();
+    if (contents.instrument.getBaseDetector(record.detectorId) == detector) {
+      record.flags |= MarkedAsDetector;
+      if (contents.instrument.isMonitor(record.detectorId))
+        record.flags |= MarkedAsMonitor;
+    }
+  }
+  if (&component == contents.source)
+    record.flags |= MarkedAsSource;
+  if (&component == contents.samplePos)
+    record.flags |= MarkedAsSamplePos;
+
+  if (isGridDetector(record.kind)) {
+    record.grid = static_cast<int64_t>(contents.grids.size());
+    contents.grids.emplace_back(gridParameters(component, record.kind));
+    if (record.kind != ComponentKind::StructuredDetector) {
+      const auto pixel = dynamic_cast<const GridDetector &>(component).getAtXYZ(0, 0, 0);
+      record.shape = addShape(contents, pixel->shape());
+    }
+  } else if (!generated && record.kind != ComponentKind::Instrument) {
+    if (const auto *objComponent = dynamic_cast<const IObjComponent *>(&component))
+      record.shape = addShape(contents, objComponent->shape());
+  }
+
+  const auto index = static_cast<int64_t>(contents.components.size());
+  contents.componentIndices.emplace(&component, index);
+  contents.components.emplace_back(record);
+
+  if (const auto *assembly = dynamic_cast<const ICompAssembly *>(&component)) {
+    const bool childrenGenerated = generated || isGridDetector(record.kind);
+    for (int i = 0; i < assembly->nelements(); ++i)
+      addComponent(contents, *assembly->getChild(i), index, childrenGenerated);
+  }
+}
+
+/// @return the index of a component, -1 for nullptr
+int64_t componentIndex(const InstrumentContents &contents, const IComponent *component) {
+  if (!component)
+    return -1;
+  const auto found = contents.componentIndices.find(component);
+  if (found == contents.componentIndices.end())
+    throw std::runtime_error("a parameter refers to a component that is not in the instrument");
+  return found->second;
+}
+
+void writeInstrumentInformation(BufferWriter &writer, const Instrument &instrument, const bool validToIsLoadTime) {
+  writer.writeString(instrument.getDefaultView());
+  writer.writeString(instrument.getDefaultAxis());
+  writer.write<int64_t>(instrument.getValidFromDate().totalNanoseconds());
+  writer.write<int64_t>(instrument.getValidToDate().totalNanoseconds());
+  writer.write<uint8_t>(validToIsLoadTime);
+  const auto frame = instrument.getReferenceFrame();
+  writer.write<uint32_t>(frame->pointingUp());
+  writer.write<uint32_t>(frame->pointingAlongBeam());
+  writer.write<uint32_t>(frame->pointingThetaSign());
+  writer.write<uint32_t>(frame->getHandedness());
+  writer.writeString(frame->origin());
+  const auto &units = instrument.getLogfileUnit();
+  writer.write<uint64_t>(units.size());
+  for (const auto &[quantity, unit] : units) {
+    writer.writeString(quantity);
+    writer.writeString(unit);
+  }
+}
+
+void writeGrid(BufferWriter &writer, const GridParameters &grid) {
+  writer.write<int32_t>(grid.xpixels);
+  writer.write<int32_t>(grid.ypixels);
+  writer.write<int32_t>(grid.zpixels);
+  writer.write(grid.xstart);
+  writer.write(grid.xstep);
+  writer.write(grid.ystart);
+  writer.write(grid.ystep);
+  writer.write(grid.zstart);
+  writer.write(grid.zstep);
+  writer.write<int32_t>(grid.idstart);
+  writer.writeString(grid.idFillOrder);
+  writer.write<uint8_t>(grid.idfillbyfirst_y);
+  writer.write<int32_t>(grid.idstepbyrow);
+  writer.write<int32_t>(grid.idstep);
+  writer.writeDoubles(grid.xValues);
+  writer.writeDoubles(grid.yValues);
+}
+
+GridParameters readGrid(BufferReader &reader) {
+  GridParameters grid;
+  grid.xpixels = reader.read<int32_t>();
+  grid.ypixels = reader.read<int32_t>();
+  grid.zpixels = reader.read<int32_t>();
+  grid.xstart = reader.read<double>();
+  grid.xstep = reader.read<double>();
+  grid.ystart = reader.read<double>();
+  grid.ystep = reader.read<double>();
+  grid.zstart = reader.read<double>();
+  grid.zstep = reader.read<double>();
+  grid.idstart = reader.read<int32_t>();
+  grid.idFillOrder = reader.readString();
+  grid.idfillbyfirst_y = reader.read<uint8_t>() != 0;
+  grid.idstepbyrow = reader.read<int32_t>();
+  grid.idstep = reader.read<int32_t>();
+  grid.xValues = reader.readDoubles();
+  grid.yValues = reader.readDoubles();
+  return grid;
+}
+
+void writeParameters(BufferWriter &writer, const InstrumentContents &contents) {
+  const auto &parameters = contents.instrument.getLogfileCache();
+  writer.write<uint64_t>(parameters.size());
+  for (const auto &[key, parameter] : parameters) {
+    writer.writeString(key.first);
+    writer.write(componentIndex(contents, key.second));
+    writer.writeString(parameter->m_logfileID);
+    writer.writeString(parameter->m_value);
+    writer.write<uint8_t>(parameter->m_interpolation != nullptr);
+    if (parameter->m_interpolation) {
+      std::ostringstream interpolation;
+      interpolation.precision(17);
+      parameter->m_interpolation->printSelf(interpolation);
+      writer.writeString(interpolation.str());
+    }
+    writer.writeString(parameter->m_formula);
+    writer.writeString(parameter->m_formulaUnit);
+    writer.writeString(parameter->m_resultUnit);
+    writer.writeString(parameter->m_paramName);
+    writer.writeString(parameter->m_type);
+    writer.writeString(parameter->m_tie);
+    writer.writeStrings(parameter->m_constraint);
+    writer.writeString(parameter->m_penaltyFactor);
+    writer.writeString(parameter->m_fittingFunction);
+    writer.writeString(parameter->m_extractSingleValueAs);
+    writer.writeString(parameter->m_eq);
+    writer.write(componentIndex(contents, parameter->m_component));
+    writer.write(parameter->m_angleConvertConst);
+    writer.writeString(parameter->m_description);
+    writer.writeString(parameter->m_visible);
+  }
+}
+
+void readParameters(BufferReader &reader, Instrument &instrument, const std::vector<IComponent *> &components) {
+  const auto component = [&components](const int64_t index) -> const IComponent * {
+    if (index < -1 || index >= static_cast<int64_t>(components.size()))
+      throw std::runtime_error("invalid component index");
+    return index < 0 ? nullptr : components[index];
+  };
+  const auto numParameters = reader.read<uint64_t>();
+  for (uint64_t i = 0; i < numParameters; ++i) {
+    auto keyName = reader.readString();
+    const auto *keyComponent = component(reader.read<int64_t>());
+    auto logfileID = reader.readString();
+    auto value = reader.readString();
+    std::shared_ptr<Kernel::Interpolation> interpolation;
+    if (reader.read<uint8_t>() != 0) {
+      interpolation = std::make_shared<Kernel::Interpolation>();
+      std::istringstream stream(reader.readString());
+      stream >> *interpolation;
+    }
+    auto formula = reader.readString();
+    auto formulaUnit = reader.readString();
+    auto resultUnit = reader.readString();
+    auto paramName = reader.readString();
+    auto type = reader.readString();
+    auto tie = reader.readString();
+    auto constraint = reader.readStrings();
+    auto penaltyFactor = reader.readString();
+    auto fitFunc = reader.readString();
+    auto extractSingleValueAs = reader.readString();
+    auto eq = reader.readString();
+    const auto *parameterComponent = component(reader.read<int64_t>());
+    const auto angleConvertConst = reader.read<double>();
+    const auto description = reader.readString();
+    auto visible = reader.readString();
+    auto parameter = std::make_shared<XMLInstrumentParameter>(
+        std::move(logfileID), std::move(value), std::move(interpolation), std::move(formula), std::move(formulaUnit),
+        std::move(resultUnit), std::move(paramName), std::move(type), std::move(tie), std::move(constraint),
+        penaltyFactor, std::move(fitFunc), std::move(extractSingleValueAs), std::move(eq), parameterComponent,
+        angleConvertConst, description, std::move(visible));
+    instrument.getLogfileCache().emplace(std::make_pair(std::move(keyName), keyComponent), std::move(parameter));
+  }
+}
+
+/// @return a PointingAlong read from the file
+PointingAlong readAxis(BufferReader &reader) {
+  const auto axis = reader.read<uint32_t>();
+  if (axis > Z)
+    throw std::runtime_error("invalid axis in the reference frame");
+  return static_cast<PointingAlong>(axis);
+}
+
+/**
+ * Create a component from its record
+ * @param record :: the record of the component
+ * @param name :: the name of the component
+ * @param parent :: the parent, which is already created
+ * @param shapes :: all shapes of the instrument
+ * @param grids :: parameters of all grid detectors of the instrument
+ * @param generatedChildren :: number of children of the parent that were created by initializing a grid detector and
+ * have been read so far
+ * @return the component, which is owned by its parent
+ */
+IComponent *createComponent(const ComponentRecord &record, const std::string &name, IComponent *parent,
+                            const std::vector<std::shared_ptr<IObject>> &shapes,
+                            const std::vector<GridParameters> &grids, int &generatedChildren) {
+  auto *parentAssembly = dynamic_cast<ICompAssembly *>(parent);
+  if (!parentAssembly)
+    throw std::runtime_error("the parent of " + name + " is not an assembly");
+  if (record.shape < -1 || record.shape >= static_cast<int64_t>(shapes.size()))
+    throw std::runtime_error("invalid shape index");
+  const auto shape = record.shape < 0 ? std::shared_ptr<IObject>() : shapes[record.shape];
+  const auto grid = [&record, &grids]() -> const GridParameters & {
+    if (record.grid < 0 || record.grid >= static_cast<int64_t>(grids.size()))
+      throw std::runtime_error("invalid grid index");
+    return grids[record.grid];
+  };
+
+  switch (record.kind) {
+  case ComponentKind::Component: {
+    auto *component = new Component(name, parent);
+    parentAssembly->add(component);
+    return component;
+  }
+  case ComponentKind::ObjComponent: {
+    auto *component = new ObjComponent(name, shape, parent);
+    parentAssembly->add(component);
+    return component;
+  }
+  case ComponentKind::Detector: {
+    auto *detector = new Detector(name, record.detectorId, shape, parent);
+    parentAssembly->add(detector);
+    return detector;
+  }
+  case ComponentKind::CompAssembly:
+    // assemblies add themselves to the parent
+    return new CompAssembly(name, parent);
+  case ComponentKind::ObjCompAssembly: {
+    auto *assembly = new ObjCompAssembly(name, parent);
+    if (shape)
+      assembly->setOutline(shape);
+    return assembly;
+  }
+  case ComponentKind::GridDetector: {
+    const auto &g = grid();
+    auto *bank = new GridDetector(name, parent);
+    bank->initialize(shape, g.xpixels, g.xstart, g.xstep, g.ypixels, g.ystart, g.ystep, g.zpixels, g.zstart, g.zstep,
+                     g.idstart, g.idFillOrder, g.idstepbyrow, g.idstep);
+    return bank;
+  }
+  case ComponentKind::RectangularDetector: {
+    const auto &g = grid();
+    auto *bank = new RectangularDetector(name, parent);
+    bank->initialize(shape, g.xpixels, g.xstart, g.xstep, g.ypixels, g.ystart, g.ystep, g.idstart, g.idfillbyfirst_y,
+                     g.idstepbyrow, g.idstep);
+    return bank;
+  }
+  case ComponentKind::StructuredDetector: {
+    const auto &g = grid();
+    auto *bank = new StructuredDetector(name, parent);
+    // a StructuredDetector can only be created for a beam along z
+    bank->initialize(g.xpixels, g.ypixels, std::vector<double>(g.xValues), std::vector<double>(g.yValues), true,
+                     g.idstart, g.idfillbyfirst_y, g.idstepbyrow, g.idstep);
+    return bank;
+  }
+  case ComponentKind::Generated: {
+    // children created by a grid detector are in the same order as when the file was written
+    const auto child = parentAssembly->getChild(generatedChildren++);
+    if (child->getName() != name)
+      throw std::runtime_error("component " + child->getName() + " of a grid detector does not match " + name);
+    return child.get();
+  }
+  default:
+    throw std::runtime_error("invalid component kind");
+  }
+}
+} // namespace
+
+/**
+ * Constructor. Nothing is read or written until load() or save() is called.
+ * @param filename :: path of the cache file
+ * @param key :: identifies the IDF, e.g. its mangled name
+ */
+InstrumentBinaryCache::InstrumentBinaryCache(std::string filename, std::string key)
+    : m_filename(std::move(filename)), m_key(std::move(key)) {}
+
+/**
+ * Write the cache file. Failing to write it is not an error, as it only makes the next load slower.
+ * @param instrument :: the instrument created by the InstrumentDefinitionParser
+ * @param validToIsLoadTime :: true if the IDF has no valid-to date, so the date is the time the instrument is loaded
+ * @return true if the file was written, false if the instrument cannot be cached or the file could not be written
+ */
+bool InstrumentBinaryCache::save(const Instrument &instrument, const bool validToIsLoadTime) const {
+  if (m_key.empty())
+    return false;
+  if (instrument.getPhysicalInstrument()) {
+    g_log.debug() << "Not caching " << instrument.getName() << " as it has neutronic positions\n";
+    return false;
+  }
+
+  InstrumentContents contents(instrument);
+  BufferWriter writer;
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.byteOrder = BYTE_ORDER_MARK;
+  try {
+    addComponent(contents, instrument, -1, false);
+
+    writer.write(header);
+    writer.writeString(Kernel::MantidVersion::version());
+    writer.writeString(m_key);
+    writeInstrumentInformation(writer, instrument, validToIsLoadTime);
+    writer.write<uint64_t>(contents.shapes.size());
+    for (const auto *shape : contents.shapes) {
+      writer.writeString(shape->getShapeXML());
+      writer.write<int32_t>(shape->getName());
+    }
+    writer.write<uint64_t>(contents.grids.size());
+    for (const auto &grid : contents.grids)
+      writeGrid(writer, grid);
+    writeParameters(writer, contents);
+  } catch (std::exception &e) {
+    g_log.debug() << "Not caching " << instrument.getName() << ": " << e.what() << '\n';
+    return false;
+  }
+
+  writer.align();
+  auto &buffer = writer.buffer();
+  header.numComponents = contents.components.size();
+  header.componentsOffset = buffer.size();
+  buffer.append(reinterpret_cast<const char *>(contents.components.data()),
+                contents.components.size() * sizeof(ComponentRecord));
+  header.namesOffset = buffer.size();
+  buffer.append(contents.names);
+  header.fileSize = buffer.size();
+  std::memcpy(buffer.data(), &header, sizeof(header));
+
+  // write to a temporary file and rename it so another process never reads a partial file
+  const auto tempFilename = m_filename + ".tmp";
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::path(m_filename).parent_path(), ec);
+  {
+    std::ofstream stream(tempFilename, std::ios::binary | std::ios::trunc);
+    stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!stream) {
+      g_log.warning() << "Could not write the instrument cache " << tempFilename << '\n';
+      std::filesystem::remove(tempFilename, ec);
+      return false;
+    }
+  }
+  std::filesystem::rename(tempFilename, m_filename, ec);
+  if (ec) {
+    g_log.warning() << "Could not write the instrument cache " << m_filename << ": " << ec.message() << '\n';
+    std::filesystem::remove(tempFilename, ec);
+    return false;
+  }
+  g_log.debug() << "Wrote the instrument cache " << m_filename << '\n';
+  return true;
+}
+
+/**
+ * Create the instrument from the cache file. The file is ignored if it does not exist, cannot be read, or was
+ * written for a different IDF or version of Mantid.
+ * @param instrumentName :: the name of the instrument
+ * @return the instrument, or nullptr if it could not be read. Its filename and XML text are not set.
+ */
+std::shared_ptr<Instrument> InstrumentBinaryCache::load(const std::string &instrumentName) {
+  m_shapes.clear();
+  std::error_code ec;
+  if (m_key.empty() || std::filesystem::file_size(m_filename, ec) < sizeof(FileHeader) || ec)
+    return nullptr;
+
+  try {
+    // the file is mapped rather than read so that the component records are used where they are
+    Poco::SharedMemory mapping(Poco::File(m_filename), Poco::SharedMemory::AM_READ);
+    const char *begin = mapping.begin();
+    const auto fileSize = static_cast<uint64_t>(mapping.end() - mapping.begin());
+
+    FileHeader header;
+    std::memcpy(&header, begin, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+        header.byteOrder != BYTE_ORDER_MARK)
+      return nullptr;
+    if (header.fileSize != fileSize || header.componentsOffset < sizeof(FileHeader) ||
+        header.componentsOffset % alignof(ComponentRecord) != 0 || header.namesOffset > fileSize ||
+        header.numComponents == 0 ||
+        header.numComponents > (header.namesOffset - header.componentsOffset) / sizeof(ComponentRecord))
+      throw std::runtime_error("the file is truncated or corrupt");
+
+    BufferReader reader(begin + sizeof(FileHeader), begin + header.componentsOffset);
+    if (reader.readString() != Kernel::MantidVersion::version()) {
+      g_log.debug() << "Ignoring " << m_filename << " as it was written by a different version of Mantid\n";
+      return nullptr;
+    }
+    if (reader.readString() != m_key)
+      return nullptr;
+
+    auto instrument = std::make_shared<Instrument>(instrumentName);
+    instrument->setDefaultView(reader.readString());
+    instrument->setDefaultViewAxis(reader.readString());
+    instrument->setValidFromDate(DateAndTime(reader.read<int64_t>()));
+    const DateAndTime validTo(reader.read<int64_t>());
+    instrument->setValidToDate(reader.read<uint8_t>() != 0 ? DateAndTime::getCurrentTime() : validTo);
+    const auto up = readAxis(reader);
+    const auto alongBeam = readAxis(reader);
+    const auto thetaSign = readAxis(reader);
+    const auto handedness = reader.read<uint32_t>() == Left ? Left : Right;
+    instrument->setReferenceFrame(
+        std::make_shared<ReferenceFrame>(up, alongBeam, thetaSign, handedness, reader.readString()));
+    auto &units = instrument->getLogfileUnit();
+    const auto numUnits = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < numUnits; ++i) {
+      auto quantity = reader.readString();
+      units[quantity] = reader.readString();
+    }
+
+    const auto numShapes = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < numShapes; ++i) {
+      auto shape = ShapeFactory().createShape(reader.readString(), false);
+      shape->setName(reader.read<int32_t>());
+      m_shapes.emplace_back(std::move(shape));
+    }
+    std::vector<GridParameters> grids;
+    const auto numGrids = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < numGrids; ++i)
+      grids.emplace_back(readGrid(reader));
+
+    const auto *records = reinterpret_cast<const ComponentRecord *>(begin + header.componentsOffset);
+    const char *names = begin + header.namesOffset;
+    const auto namesSize = fileSize - header.namesOffset;
+    std::vector<IComponent *> components(header.numComponents, nullptr);
+    std::vector<int> generatedChildren(header.numComponents, 0);
+    std::vector<const IDetector *> detectors;
+    std::vector<const IDetector *> monitors;
+    for (uint64_t i = 0; i < header.numComponents; ++i) {
+      const auto &record = records[i];
+      if (record.nameOffset > namesSize || record.nameLength > namesSize - record.nameOffset)
+        throw std::runtime_error("invalid component name");
+      const std::string name(names + record.nameOffset, record.nameLength);
+
+      IComponent *component{nullptr};
+      if (i == 0) {
+        if (record.kind != ComponentKind::Instrument)
+          throw std::runtime_error("the first component is not the instrument");
+        component = instrument.get();
+      } else {
+        if (record.parent < 0 || static_cast<uint64_t>(record.parent) >= i)
+          throw std::runtime_error("invalid parent of component " + name);
+        component = createComponent(record, name, components[record.parent], m_shapes, grids,
+                                    generatedChildren[record.parent]);
+      }
+      components[i] = component;
+
+      // the positions of the children of grid detectors are calculated by the detector
+      if (record.kind != ComponentKind::Generated)
+        component->setPos(V3D(record.position[0], record.position[1], record.position[2]));
+      component->setRot(Quat(record.rotation[0], record.rotation[1], record.rotation[2], record.rotation[3]));
+      if (record.flags & HasSideBySideViewPos)
+        component->setSideBySideViewPos(V2D(record.sideBySideViewPos[0], record.sideBySideViewPos[1]));
+
+      if (record.flags & MarkedAsDetector) {
+        const auto *detector = dynamic_cast<const IDetector *>(component);
+        if (!detector || detector->getID() != record.detectorId)
+          throw std::runtime_error("component " + name + " is not the expected detector");
+        ((record.flags & MarkedAsMonitor) ? monitors : detectors).emplace_back(detector);
+      }
+      if (record.flags & MarkedAsSource)
+        instrument->markAsSource(component);
+      if (record.flags & MarkedAsSamplePos)
+        instrument->markAsSamplePos(component);
+    }
+    // monitors are added in sorted order, the detectors are sorted once at the end
+    for (const auto *monitor : monitors)
+      instrument->markAsMonitor(monitor);
+    for (const auto *detector : detectors)
+      instrument->markAsDetectorIncomplete(detector);
+    instrument->markAsDetectorFinalize();
+
+    readParameters(reader, *instrument, components);
+    return instrument;
+  } catch (std::exception &e) {
+    g_log.warning() << "Ignoring the instrument cache " << m_filename << ": " << e.what() << '\n';
+    m_shapes.clear();
+    return nullptr;
+  }
+}
+
+} // namespace Mantid::Geometry
@@ -8,6 +8,7 @@
 #include <sstream>
 
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/InstrumentBinaryCache.h"
 #include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
 #include "MantidGeometry/Instrument/ObjCompAssembly.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
@@ -65,7 +66,8 @@ Kernel::Logger g_log("InstrumentDefinitionParser");
 InstrumentDefinitionParser::InstrumentDefinitionParser()
     : m_xmlFile(std::make_shared<NullIDFObject>()), m_cacheFile(std::make_shared<NullIDFObject>()), m_pDoc(nullptr),
       m_hasParameterElement_beenSet(false), m_haveDefaultFacing(false), m_deltaOffsets(false), m_angleConvertConst(1.0),
-      m_indirectPositions(false), m_cachingOption(NoneApplied) {
+      m_indirectPositions(false), m_cachingOption(NoneApplied), m_validToIsLoadTime(false),
+      m_readFromInstrumentCache(false) {
   initialise("", "", "", "");
 }
 //----------------------------------------------------------------------------------------------
@@ -79,7 +81,8 @@ InstrumentDefinitionParser::InstrumentDefinitionParser(const std::string &filena
                                                        const std::string &xmlText)
     : m_xmlFile(std::make_shared<NullIDFObject>()), m_cacheFile(std::make_shared<NullIDFObject>()), m_pDoc(nullptr),
       m_hasParameterElement_beenSet(false), m_haveDefaultFacing(false), m_deltaOffsets(false), m_angleConvertConst(1.0),
-      m_indirectPositions(false), m_cachingOption(NoneApplied) {
+      m_indirectPositions(false), m_cachingOption(NoneApplied), m_validToIsLoadTime(false),
+      m_readFromInstrumentCache(false) {
   initialise(filename, instName, xmlText, "");
 }
 
@@ -96,7 +99,8 @@ InstrumentDefinitionParser::InstrumentDefinitionParser(const IDFObject_const_spt
                                                        const std::string &instName, const std::string &xmlText)
     : m_xmlFile(std::make_shared<NullIDFObject>()), m_cacheFile(std::make_shared<NullIDFObject>()), m_pDoc(nullptr),
       m_hasParameterElement_beenSet(false), m_haveDefaultFacing(false), m_deltaOffsets(false), m_angleConvertConst(1.0),
-      m_indirectPositions(false), m_cachingOption(NoneApplied) {
+      m_indirectPositions(false), m_cachingOption(NoneApplied), m_validToIsLoadTime(false),
+      m_readFromInstrumentCache(false) {
   initialise(xmlFile->getFileFullPathStr(), instName, xmlText, expectedCacheFile->getFileFullPathStr());
 
   m_cacheFile = expectedCacheFile;
@@ -220,6 +224,14 @@ void InstrumentDefinitionParser::throwIfTypeNameNotUnique(const std::string &fil
  * @return the instrument that was created
  */
 Instrument_sptr InstrumentDefinitionParser::parseXML(Kernel::ProgressBase *progressReporter) {
+  // Creating the instrument from the binary cache avoids parsing the XML at all
+  std::unique_ptr<InstrumentBinaryCache> instrumentCache;
+  if (ConfigService::Instance().getValue<bool>("instrumentDefinition.binaryCache").value_or(false)) {
+    instrumentCache = std::make_unique<InstrumentBinaryCache>(createInstrumentCacheFileName(), getMangledName());
+    if (loadInstrumentCache(*instrumentCache))
+      return m_instrument;
+  }
+
   auto pDoc = getDocument();
 
   // Get pointer to root element
@@ -275,6 +287,9 @@ Instrument_sptr InstrumentDefinitionParser::parseXML(Kernel::ProgressBase *progr
   // (which does the final sorting).
   m_instrument->markAsDetectorFinalize();
 
+  if (instrumentCache)
+    instrumentCache->save(*m_instrument, m_validToIsLoadTime);
+
   // And give back what we created
   return m_instrument;
 }
@@ -923,6 +938,7 @@ void InstrumentDefinitionParser::setValidityRange(const Poco::XML::Element *pRoo
   if (!pRootElem->hasAttribute("valid-to")) {
     DateAndTime d = DateAndTime::getCurrentTime();
     m_instrument->setValidToDate(d);
+    m_validToIsLoadTime = true;
     // Ticket #2335: no required valid-to date.
     // throw Kernel::Exception::InstrumentDefinitionError("<instrument> element
     // must contain a valid-to tag", filename);
@@ -2576,6 +2592,34 @@ InstrumentDefinitionParser::CachingOption InstrumentDefinitionParser::getApplied
   return m_cachingOption;
 }
 
+/**
+Getter for whether the instrument was read from the binary instrument cache.
+@return true if the XML was not parsed.
+*/
+bool InstrumentDefinitionParser::isReadFromInstrumentCache() const { return m_readFromInstrumentCache; }
+
+/** Replace the instrument with the one saved in the binary instrument cache, if the cache was written for this IDF.
+@param cache : the binary instrument cache
+@return true if the instrument was read from the cache.
+*/
+bool InstrumentDefinitionParser::loadInstrumentCache(InstrumentBinaryCache &cache) {
+  auto instrument = cache.load(m_instName);
+  if (!instrument)
+    return false;
+  g_log.information("Loading instrument from " + cache.filename());
+  instrument->setFilename(m_instrument->getFilename());
+  instrument->setXmlText(m_instrument->getXmlText());
+  m_instrument = std::move(instrument);
+
+  // The shapes still use the vtp geometry cache. Only the shapes are needed, not the names of their types.
+  const auto &shapes = cache.shapes();
+  for (size_t i = 0; i < shapes.size(); ++i)
+    mapTypeNameToShape["cached-shape-" + std::to_string(i)] = shapes[i];
+  m_cachingOption = setupGeometryCache();
+  m_readFromInstrumentCache = true;
+  return true;
+}
+
 void InstrumentDefinitionParser::createNeutronicInstrument() {
   // Create a copy of the instrument
   auto physical = std::make_unique<Instrument>(*m_instrument);
@@ -2972,6 +3016,21 @@ const std::string InstrumentDefinitionParser::createVTPFileName() {
   return retVal;
 }
 
+/** Creates the filename of the binary instrument cache, which is next to the vtp file
+ * @return the filename, or an empty string if there is no IDF
+ */
+const std::string InstrumentDefinitionParser::createInstrumentCacheFileName() {
+  std::string retVal;
+  std::string filename = getMangledName();
+  if (!filename.empty()) {
+    Poco::Path path(ConfigService::Instance().getVTPFileDirectory());
+    path.makeDirectory();
+    path.append(filename + ".idfcache");
+    retVal = path.toString();
+  }
+  return retVal;
+}
+
 /** Return a subelement of an XML element, but also checks that there exist
  *exactly one entry
  *  of this subelement.
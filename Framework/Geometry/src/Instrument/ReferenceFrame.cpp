@@ -95,6 +95,11 @@ PointingAlong ReferenceFrame::pointingUp() const { return m_up; }
 */
 PointingAlong ReferenceFrame::pointingAlongBeam() const { return m_alongBeam; }
 
+/** Gets the axis defining the 2theta sign
+@return axis
+*/
+PointingAlong ReferenceFrame::pointingThetaSign() const { return m_thetaSign; }
+
 /**
  * Get the axis label for the pointing up direction.
  * @return label for up
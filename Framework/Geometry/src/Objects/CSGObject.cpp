@@ -16,6 +16,7 @@
 #include "MantidGeometry/Surfaces/Cone.h"
 #include "MantidGeometry/Surfaces/Cylinder.h"
 #include "MantidGeometry/Surfaces/LineIntersectVisit.h"
+#include "MantidGeometry/Surfaces/Quadratic.h"
 #include "MantidGeometry/Surfaces/Surface.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
@@ -34,7 +35,9 @@
 #include <boost/accumulators/statistics/stats.hpp>
 #include <memory>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <deque>
 #include <random>
 #include <stack>
@@ -1098,6 +1101,85 @@ double CSGObject::distance(const Geometry::Track &track) const {
   }
 }
 
+/**
+ * Calculate the path length inside the object along each of a batch of rays. The coefficients of the quadric
+ * surfaces are gathered once and each ray is intersected with them directly, which avoids building a Track and a
+ * LineIntersectVisit per ray. The ray is inside the object between two consecutive intersections if the midpoint of
+ * the interval is a valid point. Objects with a surface that is not a quadric use the Track based default.
+ * @param startPoints :: start point of each ray
+ * @param directions :: unit direction of each ray
+ * @param distances :: [output] distance travelled inside the object by each ray
+ */
+void CSGObject::distancesInside(const std::vector<Kernel::V3D> &startPoints, const std::vector<Kernel::V3D> &directions,
+                                std::vector<double> &distances) const {
+  if (startPoints.size() != directions.size())
+    throw std::invalid_argument("CSGObject::distancesInside - the number of start points and directions differ");
+  std::vector<std::array<double, 10>> equations;
+  equations.reserve(m_surList.size());
+  for (const auto *surface : m_surList) {
+    const auto *quadratic = dynamic_cast<const Quadratic *>(surface);
+    if (!quadratic) {
+      IObject::distancesInside(startPoints, directions, distances);
+      return;
+    }
+    const auto &baseEqn = quadratic->copyBaseEqn();
+    auto &equation = equations.emplace_back();
+    std::copy(baseEqn.cbegin(), baseEqn.cend(), equation.begin());
+  }
+
+  distances.resize(startPoints.size());
+  std::vector<double> roots;
+  roots.reserve(2 * equations.size());
+  for (size_t i = 0; i < startPoints.size(); ++i) {
+    const double a(startPoints[i][0]), b(startPoints[i][1]), c(startPoints[i][2]);
+    const double d(directions[i][0]), e(directions[i][1]), f(directions[i][2]);
+    roots.clear();
+    for (const auto &BN : equations) {
+      // same coefficients as Line::intersect(..., const Quadratic &)
+      const double quadCoef = BN[0] * d * d + BN[1] * e * e + BN[2] * f * f + BN[3] * d * e + BN[4] * d * f +
+                              BN[5] * e * f;
+      const double linCoef = 2 * BN[0] * a * d + 2 * BN[1] * b * e + 2 * BN[2] * c * f + BN[3] * (a * e + b * d) +
+                             BN[4] * (a * f + c * d) + BN[5] * (b * f + c * e) + BN[6] * d + BN[7] * e + BN[8] * f;
+      const double constCoef = BN[0] * a * a + BN[1] * b * b + BN[2] * c * c + BN[3] * a * b + BN[4] * a * c +
+                               BN[5] * b * c + BN[6] * a + BN[7] * b + BN[8] * c + BN[9];
+      if (std::abs(quadCoef) < Tolerance) {
+        // planes and rays parallel to the axis of a cylinder or cone
+        if (std::abs(linCoef) >= Tolerance) {
+          const double t = -constCoef / linCoef;
+          if (t > 0.0)
+            roots.emplace_back(t);
+        }
+        continue;
+      }
+      const double discriminant = linCoef * linCoef - 4.0 * quadCoef * constCoef;
+      if (discriminant < 0.0)
+        continue;
+      // numerically stable form of the two roots
+      const double q = -0.5 * (linCoef + std::copysign(std::sqrt(discriminant), linCoef));
+      const double t1 = q / quadCoef;
+      if (t1 > 0.0)
+        roots.emplace_back(t1);
+      if (q != 0.0) {
+        const double t2 = constCoef / q;
+        if (t2 > 0.0)
+          roots.emplace_back(t2);
+      }
+    }
+    std::sort(roots.begin(), roots.end());
+
+    double total(0.0), previous(0.0);
+    for (const double t : roots) {
+      if (t - previous > Tolerance) {
+        const auto midPoint = startPoints[i] + directions[i] * (0.5 * (previous + t));
+        if (isValid(midPoint))
+          total += t - previous;
+      }
+      previous = t;
+    }
+    distances[i] = total;
+  }
+}
+
 /**
  * Calculate if a point PT is a valid point on the track
  * @param point :: Point to calculate from.
@@ -0,0 +1,34 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/IObject.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/V3D.h"
+
+#include <stdexcept>
+
+namespace Mantid::Geometry {
+
+/**
+ * Calculate the path length inside the object along each of a batch of rays. This default traces a Track for each
+ * ray; objects that can intersect many rays more cheaply override it.
+ * @param startPoints :: start point of each ray
+ * @param directions :: unit direction of each ray
+ * @param distances :: [output] distance travelled inside the object by each ray
+ */
+void IObject::distancesInside(const std::vector<Kernel::V3D> &startPoints, const std::vector<Kernel::V3D> &directions,
+                              std::vector<double> &distances) const {
+  if (startPoints.size() != directions.size())
+    throw std::invalid_argument("IObject::distancesInside - the number of start points and directions differ");
+  distances.resize(startPoints.size());
+  for (size_t i = 0; i < startPoints.size(); ++i) {
+    Track track(startPoints[i], directions[i]);
+    interceptSurface(track);
+    distances[i] = track.totalDistInsideObject();
+  }
+}
+
+} // namespace Mantid::Geometry
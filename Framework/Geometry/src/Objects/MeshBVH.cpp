@@ -0,0 +1,186 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/MeshBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace Mantid::Geometry {
+
+namespace {
+/// Relative size, compared to the whole mesh, used to pad the boxes
+constexpr double RELATIVE_PADDING{1.e-6};
+} // namespace
+
+/**
+ * Build the hierarchy by recursively splitting the triangles at the median centroid along the longest axis.
+ * @param triangles :: indices into the vertices, three per triangle
+ * @param vertices :: vertices of the mesh
+ */
+MeshBVH::MeshBVH(const std::vector<uint32_t> &triangles, const std::vector<Kernel::V3D> &vertices) {
+  const auto numTriangles = static_cast<uint32_t>(triangles.size() / 3);
+  if (numTriangles == 0)
+    return;
+
+  // box and centroid of every triangle
+  std::vector<Node> triangleBoxes(numTriangles);
+  std::vector<std::array<double, 3>> centroids(numTriangles);
+  Node meshBox{{std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                std::numeric_limits<double>::max()},
+               {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(),
+                std::numeric_limits<double>::lowest()},
+               0,
+               0};
+  for (uint32_t i = 0; i < numTriangles; ++i) {
+    auto &box = triangleBoxes[i];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const double x1 = vertices[triangles[3 * i]][axis];
+      const double x2 = vertices[triangles[3 * i + 1]][axis];
+      const double x3 = vertices[triangles[3 * i + 2]][axis];
+      box.minPoint[axis] = std::min({x1, x2, x3});
+      box.maxPoint[axis] = std::max({x1, x2, x3});
+      centroids[i][axis] = (x1 + x2 + x3) / 3.;
+      meshBox.minPoint[axis] = std::min(meshBox.minPoint[axis], box.minPoint[axis]);
+      meshBox.maxPoint[axis] = std::max(meshBox.maxPoint[axis], box.maxPoint[axis]);
+    }
+  }
+
+  // pad the triangle boxes so rays touching an edge or starting just past a triangle are not missed
+  double diagonal2{0.};
+  for (size_t axis = 0; axis < 3; ++axis)
+    diagonal2 += (meshBox.maxPoint[axis] - meshBox.minPoint[axis]) * (meshBox.maxPoint[axis] - meshBox.minPoint[axis]);
+  const double padding = RELATIVE_PADDING * std::sqrt(diagonal2) + std::numeric_limits<double>::min();
+  for (auto &box : triangleBoxes) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      box.minPoint[axis] -= padding;
+      box.maxPoint[axis] += padding;
+    }
+  }
+
+  m_triangleOrder.resize(numTriangles);
+  std::iota(m_triangleOrder.begin(), m_triangleOrder.end(), 0);
+  // a balanced tree has just under two nodes per leaf
+  m_nodes.reserve(2 * (numTriangles / MAX_LEAF_SIZE + 1));
+  buildNode(0, numTriangles, centroids, triangleBoxes);
+}
+
+/**
+ * Create the node covering m_triangleOrder[first, last) and all of its children
+ * @returns The index of the node
+ */
+uint32_t MeshBVH::buildNode(const uint32_t first, const uint32_t last,
+                            const std::vector<std::array<double, 3>> &centroids, const std::vector<Node> &triangleBoxes) {
+  const auto nodeIndex = static_cast<uint32_t>(m_nodes.size());
+  m_nodes.emplace_back(triangleBoxes[m_triangleOrder[first]]);
+
+  // bounds of the triangles and of their centroids
+  std::array<double, 3> centroidMin = centroids[m_triangleOrder[first]];
+  std::array<double, 3> centroidMax = centroidMin;
+  for (uint32_t i = first + 1; i < last; ++i) {
+    const auto &box = triangleBoxes[m_triangleOrder[i]];
+    const auto &centroid = centroids[m_triangleOrder[i]];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      m_nodes[nodeIndex].minPoint[axis] = std::min(m_nodes[nodeIndex].minPoint[axis], box.minPoint[axis]);
+      m_nodes[nodeIndex].maxPoint[axis] = std::max(m_nodes[nodeIndex].maxPoint[axis], box.maxPoint[axis]);
+      centroidMin[axis] = std::min(centroidMin[axis], centroid[axis]);
+      centroidMax[axis] = std::max(centroidMax[axis], centroid[axis]);
+    }
+  }
+
+  // split along the axis where the centroids are most spread out
+  size_t splitAxis = 0;
+  for (size_t axis = 1; axis < 3; ++axis) {
+    if (centroidMax[axis] - centroidMin[axis] > centroidMax[splitAxis] - centroidMin[splitAxis])
+      splitAxis = axis;
+  }
+
+  // make a leaf if there are few triangles or they can not be separated
+  if (last - first <= MAX_LEAF_SIZE || centroidMax[splitAxis] <= centroidMin[splitAxis]) {
+    m_nodes[nodeIndex].offset = first;
+    m_nodes[nodeIndex].count = last - first;
+    return nodeIndex;
+  }
+
+  const uint32_t middle = first + (last - first) / 2;
+  std::nth_element(m_triangleOrder.begin() + first, m_triangleOrder.begin() + middle, m_triangleOrder.begin() + last,
+                   [&centroids, splitAxis](const auto lhs, const auto rhs) {
+                     return centroids[lhs][splitAxis] < centroids[rhs][splitAxis];
+                   });
+  // the first child immediately follows this node
+  buildNode(first, middle, centroids, triangleBoxes);
+  const auto secondChild = buildNode(middle, last, centroids, triangleBoxes);
+  m_nodes[nodeIndex].offset = secondChild;
+  m_nodes[nodeIndex].count = 0;
+  return nodeIndex;
+}
+
+/**
+ * Find the triangles whose (padded) bounding boxes are hit by the ray. Only these triangles can intersect the ray.
+ * @param start :: Start point of ray
+ * @param direction :: Direction of ray
+ * @param candidates :: Filled with the indices of the triangles, sorted so they are in the same order as the mesh
+ */
+void MeshBVH::getCandidateTriangles(const Kernel::V3D &start, const Kernel::V3D &direction,
+                                    std::vector<size_t> &candidates) const {
+  candidates.clear();
+  if (m_nodes.empty())
+    return;
+
+  // the depth of the tree is logarithmic in the number of triangles so this is plenty
+  std::array<uint32_t, 64> stack;
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const auto &node = m_nodes[stack[--stackSize]];
+    if (!rayIntersectsBox(node, start, direction))
+      continue;
+    if (node.count > 0) {
+      for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+        candidates.emplace_back(m_triangleOrder[i]);
+    } else {
+      const auto nodeIndex = static_cast<uint32_t>(&node - m_nodes.data());
+      stack[stackSize++] = node.offset;
+      stack[stackSize++] = nodeIndex + 1;
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+}
+
+/**
+ * Slab test of the half line start + t * direction, with t >= 0, against the box of a node
+ * @returns true if the ray passes through the box
+ */
+bool MeshBVH::rayIntersectsBox(const Node &node, const Kernel::V3D &start, const Kernel::V3D &direction) {
+  double tNear{0.};
+  double tFar{std::numeric_limits<double>::max()};
+  for (size_t axis = 0; axis < 3; ++axis) {
+    if (direction[axis] == 0.) {
+      // parallel to the slab so must start inside it
+      if (start[axis] < node.minPoint[axis] || start[axis] > node.maxPoint[axis])
+        return false;
+      continue;
+    }
+    const double inverse = 1. / direction[axis];
+    double t1 = (node.minPoint[axis] - start[axis]) * inverse;
+    double t2 = (node.maxPoint[axis] - start[axis]) * inverse;
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tNear = std::max(tNear, t1);
+    tFar = std::min(tFar, t2);
+    if (tNear > tFar)
+      return false;
+  }
+  return true;
+}
+
+size_t MeshBVH::numberOfNodes() const { return m_nodes.size(); }
+
+size_t MeshBVH::numberOfTriangles() const { return m_triangleOrder.size(); }
+
+} // namespace Mantid::Geometry
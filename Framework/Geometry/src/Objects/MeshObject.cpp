@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidGeometry/Objects/MeshObject.h"
+#include "MantidGeometry/Objects/MeshBVH.h"
 #include "MantidGeometry/Objects/MeshObjectCommon.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/RandomPoint.h"
@@ -35,6 +36,8 @@ MeshObject::MeshObject(std::vector<uint32_t> &&faces, std::vector<Kernel::V3D> &
   initialize();
 }
 
+MeshObject::~MeshObject() = default;
+
 // Do things that need to be done in constructor
 void MeshObject::initialize() {
 
@@ -176,7 +179,10 @@ int MeshObject::interceptSurface(Geometry::Track &UT) const {
 double MeshObject::distance(const Track &track) const {
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection unused;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  std::vector<size_t> candidates;
+  getBVH().getCandidateTriangles(track.startPoint(), track.direction(), candidates);
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(track.startPoint(), track.direction(), vertex1, vertex2, vertex3,
                                                 intersection, unused)) {
       return track.startPoint().distance(intersection);
@@ -199,9 +205,14 @@ void MeshObject::getIntersections(const Kernel::V3D &start, const Kernel::V3D &d
                                   std::vector<Kernel::V3D> &intersectionPoints,
                                   std::vector<TrackDirection> &entryExitFlags) const {
 
+  // only the triangles whose bounding boxes are hit by the ray need testing
+  std::vector<size_t> candidates;
+  getBVH().getCandidateTriangles(start, direction, candidates);
+
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection entryExit;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertex1, vertex2, vertex3, intersection, entryExit)) {
       intersectionPoints.emplace_back(intersection);
       entryExitFlags.emplace_back(entryExit);
@@ -210,6 +221,32 @@ void MeshObject::getIntersections(const Kernel::V3D &start, const Kernel::V3D &d
   // still need to deal with edge cases
 }
 
+/**
+ * Get the bounding volume hierarchy of the triangles. This is built on the first call so that meshes that are never
+ * ray traced do not pay for it.
+ * @returns The bounding volume hierarchy for the current vertex positions
+ */
+const MeshBVH &MeshObject::getBVH() const {
+  if (!m_bvhBuilt.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(m_bvhMutex);
+    if (!m_bvh)
+      m_bvh = std::make_unique<MeshBVH>(m_triangles, m_vertices);
+    m_bvhBuilt.store(true, std::memory_order_release);
+  }
+  return *m_bvh;
+}
+
+/**
+ * Discard the bounding box and bounding volume hierarchy so they are recalculated on next use. This must be called
+ * whenever the vertices are changed.
+ */
+void MeshObject::clearGeometryCache() {
+  std::lock_guard<std::mutex> lock(m_bvhMutex);
+  m_boundingBox = BoundingBox();
+  m_bvhBuilt.store(false, std::memory_order_release);
+  m_bvh.reset();
+}
+
 /*
  * Get a triangle - useful for iterating over triangles
  * @param index :: Index of triangle in MeshObject
@@ -476,6 +513,7 @@ std::shared_ptr<GeometryHandler> MeshObject::getGeometryHandler() const {
 void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
   std::for_each(m_vertices.begin(), m_vertices.end(),
                 [&rotationMatrix](auto &vertex) { vertex.rotate(rotationMatrix); });
+  clearGeometryCache();
 }
 
 /**
@@ -485,6 +523,7 @@ void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
 void MeshObject::translate(const Kernel::V3D &translationVector) {
   std::transform(m_vertices.cbegin(), m_vertices.cend(), m_vertices.begin(),
                  [&translationVector](const auto &vertex) { return vertex + translationVector; });
+  clearGeometryCache();
 }
 
 /**
@@ -494,6 +533,7 @@ void MeshObject::translate(const Kernel::V3D &translationVector) {
 void MeshObject::scale(const double scaleFactor) {
   std::transform(m_vertices.cbegin(), m_vertices.cend(), m_vertices.begin(),
                  [&scaleFactor](const auto &vertex) { return vertex * scaleFactor; });
+  clearGeometryCache();
 }
 
 /**
@@ -519,6 +559,7 @@ void MeshObject::multiply(const Kernel::Matrix<double> &matrix) {
     Kernel::V3D newvertex(vertexout[0], vertexout[1], vertexout[2]);
     vertex = newvertex;
   }
+  clearGeometryCache();
 }
 
 /**
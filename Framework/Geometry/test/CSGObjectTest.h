@@ -399,6 +399,51 @@ public:
     TS_ASSERT_THROWS(geom_obj->distance(track), const std::runtime_error &)
   }
 
+  void testDistancesInsideMatchesTracks() {
+    const std::vector<std::shared_ptr<CSGObject>> shapes{
+        ComponentCreationHelper::createSphere(1.0), createCappedCylinder(),
+        ComponentCreationHelper::createHollowCylinder(0.5, 1.0, 2.0, V3D(0., -1., 0.), V3D(0., 1., 0.), "hol-cyl"),
+        ComponentCreationHelper::createHollowShell(0.5, 1.0),
+        ComponentCreationHelper::createCuboid(0.5, 1.0, 1.5, 30.0, V3D(0., 0., 1.))};
+    Kernel::MersenneTwister rng(1234, -1.0, 1.0);
+    std::vector<V3D> startPoints, directions;
+    for (size_t i = 0; i < 500; ++i) {
+      // start points both inside and outside the shapes
+      startPoints.emplace_back(4. * rng.nextValue(), 4. * rng.nextValue(), 4. * rng.nextValue());
+      directions.emplace_back(normalize(V3D(rng.nextValue(), rng.nextValue(), rng.nextValue())));
+    }
+
+    std::vector<double> distances;
+    for (const auto &shape : shapes) {
+      shape->distancesInside(startPoints, directions, distances);
+      TS_ASSERT_EQUALS(distances.size(), startPoints.size());
+      for (size_t i = 0; i < startPoints.size(); ++i) {
+        Track track(startPoints[i], directions[i]);
+        shape->interceptSurface(track);
+        TS_ASSERT_DELTA(track.totalDistInsideObject(), distances[i], 1e-10);
+      }
+    }
+  }
+
+  void testDistancesInsideFromCentreOfSphere() {
+    auto sphere = ComponentCreationHelper::createSphere(4.1);
+    const std::vector<V3D> startPoints(3, V3D(0., 0., 0.));
+    const std::vector<V3D> directions{V3D(1., 0., 0.), V3D(0., -1., 0.), normalize(V3D(1., 1., 1.))};
+    std::vector<double> distances;
+
+    sphere->distancesInside(startPoints, directions, distances);
+
+    TS_ASSERT_EQUALS(distances.size(), 3);
+    for (const auto distance : distances)
+      TS_ASSERT_DELTA(4.1, distance, 1e-10);
+  }
+
+  void testDistancesInsideThrowsForMismatchedRays() {
+    auto sphere = ComponentCreationHelper::createSphere(4.1);
+    std::vector<double> distances;
+    TS_ASSERT_THROWS(sphere->distancesInside({V3D()}, {}, distances), const std::invalid_argument &)
+  }
+
   void testTrackTwoIsolatedCubes()
   /**
   Test a track going through an object
@@ -0,0 +1,276 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/InstrumentBinaryCache.h"
+#include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Interpolation.h"
+#include "MantidKernel/Strings.h"
+#include <cxxtest/TestSuite.h>
+
+#include <filesystem>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::ConfigService;
+
+class InstrumentBinaryCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static InstrumentBinaryCacheTest *createSuite() { return new InstrumentBinaryCacheTest(); }
+  static void destroySuite(InstrumentBinaryCacheTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_directory = std::filesystem::temp_directory_path() / "InstrumentBinaryCacheTest";
+    std::filesystem::create_directories(m_directory);
+    m_cacheFile = (m_directory / "instrument.idfcache").string();
+  }
+
+  void tearDown() override { std::filesystem::remove_all(m_directory); }
+
+  void test_load_missing_file() {
+    InstrumentBinaryCache cache(m_cacheFile, "key");
+    TS_ASSERT(!cache.load("For Unit Testing"));
+  }
+
+  void test_round_trip() {
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", "For Unit Testing");
+    InstrumentBinaryCache cache(m_cacheFile, "key");
+    TS_ASSERT(cache.save(*instrument, false));
+
+    const auto loaded = cache.load("For Unit Testing");
+    TS_ASSERT(loaded);
+    if (!loaded)
+      return;
+    assertSameInstrument(*instrument, *loaded);
+    TS_ASSERT(!cache.shapes().empty());
+  }
+
+  void test_round_trip_parameters() {
+    const auto instrument = parse("IDF_for_UNIT_TESTING2.xml", "For Unit Testing2");
+    InstrumentBinaryCache cache(m_cacheFile, "key");
+    TS_ASSERT(cache.save(*instrument, false));
+
+    const auto loaded = cache.load("For Unit Testing2");
+    TS_ASSERT(loaded);
+    if (!loaded)
+      return;
+    assertSameInstrument(*instrument, *loaded);
+
+    const auto &expected = instrument->getLogfileCache();
+    const auto &actual = loaded->getLogfileCache();
+    TS_ASSERT_EQUALS(actual.size(), expected.size());
+    auto actualParameter = actual.cbegin();
+    for (const auto &[key, parameter] : expected) {
+      if (actualParameter == actual.cend())
+        break;
+      TS_ASSERT_EQUALS(actualParameter->first.first, key.first);
+      TS_ASSERT_EQUALS(actualParameter->first.second->getFullName(), key.second->getFullName());
+      TS_ASSERT_EQUALS(actualParameter->second->m_value, parameter->m_value);
+      TS_ASSERT_EQUALS(actualParameter->second->m_type, parameter->m_type);
+      TS_ASSERT_EQUALS(actualParameter->second->m_constraint, parameter->m_constraint);
+      TS_ASSERT_EQUALS(actualParameter->second->m_penaltyFactor, parameter->m_penaltyFactor);
+      TS_ASSERT_EQUALS(actualParameter->second->m_formula, parameter->m_formula);
+      TS_ASSERT_EQUALS(actualParameter->second->m_resultUnit, parameter->m_resultUnit);
+      TS_ASSERT_EQUALS(actualParameter->second->m_component->getFullName(), parameter->m_component->getFullName());
+      if (parameter->m_interpolation && parameter->m_interpolation->containData()) {
+        TS_ASSERT_EQUALS(actualParameter->second->m_interpolation->value(1000.),
+                         parameter->m_interpolation->value(1000.));
+      }
+      ++actualParameter;
+    }
+  }
+
+  void test_round_trip_rectangular_detector() {
+    const auto instrument = parse("IDF_for_RECTANGULAR_UNIT_TESTING.xml", "RectangularUnitTest");
+    InstrumentBinaryCache cache(m_cacheFile, "key");
+    TS_ASSERT(cache.save(*instrument, false));
+
+    const auto loaded = cache.load("RectangularUnitTest");
+    TS_ASSERT(loaded);
+    if (!loaded)
+      return;
+    assertSameInstrument(*instrument, *loaded);
+    const auto bank = std::dynamic_pointer_cast<const RectangularDetector>(loaded->getComponentByName("bank1"));
+    TS_ASSERT(bank);
+    if (!bank)
+      return;
+    TS_ASSERT_EQUALS(bank->nelements(), 100);
+    TS_ASSERT_EQUALS(bank->getAtXY(1, 1)->getID(), 1301);
+  }
+
+  void test_round_trip_logfile_units() {
+    const auto instrument = parse("IDF_for_UNIT_TESTING4.xml", "unit testing 4");
+    TS_ASSERT_EQUALS(instrument->getLogfileUnit().at("angle"), "radian");
+    InstrumentBinaryCache cache(m_cacheFile, "key");
+    TS_ASSERT(cache.save(*instrument, false));
+
+    const auto loaded = cache.load("unit testing 4");
+    TS_ASSERT(loaded);
+    if (!loaded)
+      return;
+    assertSameInstrument(*instrument, *loaded);
+    TS_ASSERT_EQUALS(loaded->getLogfileUnit(), instrument->getLogfileUnit());
+  }
+
+  void test_valid_to_date_is_the_load_time_if_not_given() {
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", "For Unit Testing");
+    InstrumentBinaryCache cache(m_cacheFile, "key");
+    TS_ASSERT(cache.save(*instrument, true));
+
+    const auto before = Mantid::Types::Core::DateAndTime::getCurrentTime();
+    const auto loaded = cache.load("For Unit Testing");
+    TS_ASSERT(loaded);
+    if (loaded)
+      TS_ASSERT(loaded->getValidToDate() >= before);
+  }
+
+  void test_cache_is_ignored_for_another_key() {
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", "For Unit Testing");
+    TS_ASSERT(InstrumentBinaryCache(m_cacheFile, "key").save(*instrument, false));
+
+    InstrumentBinaryCache cache(m_cacheFile, "another key");
+    TS_ASSERT(!cache.load("For Unit Testing"));
+  }
+
+  void test_cache_is_ignored_if_corrupt() {
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", "For Unit Testing");
+    InstrumentBinaryCache cache(m_cacheFile, "key");
+    TS_ASSERT(cache.save(*instrument, false));
+    std::filesystem::resize_file(m_cacheFile, std::filesystem::file_size(m_cacheFile) - 8);
+
+    TS_ASSERT(!cache.load("For Unit Testing"));
+    TS_ASSERT(cache.shapes().empty());
+  }
+
+  void test_parser_reads_instrument_from_cache() {
+    auto &config = ConfigService::Instance();
+    const auto previousValue = config.getString("instrumentDefinition.binaryCache");
+    config.setString("instrumentDefinition.binaryCache", "On");
+
+    const std::string filename = config.getInstrumentDirectory() + "/unit_testing/IDF_for_UNIT_TESTING2.xml";
+    const std::string xmlText = Mantid::Kernel::Strings::loadFile(filename);
+    InstrumentDefinitionParser parser(filename, "For Unit Testing2", xmlText);
+    const auto cacheFilename = parser.createInstrumentCacheFileName();
+    std::filesystem::remove(cacheFilename);
+    const auto instrument = parser.parseXML(nullptr);
+    TS_ASSERT(!parser.isReadFromInstrumentCache());
+    TS_ASSERT(std::filesystem::exists(cacheFilename));
+
+    InstrumentDefinitionParser cachedParser(filename, "For Unit Testing2", xmlText);
+    const auto loaded = cachedParser.parseXML(nullptr);
+    TS_ASSERT(cachedParser.isReadFromInstrumentCache());
+    TS_ASSERT_EQUALS(loaded->getFilename(), filename);
+    TS_ASSERT_EQUALS(loaded->getXmlText(), xmlText);
+    assertSameInstrument(*instrument, *loaded);
+
+    config.setString("instrumentDefinition.binaryCache", previousValue);
+    std::filesystem::remove(cacheFilename);
+    std::filesystem::remove(parser.createVTPFileName());
+  }
+
+private:
+  std::shared_ptr<Instrument> parse(const std::string &idf, const std::string &name) {
+    const std::string filename = ConfigService::Instance().getInstrumentDirectory() + "/unit_testing/" + idf;
+    const std::string xmlText = Mantid::Kernel::Strings::loadFile(filename);
+    InstrumentDefinitionParser parser(filename, name, xmlText);
+    auto instrument = parser.parseXML(nullptr);
+    std::filesystem::remove(parser.createVTPFileName());
+    return instrument;
+  }
+
+  void assertSameInstrument(const Instrument &expected, const Instrument &actual) {
+    TS_ASSERT_EQUALS(actual.getName(), expected.getName());
+    TS_ASSERT_EQUALS(actual.getValidFromDate(), expected.getValidFromDate());
+    TS_ASSERT_EQUALS(actual.getValidToDate(), expected.getValidToDate());
+    TS_ASSERT_EQUALS(actual.getDefaultView(), expected.getDefaultView());
+    const auto expectedFrame = expected.getReferenceFrame();
+    const auto actualFrame = actual.getReferenceFrame();
+    TS_ASSERT_EQUALS(actualFrame->pointingUp(), expectedFrame->pointingUp());
+    TS_ASSERT_EQUALS(actualFrame->pointingAlongBeam(), expectedFrame->pointingAlongBeam());
+    TS_ASSERT_EQUALS(actualFrame->pointingThetaSign(), expectedFrame->pointingThetaSign());
+    TS_ASSERT_EQUALS(actual.getSource()->getName(), expected.getSource()->getName());
+    TS_ASSERT_EQUALS(actual.getSample()->getName(), expected.getSample()->getName());
+    TS_ASSERT_EQUALS(actual.getDetectorIDs(), expected.getDetectorIDs());
+    TS_ASSERT_EQUALS(actual.getMonitors(), expected.getMonitors());
+
+    std::vector<IComponent_const_sptr> expectedComponents;
+    std::vector<IComponent_const_sptr> actualComponents;
+    expected.getChildren(expectedComponents, true);
+    actual.getChildren(actualComponents, true);
+    TS_ASSERT_EQUALS(actualComponents.size(), expectedComponents.size());
+    for (size_t i = 0; i < std::min(actualComponents.size(), expectedComponents.size()); ++i) {
+      const auto &expectedComponent = expectedComponents[i];
+      const auto &actualComponent = actualComponents[i];
+      TS_ASSERT_EQUALS(actualComponent->getName(), expectedComponent->getName());
+      TS_ASSERT_EQUALS(actualComponent->getPos(), expectedComponent->getPos());
+      TS_ASSERT_EQUALS(actualComponent->getRotation(), expectedComponent->getRotation());
+      TS_ASSERT_EQUALS(actualComponent->getSideBySideViewPos().has_value(),
+                       expectedComponent->getSideBySideViewPos().has_value());
+      const auto expectedObject = std::dynamic_pointer_cast<const IObjComponent>(expectedComponent);
+      const auto actualObject = std::dynamic_pointer_cast<const IObjComponent>(actualComponent);
+      TS_ASSERT_EQUALS(actualObject == nullptr, expectedObject == nullptr);
+      if (expectedObject && actualObject && expectedObject->shape() && actualObject->shape()) {
+        TS_ASSERT_EQUALS(actualObject->shape()->getName(), expectedObject->shape()->getName());
+        TS_ASSERT_EQUALS(actualObject->shape()->getBoundingBox().maxPoint(),
+                         expectedObject->shape()->getBoundingBox().maxPoint());
+      }
+      const auto expectedDetector = std::dynamic_pointer_cast<const IDetector>(expectedComponent);
+      const auto actualDetector = std::dynamic_pointer_cast<const IDetector>(actualComponent);
+      TS_ASSERT_EQUALS(actualDetector == nullptr, expectedDetector == nullptr);
+      if (expectedDetector && actualDetector)
+        TS_ASSERT_EQUALS(actualDetector->getID(), expectedDetector->getID());
+    }
+  }
+
+  std::filesystem::path m_directory;
+  std::string m_cacheFile;
+};
+
+class InstrumentBinaryCacheTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static InstrumentBinaryCacheTestPerformance *createSuite() { return new InstrumentBinaryCacheTestPerformance(); }
+  static void destroySuite(InstrumentBinaryCacheTestPerformance *suite) { delete suite; }
+
+  InstrumentBinaryCacheTestPerformance()
+      : m_filename(ConfigService::Instance().getInstrumentDirectory() + "/WISH_Definition_10Panels.xml"),
+        m_xmlText(Mantid::Kernel::Strings::loadFile(m_filename)),
+        m_cacheFile((std::filesystem::temp_directory_path() / "InstrumentBinaryCacheTestPerformance.idfcache")
+                        .string()) {
+    InstrumentDefinitionParser parser(m_filename, "WISH", m_xmlText);
+    const auto instrument = parser.parseXML(nullptr);
+    InstrumentBinaryCache(m_cacheFile, "WISH").save(*instrument, false);
+  }
+
+  ~InstrumentBinaryCacheTestPerformance() override { std::filesystem::remove(m_cacheFile); }
+
+  void test_load_wish_from_xml() {
+    InstrumentDefinitionParser parser(m_filename, "WISH", m_xmlText);
+    const auto instrument = parser.parseXML(nullptr);
+    TS_ASSERT_EQUALS(instrument->getNumberDetectors(), 778245);
+  }
+
+  void test_load_wish_from_cache() {
+    InstrumentBinaryCache cache(m_cacheFile, "WISH");
+    const auto instrument = cache.load("WISH");
+    TS_ASSERT(instrument);
+    if (instrument)
+      TS_ASSERT_EQUALS(instrument->getNumberDetectors(), 778245);
+  }
+
+private:
+  const std::string m_filename;
+  const std::string m_xmlText;
+  const std::string m_cacheFile;
+};
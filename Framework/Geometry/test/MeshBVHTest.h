@@ -0,0 +1,214 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/Objects/MeshBVH.h"
+#include "MantidGeometry/Objects/MeshObjectCommon.h"
+#include "MantidKernel/MersenneTwister.h"
+#include "MantidKernel/V3D.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <cmath>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+namespace {
+/// Closed sphere of radius 1 centred at the origin made from latitude/longitude strips
+void createSphere(const uint32_t numLatitude, const uint32_t numLongitude, std::vector<uint32_t> &triangles,
+                  std::vector<V3D> &vertices) {
+  vertices.clear();
+  triangles.clear();
+  vertices.emplace_back(0., 0., 1.);
+  for (uint32_t i = 1; i < numLatitude; ++i) {
+    const double theta = M_PI * static_cast<double>(i) / static_cast<double>(numLatitude);
+    for (uint32_t j = 0; j < numLongitude; ++j) {
+      const double phi = 2. * M_PI * static_cast<double>(j) / static_cast<double>(numLongitude);
+      vertices.emplace_back(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+    }
+  }
+  vertices.emplace_back(0., 0., -1.);
+  const auto southPole = static_cast<uint32_t>(vertices.size() - 1);
+
+  const auto ringVertex = [numLongitude](const uint32_t ring, const uint32_t j) {
+    return 1 + (ring - 1) * numLongitude + (j % numLongitude);
+  };
+  for (uint32_t j = 0; j < numLongitude; ++j) {
+    triangles.insert(triangles.end(), {0, ringVertex(1, j), ringVertex(1, j + 1)});
+    for (uint32_t ring = 1; ring + 1 < numLatitude; ++ring) {
+      triangles.insert(triangles.end(), {ringVertex(ring, j), ringVertex(ring + 1, j), ringVertex(ring + 1, j + 1)});
+      triangles.insert(triangles.end(), {ringVertex(ring, j), ringVertex(ring + 1, j + 1), ringVertex(ring, j + 1)});
+    }
+    triangles.insert(triangles.end(), {ringVertex(numLatitude - 1, j), southPole, ringVertex(numLatitude - 1, j + 1)});
+  }
+}
+
+/// The triangles that the ray intersects found by testing all of them
+std::vector<size_t> bruteForceIntersections(const V3D &start, const V3D &direction,
+                                            const std::vector<uint32_t> &triangles, const std::vector<V3D> &vertices) {
+  std::vector<size_t> result;
+  V3D intersection;
+  TrackDirection entryExit;
+  for (size_t i = 0; i < triangles.size() / 3; ++i) {
+    if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertices[triangles[3 * i]],
+                                                vertices[triangles[3 * i + 1]], vertices[triangles[3 * i + 2]],
+                                                intersection, entryExit))
+      result.emplace_back(i);
+  }
+  return result;
+}
+
+/// The triangles that the ray intersects found by only testing the candidates
+std::vector<size_t> bvhIntersections(const MeshBVH &bvh, const V3D &start, const V3D &direction,
+                                     const std::vector<uint32_t> &triangles, const std::vector<V3D> &vertices) {
+  std::vector<size_t> candidates;
+  bvh.getCandidateTriangles(start, direction, candidates);
+  std::vector<size_t> result;
+  V3D intersection;
+  TrackDirection entryExit;
+  for (const auto i : candidates) {
+    if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertices[triangles[3 * i]],
+                                                vertices[triangles[3 * i + 1]], vertices[triangles[3 * i + 2]],
+                                                intersection, entryExit))
+      result.emplace_back(i);
+  }
+  return result;
+}
+
+V3D randomPoint(Mantid::Kernel::MersenneTwister &rng, const double halfWidth) {
+  return V3D(rng.nextValue(-halfWidth, halfWidth), rng.nextValue(-halfWidth, halfWidth),
+             rng.nextValue(-halfWidth, halfWidth));
+}
+
+V3D randomDirection(Mantid::Kernel::MersenneTwister &rng) {
+  V3D direction(rng.nextValue(-1., 1.), rng.nextValue(-1., 1.), rng.nextValue(-1., 1.));
+  direction.normalize();
+  return direction;
+}
+} // namespace
+
+class MeshBVHTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MeshBVHTest *createSuite() { return new MeshBVHTest(); }
+  static void destroySuite(MeshBVHTest *suite) { delete suite; }
+
+  void test_empty_mesh() {
+    const MeshBVH bvh({}, {});
+    TS_ASSERT_EQUALS(bvh.numberOfNodes(), 0);
+    std::vector<size_t> candidates{1, 2, 3};
+    bvh.getCandidateTriangles(V3D(0, 0, 0), V3D(0, 0, 1), candidates);
+    TS_ASSERT(candidates.empty());
+  }
+
+  void test_tree_is_built() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    createSphere(20, 40, triangles, vertices);
+    const MeshBVH bvh(triangles, vertices);
+    TS_ASSERT_EQUALS(bvh.numberOfTriangles(), triangles.size() / 3);
+    TS_ASSERT_LESS_THAN(1, bvh.numberOfNodes());
+    TS_ASSERT_LESS_THAN(bvh.numberOfNodes(), triangles.size() / 3);
+  }
+
+  void test_ray_missing_mesh_has_no_candidates() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    createSphere(20, 40, triangles, vertices);
+    const MeshBVH bvh(triangles, vertices);
+    std::vector<size_t> candidates;
+    bvh.getCandidateTriangles(V3D(2, 2, 0), V3D(0, 0, 1), candidates);
+    TS_ASSERT(candidates.empty());
+    // pointing away from the sphere
+    bvh.getCandidateTriangles(V3D(0, 0, 2), V3D(0, 0, 1), candidates);
+    TS_ASSERT(candidates.empty());
+  }
+
+  void test_candidates_are_few_and_sorted() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    createSphere(50, 100, triangles, vertices);
+    const MeshBVH bvh(triangles, vertices);
+    std::vector<size_t> candidates;
+    bvh.getCandidateTriangles(V3D(0.01, 0.02, -2), V3D(0, 0, 1), candidates);
+    TS_ASSERT(!candidates.empty());
+    TS_ASSERT_LESS_THAN(candidates.size(), triangles.size() / 30);
+    TS_ASSERT(std::is_sorted(candidates.cbegin(), candidates.cend()));
+  }
+
+  void test_same_intersections_as_brute_force() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    createSphere(30, 60, triangles, vertices);
+    const MeshBVH bvh(triangles, vertices);
+
+    Mantid::Kernel::MersenneTwister rng(12345);
+    for (size_t i = 0; i < 2000; ++i) {
+      const V3D start = randomPoint(rng, 1.5);
+      const V3D direction = randomDirection(rng);
+      TS_ASSERT_EQUALS(bvhIntersections(bvh, start, direction, triangles, vertices),
+                       bruteForceIntersections(start, direction, triangles, vertices));
+    }
+  }
+
+  void test_same_intersections_as_brute_force_for_axis_aligned_rays() {
+    // rays along the axes through vertices and edges of the mesh, and starting on the surface
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    createSphere(8, 16, triangles, vertices);
+    const MeshBVH bvh(triangles, vertices);
+
+    for (const auto &direction : {V3D(1, 0, 0), V3D(0, 1, 0), V3D(0, 0, 1), V3D(-1, 0, 0), V3D(0, 0, -1)}) {
+      for (const auto &start : vertices) {
+        TS_ASSERT_EQUALS(bvhIntersections(bvh, start, direction, triangles, vertices),
+                         bruteForceIntersections(start, direction, triangles, vertices));
+      }
+      TS_ASSERT_EQUALS(bvhIntersections(bvh, V3D(0, 0, 0), direction, triangles, vertices),
+                       bruteForceIntersections(V3D(0, 0, 0), direction, triangles, vertices));
+    }
+  }
+};
+
+class MeshBVHTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MeshBVHTestPerformance *createSuite() { return new MeshBVHTestPerformance(); }
+  static void destroySuite(MeshBVHTestPerformance *suite) { delete suite; }
+
+  MeshBVHTestPerformance() : m_rng(200000) {
+    // about 10^5 triangles
+    createSphere(250, 200, m_triangles, m_vertices);
+    for (size_t i = 0; i < NUM_RAYS; ++i) {
+      m_starts.emplace_back(randomPoint(m_rng, 1.));
+      m_directions.emplace_back(randomDirection(m_rng));
+    }
+  }
+
+  void test_build() { const MeshBVH bvh(m_triangles, m_vertices); }
+
+  void test_intersections_brute_force() {
+    for (size_t i = 0; i < NUM_RAYS; ++i)
+      bruteForceIntersections(m_starts[i], m_directions[i], m_triangles, m_vertices);
+  }
+
+  void test_intersections_bvh() {
+    const MeshBVH bvh(m_triangles, m_vertices);
+    for (size_t i = 0; i < NUM_RAYS; ++i)
+      bvhIntersections(bvh, m_starts[i], m_directions[i], m_triangles, m_vertices);
+  }
+
+private:
+  static constexpr size_t NUM_RAYS{1000};
+  Mantid::Kernel::MersenneTwister m_rng;
+  std::vector<uint32_t> m_triangles;
+  std::vector<V3D> m_vertices;
+  std::vector<V3D> m_starts;
+  std::vector<V3D> m_directions;
+};
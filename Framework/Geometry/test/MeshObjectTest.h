@@ -899,6 +899,21 @@ public:
     auto moved = octahedron->getVertices();
     TS_ASSERT_DELTA(moved, checkVector, 1e-8);
   }
+
+  void testInterceptAfterTranslation()
+  /* The cached triangle search structure must follow the mesh when it moves */
+  {
+    auto cube = createCube(2.0, V3D(0.0, 0.0, 0.0));
+    Track track(V3D(-5, 0, 0), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(cube->interceptSurface(track), 1);
+    TS_ASSERT_DELTA(cube->distance(Track(V3D(-5, 0, 0), V3D(1, 0, 0))), 4.0, 1e-8);
+
+    cube->translate(V3D(0.0, 0.0, 0.5));
+    Track movedTrack(V3D(-5, 0, 1.25), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(cube->interceptSurface(movedTrack), 1);
+    TS_ASSERT_EQUALS(movedTrack.cbegin()->entryPoint, V3D(-1, 0, 1.25));
+    TS_ASSERT_EQUALS(movedTrack.cbegin()->exitPoint, V3D(1, 0, 1.25));
+  }
 };
 
 // -----------------------------------------------------------------------------
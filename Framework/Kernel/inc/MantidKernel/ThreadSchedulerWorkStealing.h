@@ -0,0 +1,85 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : A ThreadScheduler with one queue of tasks per thread, each with its own lock, so
+ * threads do not all contend for a single lock when there are many small tasks.
+ *
+ * - A task pushed by a thread running a task of this scheduler goes on the queue of that thread; tasks pushed from
+ *   anywhere else go on the cheaper of two queues.
+ * - A thread takes the newest task from its own queue first, so tasks that create tasks keep working on the same
+ *   data. When its queue is empty it steals the oldest task from the queue with the highest total cost.
+ * - Tasks whose mutex is held by a running task are skipped in favour of other tasks, as in ThreadSchedulerMutexes.
+ *   If only such tasks are left one is returned anyway and the thread waits for the mutex.
+ *
+ * The number of queues should match the number of threads of the ThreadPool. Thread numbers beyond it share queues.
+ */
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numQueues = 0);
+
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(std::shared_ptr<Task> newTask) override;
+
+  std::shared_ptr<Task> pop(size_t threadnum) override;
+
+  void finished(Task *task, size_t threadnum) override;
+
+  size_t size() override;
+
+  bool empty() override;
+
+  void clear() override final;
+
+  /// The number of queues of tasks
+  size_t numberOfQueues() const { return m_queues.size(); }
+
+private:
+  /// The tasks of one thread, aligned so the locks of neighbouring queues are not on the same cache line
+  struct alignas(64) TaskQueue {
+    std::mutex lock;
+    std::deque<std::shared_ptr<Task>> tasks;
+    /// Number of tasks. Only changed with the lock held but may be read without it.
+    std::atomic<size_t> count{0};
+    /// Total cost of the tasks. Only changed with the lock held but may be read without it.
+    std::atomic<double> cost{0.};
+  };
+
+  std::shared_ptr<Task> findTask(const size_t own);
+  std::shared_ptr<Task> takeFromQueue(TaskQueue &queue, const bool newest, const bool ignoreMutexes);
+  bool acquireMutex(const std::shared_ptr<std::mutex> &mutex, const bool ignoreBusy);
+  size_t lowestCostQueue();
+  size_t highestCostQueue(const size_t exclude) const;
+
+  /// One queue per thread
+  std::vector<std::unique_ptr<TaskQueue>> m_queues;
+  /// Number of tasks in all queues
+  std::atomic<size_t> m_size{0};
+  /// Where the search for the lowest cost queue starts, so tasks of equal cost are spread evenly
+  std::atomic<size_t> m_nextPushQueue{0};
+  /// Protects m_busyMutexes
+  std::mutex m_busyMutexesLock;
+  /// Number of popped, unfinished tasks using each mutex
+  std::map<std::shared_ptr<std::mutex>, size_t> m_busyMutexes;
+};
+
+} // namespace Kernel
+} // namespace Mantid
@@ -0,0 +1,231 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+
+#include <algorithm>
+
+namespace Mantid::Kernel {
+
+namespace {
+/// The queue of the thread calling pop(), so tasks pushed by a running task go on the queue of its thread
+struct WorkerQueue {
+  const ThreadSchedulerWorkStealing *scheduler{nullptr};
+  size_t queue{0};
+};
+thread_local WorkerQueue t_workerQueue;
+} // namespace
+
+/**
+ * Constructor
+ * @param numQueues :: number of queues, which should be the number of threads of the ThreadPool. Default 0 means
+ * the number of cores, as for the ThreadPool.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numQueues) : ThreadScheduler() {
+  if (numQueues == 0)
+    numQueues = std::max<size_t>(ThreadPool::getNumPhysicalCores(), 1);
+  m_queues.reserve(numQueues);
+  for (size_t i = 0; i < numQueues; ++i)
+    m_queues.emplace_back(std::make_unique<TaskQueue>());
+}
+
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() {
+  // a new scheduler at the same address must not inherit the queue of this thread
+  if (t_workerQueue.scheduler == this)
+    t_workerQueue = WorkerQueue();
+  clear();
+}
+
+/**
+ * Add a Task to the queue of the calling thread if it is running a task of this scheduler, otherwise to the queue
+ * with the lowest total cost.
+ * @param newTask :: Task to add
+ */
+void ThreadSchedulerWorkStealing::push(std::shared_ptr<Task> newTask) {
+  const size_t index = (t_workerQueue.scheduler == this) ? t_workerQueue.queue % m_queues.size() : lowestCostQueue();
+  auto &queue = *m_queues[index];
+  const double cost = newTask->cost();
+  // count the task first so the number of tasks never drops below zero while another thread pops it
+  m_size.fetch_add(1);
+  {
+    std::lock_guard<std::mutex> lock(queue.lock);
+    queue.cost.store(queue.cost.load() + cost);
+    queue.tasks.emplace_back(std::move(newTask));
+    queue.count.store(queue.tasks.size());
+  }
+  // the base class keeps the total cost of all tasks pushed, which only needs the shared lock briefly
+  std::lock_guard<std::mutex> costLock(m_queueLock);
+  m_cost += cost;
+}
+
+/**
+ * Retrieves the next Task to execute: the newest on the queue of the thread, otherwise the oldest on the queue with
+ * the highest cost.
+ * @param threadnum :: ID of the calling thread
+ * @return a Task to execute, or nullptr if there are none
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t own = threadnum % m_queues.size();
+  t_workerQueue = {this, own};
+  if (m_size.load() == 0)
+    return nullptr;
+
+  auto task = findTask(own);
+  if (task) {
+    std::lock_guard<std::mutex> costLock(m_queueLock);
+    m_costExecuted += task->cost();
+  }
+  return task;
+}
+
+/**
+ * Take the next Task to execute off the queues
+ * @param own :: the queue of the calling thread
+ * @return a Task to execute, or nullptr if there are none
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::findTask(const size_t own) {
+  if (auto task = takeFromQueue(*m_queues[own], true, false))
+    return task;
+
+  // steal from the thread with the most work left first, then from any other
+  const size_t victim = highestCostQueue(own);
+  if (victim != own) {
+    if (auto task = takeFromQueue(*m_queues[victim], false, false))
+      return task;
+  }
+  for (size_t i = 1; i < m_queues.size(); ++i) {
+    if (auto task = takeFromQueue(*m_queues[(own + i) % m_queues.size()], false, false))
+      return task;
+  }
+
+  // all of the remaining tasks wait for a busy mutex: hand one out and the thread will wait for the mutex
+  for (size_t i = 0; i < m_queues.size(); ++i) {
+    if (auto task = takeFromQueue(*m_queues[(own + i) % m_queues.size()], i == 0, true))
+      return task;
+  }
+  return nullptr;
+}
+
+/**
+ * Signal to the scheduler that a task is complete so its mutex is no longer busy
+ * @param task :: the Task that was completed
+ * @param threadnum :: unused argument
+ */
+void ThreadSchedulerWorkStealing::finished(Task *task, size_t threadnum) {
+  UNUSED_ARG(threadnum);
+  const auto mutex = task->getMutex();
+  if (!mutex)
+    return;
+  std::lock_guard<std::mutex> lock(m_busyMutexesLock);
+  auto busy = m_busyMutexes.find(mutex);
+  if (busy != m_busyMutexes.end() && --busy->second == 0)
+    m_busyMutexes.erase(busy);
+}
+
+/// @return the number of tasks in all queues
+size_t ThreadSchedulerWorkStealing::size() { return m_size.load(); }
+
+/// @return true if all queues are empty
+bool ThreadSchedulerWorkStealing::empty() { return m_size.load() == 0; }
+
+/// Empty out all of the queues
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    m_size.fetch_sub(queue->tasks.size());
+    queue->tasks.clear();
+    queue->count.store(0);
+    queue->cost.store(0.);
+  }
+  std::lock_guard<std::mutex> costLock(m_queueLock);
+  m_cost = 0;
+  m_costExecuted = 0;
+}
+
+/**
+ * Take a task from a queue, skipping tasks with a busy mutex unless ignoreMutexes is set
+ * @param queue :: the queue to take the task from
+ * @param newest :: take the newest task if true, otherwise the oldest
+ * @param ignoreMutexes :: return a task even if its mutex is busy
+ * @return the task, or nullptr if there are none that can run
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::takeFromQueue(TaskQueue &queue, const bool newest,
+                                                                 const bool ignoreMutexes) {
+  // looking at the count first means threads with nothing to do do not contend for the locks of empty queues
+  if (queue.count.load() == 0)
+    return nullptr;
+  std::lock_guard<std::mutex> lock(queue.lock);
+  auto &tasks = queue.tasks;
+  const auto canRun = [this, ignoreMutexes](const std::shared_ptr<Task> &task) {
+    return acquireMutex(task->getMutex(), ignoreMutexes);
+  };
+  auto found = tasks.end();
+  if (newest) {
+    auto reverseFound = std::find_if(tasks.rbegin(), tasks.rend(), canRun);
+    if (reverseFound != tasks.rend())
+      found = std::prev(reverseFound.base());
+  } else {
+    found = std::find_if(tasks.begin(), tasks.end(), canRun);
+  }
+  if (found == tasks.end())
+    return nullptr;
+
+  auto task = std::move(*found);
+  tasks.erase(found);
+  queue.count.store(tasks.size());
+  queue.cost.store(tasks.empty() ? 0. : queue.cost.load() - task->cost());
+  m_size.fetch_sub(1);
+  return task;
+}
+
+/**
+ * Mark a mutex as used by a popped task
+ * @param mutex :: the mutex of the task, may be null
+ * @param ignoreBusy :: mark the mutex even if another task is using it
+ * @return true if the task can be run
+ */
+bool ThreadSchedulerWorkStealing::acquireMutex(const std::shared_ptr<std::mutex> &mutex, const bool ignoreBusy) {
+  if (!mutex)
+    return true;
+  std::lock_guard<std::mutex> lock(m_busyMutexesLock);
+  auto &count = m_busyMutexes[mutex];
+  if (count > 0 && !ignoreBusy)
+    return false;
+  ++count;
+  return true;
+}
+
+/**
+ * Choose the queue with the lower total cost out of two, which balances the queues nearly as well as looking at all of
+ * them but does not get slower with more threads. The pair moves on each time so tasks of equal cost are spread evenly.
+ * @return the index of the queue to push to
+ */
+size_t ThreadSchedulerWorkStealing::lowestCostQueue() {
+  const size_t numQueues = m_queues.size();
+  const size_t first = m_nextPushQueue.fetch_add(1) % numQueues;
+  const size_t second = (first + numQueues / 2) % numQueues;
+  return (m_queues[second]->cost.load() < m_queues[first]->cost.load()) ? second : first;
+}
+
+/**
+ * @param exclude :: a queue not to choose, e.g. the queue of the calling thread
+ * @return the index of the queue with the highest total cost, or exclude if all other queues have no cost
+ */
+size_t ThreadSchedulerWorkStealing::highestCostQueue(const size_t exclude) const {
+  size_t highest = exclude;
+  double highestCost = 0.;
+  for (size_t index = 0; index < m_queues.size(); ++index) {
+    const double cost = m_queues[index]->cost.load();
+    if (index != exclude && cost > highestCost) {
+      highest = index;
+      highestCost = cost;
+    }
+  }
+  return highest;
+}
+
+} // namespace Mantid::Kernel
@@ -40,6 +40,16 @@ template <typename TYPE> bool allValuesAreSame(const std::vector<TimeValueUnit<T
   }
   return true;
 }
+
+/// Comparison of a log entry with a time, for std::lower_bound
+template <typename TYPE> bool timeIsBefore(const TimeValueUnit<TYPE> &value, const DateAndTime &time) {
+  return value.time() < time;
+}
+
+/// Comparison of a time with a log entry, for std::upper_bound
+template <typename TYPE> bool timeIsAfter(const DateAndTime &time, const TimeValueUnit<TYPE> &value) {
+  return time < value.time();
+}
 } // namespace
 
 /**
@@ -570,9 +580,27 @@ TimeROI TimeSeriesProperty<TYPE>::makeFilterByValue(double min, double max, bool
   DateAndTime stop_t;
   DateAndTime start, stop;
 
+  // The regions are found in order of their start time, so overlapping ones can be merged here and the rest appended.
+  // This avoids TimeROI::addROI, which checks the whole ROI every time and is quadratic for logs with many regions.
+  bool havePending = false;
+  DateAndTime pendingStart, pendingStop;
+  auto addRegion = [&](const DateAndTime &regionStart, const DateAndTime &regionStop) {
+    if (!(regionStart < regionStop))
+      return;
+    if (havePending && regionStart <= pendingStop) {
+      pendingStop = std::max(pendingStop, regionStop);
+      return;
+    }
+    if (havePending)
+      newROI.appendROIFast(pendingStart, pendingStop);
+    pendingStart = regionStart;
+    pendingStop = regionStop;
+    havePending = true;
+  };
+
   bool isGood = false;
   for (size_t i = 0; i < m_values.size(); ++i) {
-    TYPE val = m_values[i].value();
+    const TYPE &val = m_values[i].value();
 
     if ((val >= min) && (val <= max)) {
       if (isGood) {
@@ -584,16 +612,16 @@ TimeROI TimeSeriesProperty<TYPE>::makeFilterByValue(double min, double max, bool
       }
     } else if (isGood) {
       stop = centre ? stop_t + tol : m_values[i].time();
-      if (start < stop)
-        newROI.addROI(start, stop);
+      addRegion(start, stop);
       isGood = false;
     }
   }
   if (isGood) {
     stop = centre ? stop_t + tol : stop_t;
-    if (start < stop)
-      newROI.addROI(start, stop);
+    addRegion(start, stop);
   }
+  if (havePending)
+    newROI.appendROIFast(pendingStart, pendingStop);
 
   if (expand) {
     if (expandRange.start() < firstTime()) {
@@ -1003,12 +1031,10 @@ std::vector<DateAndTime> TimeSeriesProperty<TYPE>::filteredTimesAsVector(const K
           // skip directly to the end if the filter starts after the last log
           index_current_log = this->m_values.size() - 1;
         } else {
-          // search for the right starting point
-          while ((this->m_values[index_current_log].time() <= beginTime)) {
-            if (index_current_log + 1 > this->m_values.size())
-              break;
-            index_current_log++;
-          }
+          // search for the right starting point, the first log after the start of the splitter
+          const auto firstAfter = std::upper_bound(this->m_values.cbegin() + index_current_log, this->m_values.cend(),
+                                                   beginTime, timeIsAfter<TYPE>);
+          index_current_log = static_cast<std::size_t>(std::distance(this->m_values.cbegin(), firstAfter));
           // need to back up by one
           if (index_current_log > 0)
             index_current_log--;
@@ -1959,9 +1985,7 @@ template <typename TYPE> int TimeSeriesProperty<TYPE>::findIndex(Types::Core::Da
   }
 
   // 3. Find by lower_bound()
-  typename std::vector<TimeValueUnit<TYPE>>::const_iterator fid;
-  TimeValueUnit<TYPE> temp(t, m_values[0].value());
-  fid = std::lower_bound(m_values.begin(), m_values.end(), temp);
+  const auto fid = std::lower_bound(m_values.cbegin(), m_values.cend(), t, timeIsBefore<TYPE>);
 
   int newindex = int(fid - m_values.begin());
   if (fid->time() > t)
@@ -2000,11 +2024,10 @@ int TimeSeriesProperty<TYPE>::upperBound(Types::Core::DateAndTime t, int istart,
   // 2. Sort
   sortIfNecessary();
 
-  // 3. Construct the pair for comparison and do lower_bound()
-  const TimeValueUnit<TYPE> temppair(t, m_values[0].value());
+  // 3. Do lower_bound() on the times
   const auto first = m_values.cbegin() + istart;
   const auto last = m_values.cbegin() + iend + 1;
-  const auto iter = std::lower_bound(first, last, temppair);
+  const auto iter = std::lower_bound(first, last, t, timeIsBefore<TYPE>);
 
   // 4. Calculate return value
   if (iter == last)
@@ -2193,12 +2216,10 @@ template <typename TYPE> std::vector<TYPE> TimeSeriesProperty<TYPE>::filteredVal
           // skip directly to the end if the filter starts after the last log
           index_current_log = this->m_values.size() - 1;
         } else {
-          // search for the right starting point
-          while ((this->m_values[index_current_log].time() <= beginTime)) {
-            if (index_current_log + 1 > this->m_values.size())
-              break;
-            index_current_log++;
-          }
+          // search for the right starting point, the first log after the start of the splitter
+          const auto firstAfter = std::upper_bound(this->m_values.cbegin() + index_current_log, this->m_values.cend(),
+                                                   beginTime, timeIsAfter<TYPE>);
+          index_current_log = static_cast<std::size_t>(std::distance(this->m_values.cbegin(), firstAfter));
           // need to back up by one
           if (index_current_log > 0)
             index_current_log--;
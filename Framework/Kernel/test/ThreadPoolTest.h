@@ -13,6 +13,7 @@
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidKernel/Timer.h"
 
 #include <Poco/Thread.h>
@@ -358,6 +359,8 @@ public:
 
   void test_StressTest_ThreadSchedulerMutexes() { do_StressTest_scheduler(new ThreadSchedulerMutexes()); }
 
+  void test_StressTest_ThreadSchedulerWorkStealing() { do_StressTest_scheduler(new ThreadSchedulerWorkStealing()); }
+
   //--------------------------------------------------------------------
   /** Perform a stress test on the given scheduler.
    * This one creates tasks that create new tasks; e.g. 10 tasks each add
@@ -396,6 +399,10 @@ public:
     do_StressTest_TasksThatCreateTasks(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_TasksThatCreateTasks_ThreadSchedulerWorkStealing() {
+    do_StressTest_TasksThatCreateTasks(new ThreadSchedulerWorkStealing());
+  }
+
   //=======================================================================================
   /** Task that throws an exception */
   class TaskThatThrows : public Task {
@@ -0,0 +1,250 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/Timer.h"
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+
+using namespace Mantid::Kernel;
+
+namespace {
+class CostTask : public Task {
+public:
+  CostTask(double cost, std::shared_ptr<std::mutex> mutex = nullptr) : Task(cost) { m_mutex = std::move(mutex); }
+  void run() override {}
+};
+
+/// Task that adds numChildren tasks to the scheduler until depth is reached
+class SplittingTask : public Task {
+public:
+  SplittingTask(ThreadScheduler *scheduler, std::atomic<size_t> &counter, size_t depth)
+      : Task(), m_scheduler(scheduler), m_counter(counter), m_depth(depth) {}
+
+  void run() override {
+    if (m_depth == 0) {
+      m_counter.fetch_add(1);
+      return;
+    }
+    for (size_t i = 0; i < 10; ++i)
+      m_scheduler->push(std::make_shared<SplittingTask>(m_scheduler, m_counter, m_depth - 1));
+  }
+
+private:
+  ThreadScheduler *m_scheduler;
+  std::atomic<size_t> &m_counter;
+  size_t m_depth;
+};
+} // namespace
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ThreadSchedulerWorkStealingTest *createSuite() { return new ThreadSchedulerWorkStealingTest(); }
+  static void destroySuite(ThreadSchedulerWorkStealingTest *suite) { delete suite; }
+
+  void test_push_and_clear() {
+    ThreadSchedulerWorkStealing sc(4);
+    TS_ASSERT_EQUALS(sc.numberOfQueues(), 4);
+    TS_ASSERT(sc.empty());
+    std::weak_ptr<Task> pushed;
+    {
+      auto task = std::make_shared<CostTask>(2.);
+      pushed = task;
+      sc.push(task);
+    }
+    sc.push(std::make_shared<CostTask>(3.));
+    TS_ASSERT_EQUALS(sc.size(), 2);
+    TS_ASSERT_DELTA(sc.totalCost(), 5., 1e-12);
+
+    sc.clear();
+    TS_ASSERT(sc.empty());
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    TS_ASSERT_DELTA(sc.totalCost(), 0., 1e-12);
+    // the tasks are deleted
+    TS_ASSERT(pushed.expired());
+  }
+
+  void test_default_number_of_queues() {
+    ThreadSchedulerWorkStealing sc;
+    TS_ASSERT_LESS_THAN_EQUALS(1, sc.numberOfQueues());
+  }
+
+  void test_own_queue_is_last_in_first_out() {
+    ThreadSchedulerWorkStealing sc(1);
+    auto task1 = std::make_shared<CostTask>(1.);
+    auto task2 = std::make_shared<CostTask>(2.);
+    auto task3 = std::make_shared<CostTask>(3.);
+    sc.push(task1);
+    sc.push(task2);
+    sc.push(task3);
+    TS_ASSERT_EQUALS(sc.pop(0), task3);
+    TS_ASSERT_EQUALS(sc.pop(0), task2);
+    TS_ASSERT_EQUALS(sc.pop(0), task1);
+    TS_ASSERT(!sc.pop(0));
+    TS_ASSERT(sc.empty());
+  }
+
+  void test_external_pushes_go_to_lowest_cost_queue() {
+    ThreadSchedulerWorkStealing sc(2);
+    auto expensive = std::make_shared<CostTask>(10.);
+    auto cheap1 = std::make_shared<CostTask>(1.);
+    auto cheap2 = std::make_shared<CostTask>(1.);
+    sc.push(expensive);
+    sc.push(cheap1);
+    sc.push(cheap2);
+    // both cheap tasks are on the other queue to the expensive one
+    TS_ASSERT_EQUALS(sc.pop(1), cheap2);
+    TS_ASSERT_EQUALS(sc.pop(1), cheap1);
+    // then thread 1 steals from thread 0
+    TS_ASSERT_EQUALS(sc.pop(1), expensive);
+  }
+
+  void test_steals_oldest_task_of_highest_cost_queue() {
+    ThreadSchedulerWorkStealing sc(3);
+    // popping makes this thread behave like thread 1, so it pushes to queue 1
+    TS_ASSERT(!sc.pop(1));
+    auto a = std::make_shared<CostTask>(1.);
+    auto b = std::make_shared<CostTask>(1.);
+    sc.push(a);
+    sc.push(b);
+    // thread 2 has no tasks so it steals the oldest of queue 1, then pushes to queue 2
+    TS_ASSERT_EQUALS(sc.pop(2), a);
+    auto c = std::make_shared<CostTask>(5.);
+    auto d = std::make_shared<CostTask>(5.);
+    sc.push(c);
+    sc.push(d);
+    // as for the other schedulers, the total cost includes the tasks that were popped
+    TS_ASSERT_DELTA(sc.totalCost(), 12., 1e-12);
+    TS_ASSERT_DELTA(sc.totalCostExecuted(), 1., 1e-12);
+    // queue 2 has the most work
+    TS_ASSERT_EQUALS(sc.pop(0), c);
+    TS_ASSERT_EQUALS(sc.pop(0), d);
+    TS_ASSERT_EQUALS(sc.pop(0), b);
+    TS_ASSERT_DELTA(sc.totalCost(), 12., 1e-12);
+    TS_ASSERT_DELTA(sc.totalCostExecuted(), 12., 1e-12);
+  }
+
+  void test_tasks_with_busy_mutex_are_skipped() {
+    ThreadSchedulerWorkStealing sc(1);
+    auto mutex = std::make_shared<std::mutex>();
+    auto free = std::make_shared<CostTask>(1.);
+    auto locked1 = std::make_shared<CostTask>(1., mutex);
+    auto locked2 = std::make_shared<CostTask>(1., mutex);
+    sc.push(free);
+    sc.push(locked1);
+    sc.push(locked2);
+    TS_ASSERT_EQUALS(sc.pop(0), locked2);
+    // locked1 has to wait for locked2
+    TS_ASSERT_EQUALS(sc.pop(0), free);
+    sc.finished(locked2.get(), 0);
+    sc.push(free);
+    // the newest task is free but locked1 can now run too
+    TS_ASSERT_EQUALS(sc.pop(0), free);
+    TS_ASSERT_EQUALS(sc.pop(0), locked1);
+  }
+
+  void test_task_with_busy_mutex_is_returned_if_nothing_else_left() {
+    ThreadSchedulerWorkStealing sc(2);
+    auto mutex = std::make_shared<std::mutex>();
+    auto locked1 = std::make_shared<CostTask>(1., mutex);
+    auto locked2 = std::make_shared<CostTask>(1., mutex);
+    sc.push(locked1);
+    sc.push(locked2);
+    const auto first = sc.pop(0);
+    const auto second = sc.pop(0);
+    TS_ASSERT(first);
+    TS_ASSERT(second);
+    TS_ASSERT_DIFFERS(first, second);
+    TS_ASSERT(sc.empty());
+  }
+
+  void test_thread_pool_runs_all_tasks() {
+    auto *sc = new ThreadSchedulerWorkStealing(4);
+    ThreadPool pool(sc, 4);
+    std::atomic<size_t> counter{0};
+    pool.schedule(std::make_shared<SplittingTask>(sc, counter, 4));
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+    TS_ASSERT_EQUALS(counter.load(), 10000);
+    TS_ASSERT(sc->empty());
+  }
+};
+
+/** Measure the overhead per task of the schedulers with tasks that do nothing. The "splitting" tests resemble MD box
+ * splitting where tasks push more tasks.
+ */
+class ThreadSchedulerWorkStealingTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ThreadSchedulerWorkStealingTestPerformance *createSuite() {
+    return new ThreadSchedulerWorkStealingTestPerformance();
+  }
+  static void destroySuite(ThreadSchedulerWorkStealingTestPerformance *suite) { delete suite; }
+
+  void test_many_small_tasks_FIFO() {
+    sweepThreads("FIFO", [](size_t) { return new ThreadSchedulerFIFO(); }, runSmallTasks);
+  }
+
+  void test_many_small_tasks_work_stealing() {
+    sweepThreads(
+        "work stealing", [](size_t numThreads) { return new ThreadSchedulerWorkStealing(numThreads); }, runSmallTasks);
+  }
+
+  void test_splitting_tasks_FIFO() {
+    sweepThreads("FIFO splitting", [](size_t) { return new ThreadSchedulerFIFO(); }, runSplittingTasks);
+  }
+
+  void test_splitting_tasks_work_stealing() {
+    sweepThreads(
+        "work stealing splitting",
+        [](size_t numThreads) { return new ThreadSchedulerWorkStealing(numThreads); }, runSplittingTasks);
+  }
+
+private:
+  static size_t runSmallTasks(ThreadPool &pool, ThreadScheduler *) {
+    std::atomic<size_t> counter{0};
+    for (size_t i = 0; i < NUM_TASKS; ++i)
+      pool.schedule(std::make_shared<FunctionTask>([&counter] { counter.fetch_add(1); }));
+    pool.joinAll();
+    TS_ASSERT_EQUALS(counter.load(), NUM_TASKS);
+    return NUM_TASKS;
+  }
+
+  static size_t runSplittingTasks(ThreadPool &pool, ThreadScheduler *scheduler) {
+    std::atomic<size_t> counter{0};
+    // 10 + 100 + ... + 100000 tasks
+    pool.schedule(std::make_shared<SplittingTask>(scheduler, counter, 5));
+    pool.joinAll();
+    TS_ASSERT_EQUALS(counter.load(), 100000);
+    return 111111;
+  }
+
+  template <typename MakeScheduler, typename Run>
+  void sweepThreads(const std::string &name, MakeScheduler &&makeScheduler, Run &&run) {
+    for (size_t numThreads = 1; numThreads <= MAX_THREADS; numThreads *= 2) {
+      auto *scheduler = makeScheduler(numThreads);
+      ThreadPool pool(scheduler, numThreads);
+      Timer timer;
+      const size_t numTasks = run(pool, scheduler);
+      std::cout << "\n"
+                << name << " with " << numThreads << " threads: " << 1e9 * timer.elapsed() / double(numTasks)
+                << " ns per task";
+    }
+  }
+
+  static constexpr size_t NUM_TASKS{200000};
+  static constexpr size_t MAX_THREADS{128};
+};
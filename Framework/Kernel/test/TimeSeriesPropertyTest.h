@@ -921,6 +921,34 @@ public:
     delete log;
   }
 
+  void test_makeFilterByValueWithROI_merges_overlapping_regions() {
+    // alternate good and bad values 1s apart, with a tolerance that makes neighbouring centred regions overlap
+    TimeSeriesProperty<double> log("doubleTestLog");
+    const DateAndTime start("2007-11-30T16:17:00");
+    for (int i = 0; i < 20; ++i) {
+      log.addValue(start + static_cast<double>(i), (i % 3 == 2) ? 10.0 : 1.0);
+    }
+    const TimeInterval expandedTime(DateAndTime(0), DateAndTime(1));
+    const double tolerance = 1.5;
+    const TimeROI roi = log.makeFilterByValue(0.5, 1.5, false, expandedTime, tolerance, true);
+
+    // the same regions added one at a time
+    TimeROI expected;
+    for (int i = 0; i < 20; i += 3) {
+      const auto firstGood = static_cast<double>(i);
+      const auto lastGood = static_cast<double>(std::min(i + 1, 19));
+      expected.addROI(start + (firstGood - tolerance), start + (lastGood + tolerance));
+    }
+    TS_ASSERT_EQUALS(roi, expected);
+    TS_ASSERT_EQUALS(roi.numberOfRegions(), 1);
+
+    // without the tolerance the regions stay separate
+    const TimeROI separate = log.makeFilterByValue(0.5, 1.5, false, expandedTime, 0.0, false);
+    TS_ASSERT_EQUALS(separate.numberOfRegions(), 7);
+    TS_ASSERT_EQUALS(separate.timeAtIndex(0), start);
+    TS_ASSERT_EQUALS(separate.timeAtIndex(1), start + 2.0);
+  }
+
   void test_makeFilterByValue_throws_for_string_property() {
     TimeSeriesProperty<std::string> log("StringTSP");
     SplittingIntervalVec splitter;
@@ -2234,3 +2262,45 @@ private:
   TimeSeriesProperty<double> *dProp;
   TimeSeriesProperty<std::string> *sProp;
 };
+
+class TimeSeriesPropertyTestPerformance : public CxxTest::TestSuite {
+public:
+  static TimeSeriesPropertyTestPerformance *createSuite() { return new TimeSeriesPropertyTestPerformance(); }
+  static void destroySuite(TimeSeriesPropertyTestPerformance *suite) { delete suite; }
+
+  TimeSeriesPropertyTestPerformance() : m_log("DoubleLog") {
+    // a value every 10ms that switches between in and out of the filter every 5 values
+    constexpr size_t numValues{2000000};
+    std::vector<double> times(numValues);
+    std::vector<double> values(numValues);
+    for (size_t i = 0; i < numValues; ++i) {
+      times[i] = 0.01 * static_cast<double>(i);
+      values[i] = static_cast<double>((i / 5) % 2);
+    }
+    m_log.create(DateAndTime("2007-11-30T16:17:00"), times, values);
+
+    for (size_t i = 0; i < numValues; i += 1000) {
+      m_roi.appendROIFast(m_log.nthTime(static_cast<int>(i)), m_log.nthTime(static_cast<int>(i + 500)));
+    }
+  }
+
+  void test_makeFilterByValue() {
+    const TimeInterval expandedTime(DateAndTime(0), DateAndTime(1));
+    const auto roi = m_log.makeFilterByValue(0.5, 1.5, false, expandedTime, 0.0, false);
+    TS_ASSERT_EQUALS(roi.numberOfRegions(), 200000);
+  }
+
+  void test_filteredValuesAsVector() {
+    const auto values = m_log.filteredValuesAsVector(&m_roi);
+    TS_ASSERT(!values.empty());
+  }
+
+  void test_timeAverageValueAndStdDev() {
+    const auto meanAndStdDev = m_log.timeAverageValueAndStdDev(&m_roi);
+    TS_ASSERT_DELTA(meanAndStdDev.first, 0.5, 0.01);
+  }
+
+private:
+  TimeSeriesProperty<double> m_log;
+  TimeROI m_roi;
+};
@@ -13,6 +13,7 @@
 #include "MantidLiveData/Kafka/IKafkaStreamDecoder.h"
 #include "MantidLiveData/Kafka/IKafkaStreamSubscriber.h"
 
+#include <utility>
 #include <vector>
 
 namespace Mantid {
@@ -77,12 +78,19 @@ private:
   /// m_localEvents
   std::vector<BufferedEvent> m_receivedEventBuffer;
   std::vector<BufferedPulse> m_receivedPulseBuffer;
+  /// Proton charges of ISIS pulses yet to be added to m_localEvents, as the
+  /// index of the pulse and the charge
+  std::vector<std::pair<size_t, double>> m_receivedProtonCharges;
   /// Mutex protecting intermediate buffers
   mutable std::mutex m_intermediateBufferMutex;
   /// The number of events above which the intermediate buffer will be flushed
   const std::size_t m_intermediateBufferFlushThreshold;
 };
 
+MANTID_LIVEDATA_DLL void
+sortIntermediateEventBuffer(std::vector<KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
+                            const std::vector<KafkaEventStreamDecoder::BufferedPulse> &pulseBuffer);
+
 MANTID_LIVEDATA_DLL std::vector<size_t>
 computeGroupBoundaries(const std::vector<KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
                        const size_t numberOfGroups);
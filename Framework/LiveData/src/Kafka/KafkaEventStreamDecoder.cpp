@@ -29,9 +29,11 @@ GNU_DIAG_OFF("conversion")
 #include "private/Schema/is84_isis_events_generated.h"
 GNU_DIAG_ON("conversion")
 
+#include <algorithm>
 #include <chrono>
 #include <json/json.h>
 #include <numeric>
+#include <optional>
 #include <utility>
 
 #include <tbb/parallel_sort.h>
@@ -83,22 +85,8 @@ void appendToLog(Mantid::API::Run &mutableRunInfo, const std::string &name, cons
   }
 }
 
-void sortIntermediateEventBuffer(
-    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedPulse> &pulseBuffer) {
-  tbb::parallel_sort(eventBuffer.begin(), eventBuffer.end(),
-                     [&](const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &lhs,
-                         const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &rhs) -> bool {
-                       const auto &lhsPulse = pulseBuffer[lhs.pulseIndex];
-                       const auto &rhsPulse = pulseBuffer[rhs.pulseIndex];
-
-                       /* If events are from different periods compare the period
-                        * numbers, otherwise compare the workspace index */
-                       return (lhsPulse.periodNumber != rhsPulse.periodNumber)
-                                  ? lhsPulse.periodNumber < rhsPulse.periodNumber
-                                  : lhs.wsIdx < rhs.wsIdx;
-                     });
-}
+/// Use a counting sort for the intermediate buffer unless there are many more spectra and periods than events
+constexpr size_t COUNTING_SORT_MAX_KEYS_PER_EVENT{4};
 } // namespace
 
 namespace Mantid::LiveData {
@@ -158,6 +146,7 @@ KafkaEventStreamDecoder::KafkaEventStreamDecoder(KafkaEventStreamDecoder &&o) no
   m_localEvents = std::move(o.m_localEvents);
   m_receivedEventBuffer = std::move(o.m_receivedEventBuffer);
   m_receivedPulseBuffer = std::move(o.m_receivedPulseBuffer);
+  m_receivedProtonCharges = std::move(o.m_receivedProtonCharges);
 }
 
 /**
@@ -385,35 +374,35 @@ void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer, si
   /* Create buffered pulse */
   BufferedPulse pulse{pulseTime, 0};
 
-  /* Perform facility specific operations */
+  /* Perform facility specific operations. The proton charge is added to the
+   * workspace with the events of the pulse so the workspace lock is not taken
+   * for every message. */
+  std::optional<double> protonCharge;
   if (eventMsg->facility_specific_data_type() == FacilityData::ISISData) {
-    std::lock_guard<std::mutex> workspaceLock(m_mutex);
     const auto ISISMsg = static_cast<const ISISData *>(eventMsg->facility_specific_data());
     pulse.periodNumber = static_cast<int>(ISISMsg->period_number());
-    auto periodWs = m_localEvents[pulse.periodNumber];
-    auto &mutableRunInfo = periodWs->mutableRun();
-    mutableRunInfo.getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)->addValue(pulseTime, ISISMsg->proton_charge());
+    protonCharge = ISISMsg->proton_charge();
   }
 
   const auto starttime = std::chrono::system_clock::now();
 
-  {
-    std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
-
-    /* Store the buffered pulse */
-    m_receivedPulseBuffer.emplace_back(pulse);
-    const auto pulseIndex = m_receivedPulseBuffer.size() - 1;
+  /* The intermediate buffers are only used by the capture thread so they do
+   * not need to be locked */
+  /* Store the buffered pulse */
+  m_receivedPulseBuffer.emplace_back(pulse);
+  const auto pulseIndex = m_receivedPulseBuffer.size() - 1;
+  if (protonCharge)
+    m_receivedProtonCharges.emplace_back(pulseIndex, *protonCharge);
 
-    /* Ensure storage for newly received events */
-    const auto oldBufferSize(m_receivedEventBuffer.size());
-    m_receivedEventBuffer.reserve(oldBufferSize + nEvents);
+  /* Ensure storage for newly received events */
+  const auto oldBufferSize(m_receivedEventBuffer.size());
+  m_receivedEventBuffer.reserve(oldBufferSize + nEvents);
 
-    std::transform(detData.begin(), detData.end(), tofData.begin(), std::back_inserter(m_receivedEventBuffer),
-                   [&](uint64_t detId, uint64_t tof) -> BufferedEvent {
-                     const auto workspaceIndex = m_eventIdToWkspIdx(detId);
-                     return {workspaceIndex, tof, pulseIndex};
-                   });
-  }
+  std::transform(detData.begin(), detData.end(), tofData.begin(), std::back_inserter(m_receivedEventBuffer),
+                 [&](uint64_t detId, uint64_t tof) -> BufferedEvent {
+                   const auto workspaceIndex = m_eventIdToWkspIdx(detId);
+                   return {workspaceIndex, tof, pulseIndex};
+                 });
 
   const auto endTime = std::chrono::system_clock::now();
   const std::chrono::duration<double> dur = endTime - starttime;
@@ -422,8 +411,8 @@ void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer, si
 }
 
 void KafkaEventStreamDecoder::flushIntermediateBuffer() {
-  /* Do nothing if there are no buffered events */
-  if (m_receivedEventBuffer.empty()) {
+  /* Do nothing if there are no buffered pulses */
+  if (m_receivedPulseBuffer.empty()) {
     return;
   }
 
@@ -433,6 +422,8 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
 
   std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
 
+  /* Sort and group the events before taking the workspace lock, so that
+   * extractData() is only blocked while the events are copied */
   sortIntermediateEventBuffer(m_receivedEventBuffer, m_receivedPulseBuffer);
 
   /* Compute groups for parallel insertion */
@@ -447,16 +438,35 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
       ws->invalidateCommonBinsFlag();
     }
 
+    for (const auto &[pulseIndex, protonCharge] : m_receivedProtonCharges) {
+      const auto &pulse = m_receivedPulseBuffer[pulseIndex];
+      m_localEvents[pulse.periodNumber]
+          ->mutableRun()
+          .getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
+          ->addValue(pulse.pulseTime, protonCharge);
+    }
+
     PARALLEL_FOR_NO_WSP_CHECK()
     for (auto group = 0; group < numberOfGroups; ++group) {
-      for (auto idx = groupBoundaries[group]; idx < groupBoundaries[group + 1]; ++idx) {
-        const auto &event = m_receivedEventBuffer[idx];
-        const auto &pulse = m_receivedPulseBuffer[event.pulseIndex];
-
-        auto *spectrum = m_localEvents[pulse.periodNumber]->getSpectrumUnsafe(event.wsIdx);
-
-        // nanoseconds to microseconds
-        spectrum->addEventQuickly(TofEvent(static_cast<double>(event.tof) * 1e-3, pulse.pulseTime));
+      auto idx = groupBoundaries[group];
+      while (idx < groupBoundaries[group + 1]) {
+        /* The events of a spectrum are next to each other, so the spectrum is
+         * looked up and grown once for all of them */
+        const auto &first = m_receivedEventBuffer[idx];
+        const auto periodNumber = m_receivedPulseBuffer[first.pulseIndex].periodNumber;
+        auto end = idx + 1;
+        while (end < groupBoundaries[group + 1] && m_receivedEventBuffer[end].wsIdx == first.wsIdx &&
+               m_receivedPulseBuffer[m_receivedEventBuffer[end].pulseIndex].periodNumber == periodNumber)
+          ++end;
+
+        auto *spectrum = m_localEvents[periodNumber]->getSpectrumUnsafe(first.wsIdx);
+        spectrum->reserve(spectrum->getNumberEvents() + (end - idx));
+        for (; idx < end; ++idx) {
+          const auto &event = m_receivedEventBuffer[idx];
+          // nanoseconds to microseconds
+          spectrum->addEventQuickly(
+              TofEvent(static_cast<double>(event.tof) * 1e-3, m_receivedPulseBuffer[event.pulseIndex].pulseTime));
+        }
       }
     }
   }
@@ -464,6 +474,7 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
   /* Clear buffers */
   m_receivedPulseBuffer.clear();
   m_receivedEventBuffer.clear();
+  m_receivedProtonCharges.clear();
 
   const auto endTime = std::chrono::system_clock::now();
   const std::chrono::duration<double> dur = endTime - startTime;
@@ -614,6 +625,56 @@ void KafkaEventStreamDecoder::initLocalCaches(const RunStartStruct &runStartData
   m_dataReset = true;
 }
 
+/**
+ * Order the buffered events by period number and then by workspace index.
+ *
+ * A counting sort is used, which is linear in the number of events and keeps
+ * the events of each spectrum in the order they were received. A comparison
+ * sort is used instead if there are many more spectra and periods than events.
+ * @param eventBuffer :: the events to sort
+ * @param pulseBuffer :: the pulses the events refer to
+ */
+void sortIntermediateEventBuffer(std::vector<KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
+                                 const std::vector<KafkaEventStreamDecoder::BufferedPulse> &pulseBuffer) {
+  using BufferedEvent = KafkaEventStreamDecoder::BufferedEvent;
+  if (eventBuffer.empty())
+    return;
+
+  const auto periodOf = [&pulseBuffer](const BufferedEvent &event) {
+    return static_cast<size_t>(pulseBuffer[event.pulseIndex].periodNumber);
+  };
+  size_t numSpectra{0};
+  size_t numPeriods{0};
+  for (const auto &event : eventBuffer) {
+    numSpectra = std::max(numSpectra, event.wsIdx + 1);
+    numPeriods = std::max(numPeriods, periodOf(event) + 1);
+  }
+
+  const auto numKeys = numSpectra * numPeriods;
+  if (numKeys / COUNTING_SORT_MAX_KEYS_PER_EVENT > eventBuffer.size()) {
+    tbb::parallel_sort(eventBuffer.begin(), eventBuffer.end(), [&](const BufferedEvent &lhs, const BufferedEvent &rhs) {
+      /* If events are from different periods compare the period
+       * numbers, otherwise compare the workspace index */
+      const auto lhsPeriod = periodOf(lhs);
+      const auto rhsPeriod = periodOf(rhs);
+      return (lhsPeriod != rhsPeriod) ? lhsPeriod < rhsPeriod : lhs.wsIdx < rhs.wsIdx;
+    });
+    return;
+  }
+
+  const auto keyOf = [&](const BufferedEvent &event) { return periodOf(event) * numSpectra + event.wsIdx; };
+  // offsets[key] is where the first event of a key goes
+  std::vector<size_t> offsets(numKeys + 1, 0);
+  for (const auto &event : eventBuffer)
+    ++offsets[keyOf(event) + 1];
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<BufferedEvent> sorted(eventBuffer.size());
+  for (const auto &event : eventBuffer)
+    sorted[offsets[keyOf(event)]++] = event;
+  eventBuffer.swap(sorted);
+}
+
 std::vector<size_t>
 computeGroupBoundaries(const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
                        const size_t numberOfGroups) {
@@ -439,6 +439,36 @@ public:
     TS_ASSERT_EQUALS(events.size(), groupBounds[1]);
   }
 
+  void test_Sort_Intermediate_Event_Buffer() {
+    using Mantid::LiveData::KafkaEventStreamDecoder;
+    const std::vector<KafkaEventStreamDecoder::BufferedPulse> pulses = {{Mantid::Types::Core::DateAndTime(0), 1},
+                                                                        {Mantid::Types::Core::DateAndTime(1), 0}};
+    // events as workspace index, tof and pulse index
+    std::vector<KafkaEventStreamDecoder::BufferedEvent> events = {
+        {2, 10, 0}, {0, 20, 1}, {2, 30, 1}, {1, 40, 0}, {0, 50, 1}, {2, 60, 0},
+    };
+
+    sortIntermediateEventBuffer(events, pulses);
+
+    // events are ordered by period and workspace index, and keep the order they were received in
+    const std::vector<uint64_t> expectedTofs = {20, 50, 30, 40, 10, 60};
+    TS_ASSERT_EQUALS(expectedTofs.size(), events.size());
+    for (size_t i = 0; i < events.size(); ++i)
+      TS_ASSERT_EQUALS(expectedTofs[i], events[i].tof);
+  }
+
+  void test_Sort_Intermediate_Event_Buffer_Many_Spectra() {
+    using Mantid::LiveData::KafkaEventStreamDecoder;
+    const std::vector<KafkaEventStreamDecoder::BufferedPulse> pulses = {{Mantid::Types::Core::DateAndTime(0), 0}};
+    std::vector<KafkaEventStreamDecoder::BufferedEvent> events = {{1000000, 10, 0}, {5, 20, 0}, {70000, 30, 0}};
+
+    sortIntermediateEventBuffer(events, pulses);
+
+    TS_ASSERT_EQUALS(5, events[0].wsIdx);
+    TS_ASSERT_EQUALS(70000, events[1].wsIdx);
+    TS_ASSERT_EQUALS(1000000, events[2].wsIdx);
+  }
+
   //----------------------------------------------------------------------------
   // Failure tests
   //----------------------------------------------------------------------------
@@ -517,3 +547,60 @@ private:
     }
   }
 };
+
+class KafkaEventStreamDecoderTestPerformance : public CxxTest::TestSuite {
+public:
+  static KafkaEventStreamDecoderTestPerformance *createSuite() { return new KafkaEventStreamDecoderTestPerformance(); }
+  static void destroySuite(KafkaEventStreamDecoderTestPerformance *suite) { delete suite; }
+
+  void setUp() override {
+    using Mantid::Kernel::ConfigService;
+    auto &config = ConfigService::Instance();
+    auto baseInstDir = config.getInstrumentDirectory();
+    Poco::Path testFile = Poco::Path(baseInstDir).resolve("unit_testing/UnitTestFacilities.xml");
+    config.updateFacilities(testFile.toString());
+    config.setFacility("TEST");
+    config.setString("instrumentDefinition.directory", baseInstDir + "/unit_testing");
+  }
+
+  void tearDown() override {
+    using Mantid::Kernel::ConfigService;
+    auto &config = ConfigService::Instance();
+    config.reset();
+    config.updateFacilities();
+  }
+
+  void test_Ingest_Large_Event_Messages() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(2))
+        .WillOnce(Return(new FakeLargeISISEventSubscriber(EVENTS_PER_MESSAGE)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)));
+    KafkaEventStreamDecoder decoder(mockBroker, "", "", "", "", "", FLUSH_THRESHOLD);
+    KafkaTestThreadHelper<KafkaEventStreamDecoder> testInstance(std::move(decoder));
+
+    for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+      testInstance.runKafkaOneStep();
+      // extract the data regularly, as LoadLiveData would
+      if (i % 10 == 9)
+        m_numberOfEvents += numberOfEvents(testInstance->extractData());
+    }
+    TS_ASSERT_THROWS_NOTHING(testInstance.stopCapture());
+    m_numberOfEvents += numberOfEvents(testInstance->extractData());
+
+    TS_ASSERT_LESS_THAN_EQUALS(NUM_MESSAGES * EVENTS_PER_MESSAGE, m_numberOfEvents);
+  }
+
+private:
+  static size_t numberOfEvents(const Mantid::API::Workspace_sptr &workspace) {
+    return std::dynamic_pointer_cast<Mantid::DataObjects::EventWorkspace>(workspace)->getNumberEvents();
+  }
+
+  static constexpr size_t EVENTS_PER_MESSAGE{100000};
+  static constexpr size_t NUM_MESSAGES{100};
+  static constexpr size_t FLUSH_THRESHOLD{1000000};
+  size_t m_numberOfEvents{0};
+};
@@ -264,6 +264,57 @@ private:
   int32_t m_nextPeriod;
 };
 
+// -----------------------------------------------------------------------------
+// Fake ISIS event stream sending a large number of events in every message
+// -----------------------------------------------------------------------------
+class FakeLargeISISEventSubscriber : public Mantid::LiveData::IKafkaStreamSubscriber {
+public:
+  explicit FakeLargeISISEventSubscriber(size_t eventsPerMessage) {
+    flatbuffers::FlatBufferBuilder builder;
+    std::vector<uint32_t> spec(eventsPerMessage);
+    std::vector<uint32_t> tof(eventsPerMessage);
+    for (size_t i = 0; i < eventsPerMessage; ++i) {
+      // spread the events over the 5 spectra of the fake run start message
+      spec[i] = static_cast<uint32_t>(i % 5 + 1);
+      tof[i] = static_cast<uint32_t>(6000 + i % 5000);
+    }
+    auto messageFlatbuf = CreateEventMessage(
+        builder, builder.CreateString("KafkaTesting"), 0, 1, builder.CreateVector(tof), builder.CreateVector(spec),
+        FacilityData::ISISData, CreateISISData(builder, 0, RunState::RUNNING, 0.5f).Union());
+    FinishEventMessageBuffer(builder, messageFlatbuf);
+    m_message.assign(reinterpret_cast<const char *>(builder.GetBufferPointer()), builder.GetSize());
+  }
+  void subscribe() override {}
+  void subscribe(int64_t offset) override { UNUSED_ARG(offset) }
+  void consumeMessage(std::string *message, int64_t &offset, int32_t &partition, std::string &topic) override {
+    assert(message);
+    *message = m_message;
+
+    UNUSED_ARG(offset);
+    UNUSED_ARG(partition);
+    UNUSED_ARG(topic);
+  }
+
+  std::unordered_map<std::string, std::vector<int64_t>> getOffsetsForTimestamp(int64_t timestamp) override {
+    UNUSED_ARG(timestamp);
+    return {std::pair<std::string, std::vector<int64_t>>("topic_name", {1, 2, 3})};
+  }
+
+  std::unordered_map<std::string, std::vector<int64_t>> getCurrentOffsets() override {
+    std::unordered_map<std::string, std::vector<int64_t>> offsets;
+    return offsets;
+  }
+
+  void seek(const std::string &topic, uint32_t partition, int64_t offset) override {
+    UNUSED_ARG(topic);
+    UNUSED_ARG(partition);
+    UNUSED_ARG(offset);
+  }
+
+private:
+  std::string m_message;
+};
+
 // ---------------------------------------------------------------------------------------
 // Fake non-institution-specific event stream to provide event and sample
 // environment data
@@ -10,6 +10,7 @@
 #include "MantidAPI/CoordTransform.h"
 #include "MantidAPI/IMDEventWorkspace_fwd.h"
 #include "MantidDataObjects/MDBox.h"
+#include "MantidDataObjects/MDEventColumns.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidDataObjects/MDHistoWorkspace.h"
@@ -58,12 +59,50 @@ private:
   /// Run the algorithm
   void exec() override;
 
+  /// The arrays of a histogram that events are binned into: the output workspace or a partial sum
+  struct BinnedArrays {
+    signal_t *signals;
+    signal_t *errors;
+    signal_t *numEvents;
+  };
+
   /// Helper method
   template <typename MDE, size_t nd> void binByIterating(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Bin boxes split by their number of events, one range of boxes per histogram
+  template <typename MDE, size_t nd>
+  void binBoxRanges(const std::vector<API::IMDNode *> &boxes, const std::vector<BinnedArrays> &histograms,
+                    const size_t *const chunkMin, const size_t *const chunkMax);
+
+  /// Bin file-backed boxes read in file order by a separate thread, one histogram per binning thread
+  template <typename MDE, size_t nd>
+  void binFileBackedBoxes(const std::vector<API::IMDNode *> &boxes, const std::vector<BinnedArrays> &histograms,
+                          const size_t *const chunkMin, const size_t *const chunkMax);
+
+  /// Bin slabs of the output in parallel, for histograms too large to keep a copy per thread
+  template <typename MDE, size_t nd>
+  void binOutputSlabs(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
+
   /// Method to bin a single MDBox
   template <typename MDE, size_t nd>
-  void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax);
+  void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax,
+                const BinnedArrays &histogram);
+
+  /// Find whether all of a box is inside a single bin
+  template <typename MDE, size_t nd>
+  bool findWholeBoxBin(const DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin,
+                       const size_t *const chunkMax, size_t &linearIndex) const;
+
+  /// Bin the events of a box
+  template <typename MDE, size_t nd>
+  void binEvents(const std::vector<MDE> &events, const size_t *const chunkMin, const size_t *const chunkMax,
+                 const BinnedArrays &histogram);
+
+  /// Add the partial histograms to the output
+  void mergeHistograms(const std::vector<BinnedArrays> &histograms) const;
+
+  /// Mask the bins outside of the implicit function
+  void applyImplicitFunction();
 
   /// The output MDHistoWorkspace
   Mantid::DataObjects::MDHistoWorkspace_sptr outWS;
@@ -78,6 +117,8 @@ private:
   signal_t *errors;
   signal_t *numEvents;
   bool m_accumulate{false};
+  /// The transform applied to columns of events, if the input workspace uses columnar events
+  std::unique_ptr<DataObjects::MDColumnTransform> m_columnTransform;
 };
 
 } // namespace MDAlgorithms
@@ -7,7 +7,7 @@
 #pragma once
 
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
-#include "MantidMDAlgorithms/MDEventTreeBuilder.h"
+#include "MantidMDAlgorithms/MDEventWorkspaceBuilder.h"
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -36,14 +36,7 @@ class ConvToMDEventsWSIndexing : public ConvToMDEventsWS {
 
 public:
   template <typename T> static bool isSplitValid(const std::vector<T> &split_into) {
-    bool validSplitInfo = !split_into.empty();
-    if (validSplitInfo) {
-      const T &n = split_into[0];
-      validSplitInfo &= (n > 1 && ((n & (n - 1)) == 0));
-      if (validSplitInfo)
-        validSplitInfo &= all_of(split_into.begin(), split_into.end(), [&n](T i) { return i == n; });
-    }
-    return validSplitInfo;
+    return isMortonSplitValid(split_into);
   }
 
 private:
@@ -156,32 +149,21 @@ std::vector<MDEventType<ND>> ConvToMDEventsWSIndexing::convertEvents() {
 }
 
 template <typename EventType, size_t ND, template <size_t> class MDEventType>
-void ConvToMDEventsWSIndexing::appendEvents(API::Progress *pProgress, const API::BoxController_sptr &bc) {
-  bc->clearBoxesCounter(1);
-  bc->clearGridBoxesCounter(0);
+void ConvToMDEventsWSIndexing::appendEvents(API::Progress *pProgress, const API::BoxController_sptr & /*bc*/) {
   pProgress->resetNumSteps(2, 0, 1);
 
   std::vector<MDEventType<ND>> mdEvents = convertEvents<EventType, ND, MDEventType>();
 
-  morton_index::MDSpaceBounds<ND> space;
-  const auto &pws = m_OutWSWrapper->pWorkspace();
-  for (size_t ax = 0; ax < ND; ++ax) {
-    space(ax, 0) = pws->getDimension(ax)->getMinimum();
-    space(ax, 1) = pws->getDimension(ax)->getMaximum();
-  }
-
   pProgress->report(0);
 
-  auto nThreads = numWorkers();
-  using EventDistributor = MDEventTreeBuilder<ND, MDEventType, typename std::vector<MDEventType<ND>>::iterator>;
-  EventDistributor distributor(nThreads, mdEvents.size() / nThreads / 10, bc, space);
-
-  auto rootAndErr = distributor.distribute(mdEvents);
-  m_OutWSWrapper->pWorkspace()->setBox(rootAndErr.root);
-  rootAndErr.root->calculateGridCaches();
+  using Workspace = DataObjects::MDEventWorkspace<MDEventType<ND>, ND>;
+  auto &ws = dynamic_cast<Workspace &>(*m_OutWSWrapper->pWorkspace());
+  MDEventWorkspaceBuilder<MDEventType<ND>, ND> builder(ws, numWorkers());
+  builder.addEvents(std::move(mdEvents));
+  const auto err = builder.build();
 
   std::stringstream ss;
-  ss << rootAndErr.err;
+  ss << err;
   g_Log.information("Error with using Morton indexes is:\n" + ss.str());
   pProgress->report(1);
 }
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidMDAlgorithms/DllConfig.h"
 
 namespace Mantid {
@@ -37,6 +38,8 @@ private:
   void init() override;
   /// Run the algorithm
   void exec() override;
+  /// Build the boxes of the workspace from the Morton index of its events
+  template <typename MDE, size_t nd> void buildBoxes(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 };
 
 } // namespace MDAlgorithms
@@ -59,6 +59,8 @@ private:
   size_t m_nDataObjects = 0;
   /// call back to add event data
   template <typename MDE, size_t nd> void addEventsData(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
+  /// call back to build the boxes from the Morton index of the events
+  template <typename MDE, size_t nd> void buildBoxes(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
   /// Quick check of the structure, so we can abort if passed junk.
   void quickFileCheck();
   ///  Check that the a flag exists in the file.
@@ -0,0 +1,86 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IMDEventWorkspace_fwd.h"
+#include "MantidGeometry/MDGeometry/MDTypes.h"
+#include "MantidKernel/Matrix.h"
+#include "MantidKernel/SingletonHolder.h"
+#include "MantidMDAlgorithms/DllConfig.h"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+/** Keeps histograms binned from MDEventWorkspaces so that later cuts of the same workspace can be summed from the
+  cached bins instead of from the events.
+
+  A histogram is described by the affine transform from the coordinates of the workspace to bin indices, and the
+  number of bins in each output dimension. A cut can be made from a cached histogram if it has the same output
+  directions, each of its bins is a whole number of cached bins, and it lies inside the cached histogram. This is
+  the case when only the number of bins or the range of a dimension change between cuts, and the cached histogram
+  has the finer bins.
+
+  Entries are dropped when their workspace is deleted or its modification count changes, and the least recently used
+  entries are dropped to keep the cache within the memory set by the BinMD.CacheMemoryMB property (default 256 MB).
+*/
+class MANTID_MDALGORITHMS_DLL MDBinningCacheImpl {
+public:
+  MDBinningCacheImpl(const MDBinningCacheImpl &) = delete;
+  MDBinningCacheImpl &operator=(const MDBinningCacheImpl &) = delete;
+
+  bool fill(const API::IMDEventWorkspace &ws, const Kernel::Matrix<coord_t> &transform,
+            const std::vector<size_t> &numBins, signal_t *signals, signal_t *errorsSquared, signal_t *numEvents);
+  void store(const std::shared_ptr<const API::IMDEventWorkspace> &ws, const Kernel::Matrix<coord_t> &transform,
+             const std::vector<size_t> &numBins, const signal_t *signals, const signal_t *errorsSquared,
+             const signal_t *numEvents);
+  void clear();
+  /// @return the number of cached histograms
+  size_t size() const;
+  size_t getMemorySize() const;
+
+private:
+  /// Private Constructor for singleton class
+  MDBinningCacheImpl() = default;
+  friend struct Kernel::CreateUsingNew<MDBinningCacheImpl>;
+
+  /// A histogram binned from a workspace
+  struct Entry {
+    std::weak_ptr<const API::IMDEventWorkspace> workspace;
+    /// The modification count of the workspace when it was binned
+    uint64_t modificationCount;
+    Kernel::Matrix<coord_t> transform;
+    std::vector<size_t> numBins;
+    std::vector<signal_t> signals;
+    std::vector<signal_t> errorsSquared;
+    std::vector<signal_t> numEvents;
+  };
+
+  void removeOutOfDate();
+  size_t memoryUsed() const;
+
+  mutable std::mutex m_mutex;
+  /// The entries, most recently used first
+  std::list<Entry> m_entries;
+};
+
+/// The specialization of the SingletonHolder class that holds the cache of binned histograms
+using MDBinningCache = Kernel::SingletonHolder<MDBinningCacheImpl>;
+
+} // namespace MDAlgorithms
+} // namespace Mantid
+
+namespace Mantid {
+namespace Kernel {
+EXTERN_MANTID_MDALGORITHMS template class MANTID_MDALGORITHMS_DLL
+    Mantid::Kernel::SingletonHolder<Mantid::MDAlgorithms::MDBinningCacheImpl>;
+}
+} // namespace Mantid
@@ -0,0 +1,209 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/MDBox.h"
+#include "MantidDataObjects/MDEventWorkspace.h"
+#include "MantidDataObjects/MDGridBox.h"
+#include "MantidDataObjects/MortonIndex/CoordinateConversion.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidMDAlgorithms/MDEventTreeBuilder.h"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+/// The class template of an MD event type, as used by MDEventTreeBuilder
+template <typename MDE> struct MDEventTemplate;
+template <template <size_t> class MDEventType, size_t nd> struct MDEventTemplate<MDEventType<nd>> {
+  template <size_t ND> using type = MDEventType<ND>;
+};
+
+/**
+ * @param splitInto :: the number of boxes a box is split into in each dimension
+ * @return true if boxes are split into the same power of 2 in every dimension, which building them from a Morton
+ * index needs
+ */
+template <typename T> bool isMortonSplitValid(const std::vector<T> &splitInto) {
+  if (splitInto.empty())
+    return false;
+  const T n = splitInto.front();
+  return n > 1 && (n & (n - 1)) == 0 &&
+         std::all_of(splitInto.cbegin(), splitInto.cend(), [n](const T split) { return split == n; });
+}
+
+/**
+ * @param ws :: an MDEventWorkspace
+ * @return true if the boxes of the workspace can be built from the Morton index of its events by
+ * MDEventWorkspaceBuilder. The index of coord_t coordinates is implemented for 2 to 4 dimensions.
+ */
+inline bool canBuildFromMortonIndex(const API::IMDEventWorkspace &ws) {
+  const size_t nd = ws.getNumDims();
+  const auto bc = ws.getBoxController();
+  return nd >= 2 && nd <= 4 && !ws.isFileBacked() && !bc->getSplitTopInto() &&
+         isMortonSplitValid(bc->getSplitIntoAll());
+}
+
+/**
+ * Builds the boxes of an MDEventWorkspace from batches of events in one pass, instead of adding the events one at a
+ * time and splitting the boxes with splitAllIfNeeded. The events are sorted by their Morton index and the boxes are
+ * made from the sorted ranges by MDEventTreeBuilder, as in the indexed version of ConvertToMD.
+ *
+ * Batches can be added from any number of producers on any threads. build() takes the events already in the
+ * workspace as well as the added ones, and replaces the boxes of the workspace. Events outside the extents of the
+ * workspace are dropped. The coordinates of the events are rounded to the resolution of the Morton index.
+ *
+ * The workspace must be in memory, have 2, 3 or 4 dimensions and split boxes into the same power of 2 in every
+ * dimension: use canBuildFromMortonIndex() to check before adding any events.
+ * @tparam MDE :: the type of event, MDLeanEvent<nd> or MDEvent<nd>
+ * @tparam nd :: the number of dimensions
+ */
+template <typename MDE, size_t nd> class MDEventWorkspaceBuilder {
+public:
+  using WorkspaceType = DataObjects::MDEventWorkspace<MDE, nd>;
+
+  explicit MDEventWorkspaceBuilder(WorkspaceType &ws, const int numThreads = -1);
+  void reserve(const size_t numEvents);
+  void addEvents(std::vector<MDE> &&events);
+  void addEvents(const std::vector<MDE> &events);
+  /// @return the number of events added so far
+  size_t getNumEvents() const;
+  morton_index::MDCoordinate<nd> build();
+
+private:
+  using EventIterator = typename std::vector<MDE>::iterator;
+  using TreeBuilder = MDEventTreeBuilder<nd, MDEventTemplate<MDE>::template type, EventIterator>;
+
+  void takeWorkspaceEvents();
+  void removeEventsOutside(const morton_index::MDSpaceBounds<nd> &space);
+
+  WorkspaceType &m_ws;
+  const int m_numThreads;
+  mutable std::mutex m_mutex;
+  std::vector<MDE> m_events;
+};
+
+/**
+ * Constructor
+ * @param ws :: the workspace to build. It must pass canBuildFromMortonIndex().
+ * @param numThreads :: the number of threads used to sort the events and make the boxes, all available if < 1
+ * @throw std::invalid_argument if the boxes of the workspace cannot be built from a Morton index
+ */
+template <typename MDE, size_t nd>
+MDEventWorkspaceBuilder<MDE, nd>::MDEventWorkspaceBuilder(WorkspaceType &ws, const int numThreads)
+    : m_ws(ws), m_numThreads(numThreads < 1 ? PARALLEL_GET_MAX_THREADS : numThreads) {
+  if (!canBuildFromMortonIndex(ws))
+    throw std::invalid_argument("The boxes of this workspace cannot be built from a Morton index. It must be in "
+                                "memory, have 2 to 4 dimensions and split into the same power of 2 in each.");
+}
+
+/// Reserve memory for the given number of events, when the total is known in advance
+template <typename MDE, size_t nd> void MDEventWorkspaceBuilder<MDE, nd>::reserve(const size_t numEvents) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.reserve(numEvents);
+}
+
+/**
+ * Add a batch of events. This may be called from several threads at once.
+ * @param events :: the events to add, which are moved from
+ */
+template <typename MDE, size_t nd> void MDEventWorkspaceBuilder<MDE, nd>::addEvents(std::vector<MDE> &&events) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_events.empty() && m_events.capacity() < events.size())
+    m_events = std::move(events);
+  else
+    m_events.insert(m_events.end(), events.cbegin(), events.cend());
+  std::vector<MDE>().swap(events);
+}
+
+/**
+ * Add a batch of events. This may be called from several threads at once.
+ * @param events :: the events to add
+ */
+template <typename MDE, size_t nd> void MDEventWorkspaceBuilder<MDE, nd>::addEvents(const std::vector<MDE> &events) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.insert(m_events.end(), events.cbegin(), events.cend());
+}
+
+template <typename MDE, size_t nd> size_t MDEventWorkspaceBuilder<MDE, nd>::getNumEvents() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_events.size();
+}
+
+/**
+ * Replace the boxes of the workspace with boxes built from all its events and the added ones, and refresh the cached
+ * signals of the boxes. The builder is empty afterwards.
+ * @return the largest change in each coordinate made by rounding the events to their Morton index
+ */
+template <typename MDE, size_t nd> morton_index::MDCoordinate<nd> MDEventWorkspaceBuilder<MDE, nd>::build() {
+  if constexpr (nd < 2 || nd > 4) {
+    throw std::runtime_error("The Morton index is not implemented for " + std::to_string(nd) + " dimensions");
+  } else {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    takeWorkspaceEvents();
+
+    morton_index::MDSpaceBounds<nd> space;
+    for (size_t d = 0; d < nd; ++d) {
+      space(d, 0) = m_ws.getDimension(d)->getMinimum();
+      space(d, 1) = m_ws.getDimension(d)->getMaximum();
+    }
+    removeEventsOutside(space);
+
+    const auto bc = m_ws.getBoxController();
+    for (size_t depth = 0; depth < bc->getNumMDBoxes().size(); ++depth)
+      bc->clearBoxesCounter(depth);
+    for (size_t depth = 0; depth < bc->getNumMDGridBoxes().size(); ++depth)
+      bc->clearGridBoxesCounter(depth);
+
+    TreeBuilder treeBuilder(m_numThreads, m_events.size() / m_numThreads / 10, bc, space);
+    const auto rootAndError = treeBuilder.distribute(m_events);
+    std::vector<MDE>().swap(m_events);
+
+    m_ws.setBox(rootAndError.root);
+    rootAndError.root->calculateGridCaches();
+    return rootAndError.err;
+  }
+}
+
+/// Move the events held by the boxes of the workspace into the builder, freeing each box as it is emptied
+template <typename MDE, size_t nd> void MDEventWorkspaceBuilder<MDE, nd>::takeWorkspaceEvents() {
+  std::vector<API::IMDNode *> boxes;
+  m_ws.getBox()->getBoxes(boxes, 1000, true);
+  size_t numEvents = m_events.size();
+  for (const auto *box : boxes)
+    numEvents += box->getNPoints();
+  m_events.reserve(numEvents);
+  for (auto *node : boxes) {
+    auto *box = dynamic_cast<DataObjects::MDBox<MDE, nd> *>(node);
+    if (!box)
+      continue;
+    const auto &events = box->getConstEvents();
+    m_events.insert(m_events.end(), events.cbegin(), events.cend());
+    box->clear();
+  }
+}
+
+/// Remove the events outside the space, which the Morton index cannot represent
+template <typename MDE, size_t nd>
+void MDEventWorkspaceBuilder<MDE, nd>::removeEventsOutside(const morton_index::MDSpaceBounds<nd> &space) {
+  const auto outside = [&space](const MDE &event) {
+    for (size_t d = 0; d < nd; ++d) {
+      const coord_t x = event.getCenter(d);
+      if (!(x >= space(d, 0) && x <= space(d, 1)))
+        return true;
+    }
+    return false;
+  };
+  m_events.erase(std::remove_if(m_events.begin(), m_events.end(), outside), m_events.end());
+}
+
+} // namespace MDAlgorithms
+} // namespace Mantid
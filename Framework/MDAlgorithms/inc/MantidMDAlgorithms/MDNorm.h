@@ -10,6 +10,7 @@
 #include "MantidAPI/ExperimentInfo.h"
 #include "MantidGeometry/Crystal/SymmetryOperationFactory.h"
 #include "MantidMDAlgorithms/DllConfig.h"
+#include "MantidMDAlgorithms/SignalAccumulator.h"
 #include "MantidMDAlgorithms/SlicingAlgorithm.h"
 
 namespace Mantid {
@@ -77,8 +78,8 @@ private:
 
   void calcSingleDetectorNorm(const std::vector<std::array<double, 4>> &intersections, const double &solid,
                               std::vector<double> &yValues, const size_t &vmdDims, std::vector<coord_t> &pos,
-                              std::vector<coord_t> &posNew, std::vector<std::atomic<signal_t>> &signalArray,
-                              const double &solidBkgd, std::vector<std::atomic<signal_t>> &bkgdSignalArray);
+                              std::vector<coord_t> &posNew, SignalAccumulator &signalArray, const double &solidBkgd,
+                              SignalAccumulator &bkgdSignalArray, const size_t thread);
 
   API::IMDWorkspace_sptr divideMD(const API::IMDHistoWorkspace_sptr &lhs, const API::IMDHistoWorkspace_sptr &rhs,
                                   const std::string &outputwsname, const double &startProgress,
@@ -35,6 +35,8 @@ private:
   void createOutputWorkspace(std::vector<std::string> &inputs);
 
   template <typename MDE, size_t nd> void doPlus(typename Mantid::DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
+  template <typename MDE, size_t nd>
+  void mergeIndexed(typename Mantid::DataObjects::MDEventWorkspace<MDE, nd>::sptr outWS);
 
   /// Vector of input MDWorkspaces
   std::vector<Mantid::API::IMDEventWorkspace_sptr> m_workspaces;
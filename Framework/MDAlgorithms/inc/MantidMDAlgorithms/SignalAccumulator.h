@@ -0,0 +1,66 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/MDGeometry/MDTypes.h"
+#include "MantidMDAlgorithms/DllConfig.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+/** SignalAccumulator : Accumulate contributions to the bins of a histogram from many threads without atomic
+ * operations. Each thread adds into its own buffer, which is either
+ *
+ * - DENSE: a full copy of the histogram, allocated the first time the thread adds to it
+ * - SPARSE: a hash map of only the bins the thread has added to
+ *
+ * addTo() merges the buffers in thread order. If each thread adds the same contributions in the same order, e.g. from
+ * an OpenMP loop with a static schedule, the sums are reproducible and the same for both strategies.
+ */
+class MANTID_MDALGORITHMS_DLL SignalAccumulator {
+public:
+  enum class Strategy { DENSE, SPARSE };
+
+  static Strategy chooseStrategy(const size_t numBins, const size_t numThreads, const size_t availableMemory);
+
+  SignalAccumulator(const size_t numBins, const size_t numThreads);
+  SignalAccumulator(const size_t numBins, const size_t numThreads, const Strategy strategy);
+
+  /// Add a contribution to a bin. Only thread number thread may add to its buffer.
+  inline void add(const size_t thread, const size_t index, const signal_t value) {
+    if (m_strategy == Strategy::DENSE) {
+      auto &buffer = m_dense[thread];
+      if (buffer.empty())
+        buffer.resize(m_numBins, 0.);
+      buffer[index] += value;
+    } else {
+      m_sparse[thread][index] += value;
+    }
+  }
+
+  void addTo(signal_t *output) const;
+
+  Strategy strategy() const { return m_strategy; }
+  size_t numBins() const { return m_numBins; }
+  size_t numThreads() const { return m_numThreads; }
+
+private:
+  const size_t m_numBins;
+  const size_t m_numThreads;
+  const Strategy m_strategy;
+  /// one full histogram per thread for DENSE
+  std::vector<std::vector<signal_t>> m_dense;
+  /// one map of bin index to signal per thread for SPARSE
+  std::vector<std::unordered_map<size_t, signal_t>> m_sparse;
+};
+
+} // namespace MDAlgorithms
+} // namespace Mantid
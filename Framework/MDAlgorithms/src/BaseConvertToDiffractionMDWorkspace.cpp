@@ -91,6 +91,13 @@ void BaseConvertToDiffractionMDWorkspace::init() {
                   "necessary if one wants to generate multiple file based workspaces in "
                   "order to merge them later\n");
   setPropertyGroup("MinRecursionDepth", getBoxSettingsGroupName());
+
+  declareProperty("ConverterType", "Default",
+                  std::make_shared<StringListValidator>(std::vector<std::string>{"Default", "Indexed"}),
+                  "Passed to ConvertToMD. Indexed sorts the events by their Morton index and builds the boxes "
+                  "in one pass, which can be much faster for large files. It needs SplitInto to be the same "
+                  "power of 2 for all dimensions.");
+  setPropertyGroup("ConverterType", getBoxSettingsGroupName());
 }
 
 /** method to convert the value of the target frame specified for the
@@ -179,6 +186,7 @@ void BaseConvertToDiffractionMDWorkspace::exec() {
   if (depth == "0")
     depth = "1"; // ConvertToMD does not understand 0 depth
   Convert->setProperty("MinRecursionDepth", depth);
+  Convert->setProperty("ConverterType", this->getPropertyValue("ConverterType"));
 
   Convert->executeAsChildAlg();
 
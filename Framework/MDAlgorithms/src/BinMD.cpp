@@ -20,8 +20,16 @@
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/Utils.h"
+#include "MantidMDAlgorithms/MDBinningCache.h"
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 namespace Mantid::MDAlgorithms {
 
 // Register the algorithm into the AlgorithmFactory
@@ -32,6 +40,118 @@ using namespace Mantid::API;
 using namespace Mantid::Geometry;
 using namespace Mantid::DataObjects;
 
+namespace {
+/// The most memory, in bytes, held by the copies of the histogram that the binning threads sum into
+constexpr size_t MAX_PARTIAL_HISTOGRAM_BYTES{size_t(64) << 20};
+/// The memory for one bin of a copy: signal, error squared and number of events
+constexpr size_t PARTIAL_BIN_BYTES{3 * sizeof(signal_t)};
+/// How many boxes of a file-backed workspace are read ahead of each binning thread
+constexpr size_t PREFETCH_BOXES_PER_THREAD{4};
+
+/**
+ * Split boxes into contiguous ranges with about the same number of events
+ * @param boxes :: the boxes
+ * @param numRanges :: the number of ranges
+ * @return the index of the first box of each range, followed by the number of boxes
+ */
+std::vector<size_t> splitByEvents(const std::vector<IMDNode *> &boxes, const size_t numRanges) {
+  // count each box as one more event so boxes without events are also spread out
+  std::vector<uint64_t> cumulative(boxes.size());
+  uint64_t total = 0;
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    total += boxes[i]->getNPoints() + 1;
+    cumulative[i] = total;
+  }
+  std::vector<size_t> starts(numRanges + 1, boxes.size());
+  starts[0] = 0;
+  for (size_t range = 1; range < numRanges; ++range) {
+    const auto target = static_cast<uint64_t>(static_cast<double>(total) * static_cast<double>(range) /
+                                              static_cast<double>(numRanges));
+    starts[range] =
+        static_cast<size_t>(std::upper_bound(cumulative.cbegin(), cumulative.cend(), target) - cumulative.cbegin());
+  }
+  return starts;
+}
+
+/**
+ * A bounded queue passing items from one producer to several consumers. Items handed back with finished() are
+ * collected for the producer, so only the producer needs to touch their resources.
+ */
+template <typename Item> class PrefetchQueue {
+public:
+  explicit PrefetchQueue(const size_t capacity) : m_capacity(capacity) {}
+
+  /// Add an item, waiting until fewer than capacity items are in flight. @return false if the queue was aborted
+  bool push(const Item &item) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_space.wait(lock, [this]() { return m_inFlight < m_capacity || m_aborted; });
+    if (m_aborted) {
+      m_finished.emplace_back(item);
+      return false;
+    }
+    m_pending.emplace_back(item);
+    ++m_inFlight;
+    m_available.notify_one();
+    return true;
+  }
+
+  /// Take the next item, waiting for one. @return false once the queue is closed and empty, or aborted
+  bool pop(Item &item) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_available.wait(lock, [this]() { return !m_pending.empty() || m_closed || m_aborted; });
+    if (m_pending.empty() || m_aborted)
+      return false;
+    item = m_pending.front();
+    m_pending.pop_front();
+    return true;
+  }
+
+  /// Hand back an item that has been used
+  void finished(const Item &item) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_finished.emplace_back(item);
+    --m_inFlight;
+    m_space.notify_one();
+  }
+
+  /// @return the items handed back since the last call
+  std::vector<Item> takeFinished() {
+    std::vector<Item> finished;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    finished.swap(m_finished);
+    return finished;
+  }
+
+  /// No more items will be pushed
+  void close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_closed = true;
+    m_available.notify_all();
+  }
+
+  /// Stop both ends. Items not taken yet are handed back.
+  void abort() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_aborted = true;
+    m_finished.insert(m_finished.end(), m_pending.cbegin(), m_pending.cend());
+    m_pending.clear();
+    m_available.notify_all();
+    m_space.notify_all();
+  }
+
+private:
+  const size_t m_capacity;
+  size_t m_inFlight{0};
+  bool m_closed{false};
+  bool m_aborted{false};
+  std::deque<Item> m_pending;
+  std::vector<Item> m_finished;
+  std::mutex m_mutex;
+  std::condition_variable m_available;
+  std::condition_variable m_space;
+};
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
@@ -65,11 +185,17 @@ void BinMD::init() {
   setPropertyGroup("IterateEvents", grp);
 
   declareProperty(std::make_unique<PropertyWithValue<bool>>("Parallel", false, Direction::Input),
-                  "Temporary parameter: true to run in parallel. This is ignored for "
-                  "file-backed workspaces, where running in parallel makes things slower "
-                  "due to disk thrashing.");
+                  "True to bin in parallel. The threads are given equal numbers of events "
+                  "when iterating events. For file-backed workspaces, the boxes are read "
+                  "in file order by one thread, ahead of the binning threads.");
   setPropertyGroup("Parallel", grp);
 
+  declareProperty(std::make_unique<PropertyWithValue<bool>>("UseCache", false, Direction::Input),
+                  "True to keep the bins of this cut in memory, and to make the cut from the kept bins of an "
+                  "earlier cut of the same workspace when each of its bins is a whole number of the earlier bins. "
+                  "The memory used is limited by the BinMD.CacheMemoryMB property.");
+  setPropertyGroup("UseCache", grp);
+
   declareProperty(std::make_unique<WorkspaceProperty<IMDHistoWorkspace>>("TemporaryDataWorkspace", "", Direction::Input,
                                                                          PropertyMode::Optional),
                   "An input MDHistoWorkspace used to accumulate results from "
@@ -88,87 +214,115 @@ void BinMD::init() {
  *(inclusive)
  * @param chunkMax :: the maximum index in each dimension to consider "valid"
  *(exclusive)
+ * @param histogram :: the histogram to add the events to
+ */
+template <typename MDE, size_t nd>
+inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax,
+                            const BinnedArrays &histogram) {
+  size_t linearIndex = 0;
+  if (findWholeBoxBin(box, chunkMin, chunkMax, linearIndex)) {
+    // Add the CACHED signal from the entire box
+    histogram.signals[linearIndex] += box->getSignal();
+    histogram.errors[linearIndex] += box->getErrorSquared();
+    // TODO: If DataObjects get a weight, this would need to get the summed
+    // weight.
+    histogram.numEvents[linearIndex] += static_cast<signal_t>(box->getNPoints());
+
+    // And don't bother looking at each event. This may save lots of time
+    // loading from disk.
+    return;
+  }
+
+  // If you get here, you could not determine that the entire box was in the
+  // same bin.
+  // So you need to iterate through events.
+  binEvents<MDE, nd>(box->getConstEvents(), chunkMin, chunkMax, histogram);
+  // Done with the events list
+  box->releaseEvents();
+}
+
+//----------------------------------------------------------------------------------------------
+/** Evaluate whether the entire box is in the same bin. This does not read the events of the box.
+ *
+ * @param box :: pointer to the MDBox
+ * @param chunkMin :: the minimum index in each dimension to consider "valid" (inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid" (exclusive)
+ * @param[out] linearIndex :: the bin holding the box, if it is in a single bin
+ * @return true if all of the box is in one bin
  */
 template <typename MDE, size_t nd>
-inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax) {
+bool BinMD::findWholeBoxBin(const MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax,
+                            size_t &linearIndex) const {
+  // There is a check that the number of events is enough for it to make sense
+  // to do all this processing.
+  if (box->getNPoints() <= (1 << nd) * 2)
+    return false;
+
   // An array to hold the rotated/transformed coordinates
   auto outCenter = std::vector<coord_t>(m_outD);
+  size_t numVertexes = 0;
+  auto vertexes = box->getVertexesArray(numVertexes);
 
-  // Evaluate whether the entire box is in the same bin
-  if (box->getNPoints() > (1 << nd) * 2) {
-    // There is a check that the number of events is enough for it to make sense
-    // to do all this processing.
-    size_t numVertexes = 0;
-    auto vertexes = box->getVertexesArray(numVertexes);
-
-    // All vertexes have to be within THE SAME BIN = have the same linear index.
-    size_t lastLinearIndex = 0;
-    bool badOne = false;
+  // All vertexes have to be within THE SAME BIN = have the same linear index.
+  size_t lastLinearIndex = 0;
+  for (size_t i = 0; i < numVertexes; i++) {
+    // Cache the center of the event (again for speed)
+    const coord_t *inCenter = vertexes.get() + i * nd;
 
-    for (size_t i = 0; i < numVertexes; i++) {
-      // Cache the center of the event (again for speed)
-      const coord_t *inCenter = vertexes.get() + i * nd;
-
-      // Now transform to the output dimensions
-      m_transform->apply(inCenter, outCenter.data());
-
-      // To build up the linear index
-      size_t linearIndex = 0;
-      // To mark VERTEXES outside range
-      badOne = false;
-
-      /// Loop through the dimensions on which we bin
-      for (size_t bd = 0; bd < m_outD; bd++) {
-        // What is the bin index in that dimension
-        coord_t x = outCenter[bd];
-        auto ix = size_t(x);
-        // Within range (for this chunk)?
-        if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
-          // Build up the linear index
-          linearIndex += indexMultiplier[bd] * ix;
-        } else {
-          // Outside the range
-          badOne = true;
-          break;
-        }
-      } // (for each dim in MDHisto)
+    // Now transform to the output dimensions
+    m_transform->apply(inCenter, outCenter.data());
 
-      // Is the vertex at the same place as the last one?
-      if (!badOne) {
-        if ((i > 0) && (linearIndex != lastLinearIndex)) {
-          // Change of index
-          badOne = true;
-          break;
-        }
-        lastLinearIndex = linearIndex;
+    // To build up the linear index
+    size_t vertexIndex = 0;
+    /// Loop through the dimensions on which we bin
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      // What is the bin index in that dimension
+      coord_t x = outCenter[bd];
+      auto ix = size_t(x);
+      // Within range (for this chunk)?
+      if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
+        // Build up the linear index
+        vertexIndex += indexMultiplier[bd] * ix;
+      } else {
+        // Outside the range
+        return false;
       }
+    } // (for each dim in MDHisto)
 
-      // Was the vertex completely outside the range?
-      if (badOne)
-        break;
-    } // (for each vertex)
+    // Is the vertex at the same place as the last one?
+    if ((i > 0) && (vertexIndex != lastLinearIndex))
+      return false;
+    lastLinearIndex = vertexIndex;
+  } // (for each vertex)
 
-    if (!badOne) {
-      // Yes, the entire box is within a single bin
-      //        std::cout << "Box at " << box->getExtentsStr() << " is within a
-      //        single bin.\n";
-      // Add the CACHED signal from the entire box
-      signals[lastLinearIndex] += box->getSignal();
-      errors[lastLinearIndex] += box->getErrorSquared();
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
+  // Yes, the entire box is within a single bin
+  linearIndex = lastLinearIndex;
+  return true;
+}
 
-      // And don't bother looking at each event. This may save lots of time
-      // loading from disk.
-      return;
+//----------------------------------------------------------------------------------------------
+/** Bin the events of a box
+ *
+ * @param events :: the events
+ * @param chunkMin :: the minimum index in each dimension to consider "valid" (inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid" (exclusive)
+ * @param histogram :: the histogram to add the events to
+ */
+template <typename MDE, size_t nd>
+void BinMD::binEvents(const std::vector<MDE> &events, const size_t *const chunkMin, const size_t *const chunkMax,
+                      const BinnedArrays &histogram) {
+  if (m_columnTransform) {
+    auto &columns = MDEventColumns<nd>::threadLocal();
+    for (size_t next = 0; next < events.size();) {
+      next = columns.gather(events, next);
+      columns.transform(*m_columnTransform);
+      columns.bin(chunkMin, chunkMax, indexMultiplier.data(), histogram.signals, histogram.errors,
+                  histogram.numEvents);
     }
+    return;
   }
-
-  // If you get here, you could not determine that the entire box was in the
-  // same bin.
-  // So you need to iterate through events.
-  const std::vector<MDE> &events = box->getConstEvents();
+  // An array to hold the rotated/transformed coordinates
+  auto outCenter = std::vector<coord_t>(m_outD);
   for (auto it = events.begin(); it != events.end(); ++it) {
     // Cache the center of the event (again for speed)
     const coord_t *inCenter = it->getCenter();
@@ -199,15 +353,13 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, c
 
     if (!badOne) {
       // Sum the signals as doubles to preserve precision
-      signals[linearIndex] += static_cast<signal_t>(it->getSignal());
-      errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
+      histogram.signals[linearIndex] += static_cast<signal_t>(it->getSignal());
+      histogram.errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
       // TODO: If DataObjects get a weight, this would need to get the summed
       // weight.
-      numEvents[linearIndex] += 1.0;
+      histogram.numEvents[linearIndex] += 1.0;
     }
   }
-  // Done with the events list
-  box->releaseEvents();
 }
 
 //----------------------------------------------------------------------------------------------
@@ -236,14 +388,203 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
   errors = outWS->mutableErrorSquaredArray();
   numEvents = outWS->mutableNumEventsArray();
 
+  // Bin blocks of events as columns if the workspace asks for it and the transform allows it
+  m_columnTransform.reset();
+  if (bc->useColumnarEvents() && m_transform->getInD() == nd && m_outD <= nd) {
+    try {
+      m_columnTransform = std::make_unique<MDColumnTransform>(*m_transform);
+    } catch (std::runtime_error &) {
+      g_log.information("The transform has no affine form so the events are not binned as columns.");
+    }
+  }
+
   if (!m_accumulate) {
     // Start with signal/error/numEvents at 0.0
     outWS->setTo(0.0, 0.0, 0.0);
   }
 
+  // Each binning thread but the first sums into its own copy of the histogram. The copies are merged at the end, so
+  // the threads can be given equal numbers of events wherever the events are in the output.
+  const bool doParallel = getProperty("Parallel");
+  const size_t numPoints = outWS->getNPoints();
+  const auto maxThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  size_t numHistograms = 1;
+  if (doParallel && maxThreads > 1) {
+    const size_t copyBytes = PARTIAL_BIN_BYTES * std::max(numPoints, size_t(1));
+    numHistograms = std::min(maxThreads, 1 + MAX_PARTIAL_HISTOGRAM_BYTES / copyBytes);
+    // Not enough memory for a copy per thread: the threads share the output, each binning a slab of it. File-backed
+    // workspaces keep to fewer threads instead, as binning slabs would read each box once per slab it overlaps.
+    if (numHistograms < maxThreads && !bc->isFileBacked()) {
+      binOutputSlabs<MDE, nd>(ws);
+      return;
+    }
+  }
+
+  // Region of interest: all of the output
+  std::vector<size_t> chunkMin(m_outD, 0);
+  std::vector<size_t> chunkMax(m_outD);
+  for (size_t bd = 0; bd < m_outD; bd++)
+    chunkMax[bd] = m_binDimensions[bd]->getNBins();
+
+  // Build an implicit function (it needs to be in the space of the
+  // MDEventWorkspace)
+  auto function = this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
+
+  // Use getBoxes() to get an array with a pointer to each box
+  std::vector<API::IMDNode *> boxes;
+  // Leaf-only; no depth limit; with the implicit function passed to it.
+  ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+
+  // Sort boxes by file position IF file backed. This reduces seeking time,
+  // hopefully.
+  if (bc->isFileBacked())
+    API::IMDNode::sortObjByID(boxes);
+
+  if (prog) {
+    prog->setNotifyStep(0.1);
+    prog->resetNumSteps(static_cast<int64_t>(boxes.size()), 0.0, 1.0);
+  }
+
+  std::vector<signal_t> partials(3 * numPoints * (numHistograms - 1), 0.0);
+  std::vector<BinnedArrays> histograms{{signals, errors, numEvents}};
+  for (size_t i = 1; i < numHistograms; ++i) {
+    signal_t *partial = partials.data() + 3 * numPoints * (i - 1);
+    histograms.emplace_back(BinnedArrays{partial, partial + numPoints, partial + 2 * numPoints});
+  }
+
+  if (bc->isFileBacked() && numHistograms > 1)
+    binFileBackedBoxes<MDE, nd>(boxes, histograms, chunkMin.data(), chunkMax.data());
+  else
+    binBoxRanges<MDE, nd>(boxes, histograms, chunkMin.data(), chunkMax.data());
+  mergeHistograms(histograms);
+}
+
+//----------------------------------------------------------------------------------------------
+/** Split the boxes into contiguous ranges with about the same number of events, then bin each range into its own
+ * histogram in parallel. Splitting the same boxes the same way each time keeps the result reproducible.
+ *
+ * @param boxes :: the leaf boxes to bin
+ * @param histograms :: a histogram for each range
+ * @param chunkMin :: the minimum index in each dimension to consider "valid" (inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid" (exclusive)
+ */
+template <typename MDE, size_t nd>
+void BinMD::binBoxRanges(const std::vector<API::IMDNode *> &boxes, const std::vector<BinnedArrays> &histograms,
+                         const size_t *const chunkMin, const size_t *const chunkMax) {
+  const auto starts = splitByEvents(boxes, histograms.size());
+  const auto numRanges = static_cast<int>(histograms.size());
+  PRAGMA_OMP(parallel for schedule(static, 1) num_threads(numRanges))
+  for (int range = 0; range < numRanges; ++range) {
+    PARALLEL_START_INTERRUPT_REGION
+    for (size_t i = starts[range]; i < starts[range + 1]; ++i) {
+      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+      // Perform the binning in this separate method.
+      if (box && !box->getIsMasked())
+        this->binMDBox(box, chunkMin, chunkMax, histograms[range]);
+
+      // Progress reporting
+      if (prog)
+        prog->report();
+      // For early cancelling of the loop
+      if (this->m_cancel)
+        break;
+    }
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+}
+
+//----------------------------------------------------------------------------------------------
+/** Bin the boxes of a file-backed workspace. A separate thread reads the events of the boxes in file order, up to a
+ * few boxes per binning thread ahead, and releases them again once they are binned. The binning threads take the
+ * boxes as they are read, each adding them to its own histogram.
+ *
+ * @param boxes :: the leaf boxes to bin, sorted by their position in the file
+ * @param histograms :: a histogram for each binning thread
+ * @param chunkMin :: the minimum index in each dimension to consider "valid" (inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid" (exclusive)
+ */
+template <typename MDE, size_t nd>
+void BinMD::binFileBackedBoxes(const std::vector<API::IMDNode *> &boxes, const std::vector<BinnedArrays> &histograms,
+                               const size_t *const chunkMin, const size_t *const chunkMax) {
+  struct ReadBox {
+    MDBox<MDE, nd> *box;
+    /// The events, or nullptr if the whole box is in the bin at linearIndex
+    const std::vector<MDE> *events;
+    size_t linearIndex;
+  };
+  PrefetchQueue<ReadBox> queue(PREFETCH_BOXES_PER_THREAD * histograms.size());
+  const auto releaseEvents = [](const std::vector<ReadBox> &binned) {
+    for (const auto &read : binned) {
+      if (read.events)
+        read.box->releaseEvents();
+    }
+  };
+
+  std::exception_ptr readError;
+  std::thread reader([&]() {
+    try {
+      for (auto *node : boxes) {
+        auto *box = dynamic_cast<MDBox<MDE, nd> *>(node);
+        if (!box || box->getIsMasked()) {
+          if (prog)
+            prog->report();
+          continue;
+        }
+        // release from this thread so only it calls into the disk buffer
+        releaseEvents(queue.takeFinished());
+        ReadBox read{box, nullptr, 0};
+        if (!findWholeBoxBin(box, chunkMin, chunkMax, read.linearIndex))
+          read.events = &box->getConstEvents();
+        if (!queue.push(read))
+          break;
+      }
+    } catch (...) {
+      readError = std::current_exception();
+    }
+    queue.close();
+  });
+
+  PRAGMA_OMP(parallel num_threads(static_cast<int>(histograms.size())))
+  {
+    const auto &histogram = histograms[PARALLEL_THREAD_NUMBER];
+    PARALLEL_START_INTERRUPT_REGION
+    ReadBox read{nullptr, nullptr, 0};
+    while (!m_cancel && queue.pop(read)) {
+      if (read.events) {
+        binEvents<MDE, nd>(*read.events, chunkMin, chunkMax, histogram);
+      } else {
+        histogram.signals[read.linearIndex] += read.box->getSignal();
+        histogram.errors[read.linearIndex] += read.box->getErrorSquared();
+        histogram.numEvents[read.linearIndex] += static_cast<signal_t>(read.box->getNPoints());
+      }
+      queue.finished(read);
+      if (prog)
+        prog->report();
+    }
+    PARALLEL_END_INTERRUPT_REGION
+    // stop the reader if the binning failed or was cancelled
+    if (m_parallelException || m_cancel)
+      queue.abort();
+  }
+  reader.join();
+  releaseEvents(queue.takeFinished());
+  if (readError)
+    std::rethrow_exception(readError);
+  PARALLEL_CHECK_INTERRUPT_REGION
+}
+
+//----------------------------------------------------------------------------------------------
+/** Bin the output in slabs along its first dimension, in parallel. The threads write straight into the output, so
+ * this is used when the output is too large for each thread to have a copy.
+ *
+ * @param ws :: MDEventWorkspace of the given type.
+ */
+template <typename MDE, size_t nd> void BinMD::binOutputSlabs(typename MDEventWorkspace<MDE, nd>::sptr ws) {
+  const BinnedArrays histogram{signals, errors, numEvents};
+
   // The dimension (in the output workspace) along which we chunk for parallel
   // processing
-  // TODO: Find the smartest dimension to chunk against
   size_t chunkDimension = 0;
 
   // How many bins (in that dimension) per chunk.
@@ -252,14 +593,6 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
   if (chunkNumBins < 1)
     chunkNumBins = 1;
 
-  // Do we actually do it in parallel?
-  bool doParallel = getProperty("Parallel");
-  // Not if file-backed!
-  if (bc->isFileBacked())
-    doParallel = false;
-  if (!doParallel)
-    chunkNumBins = int(m_binDimensions[chunkDimension]->getNBins());
-
   // Total number of steps
   size_t progNumSteps = 0;
   if (prog) {
@@ -269,75 +602,91 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
 
   // Run the chunks in parallel. There is no overlap in the output workspace so
   // it is thread safe to write to it..
-
-    PRAGMA_OMP( parallel for schedule(dynamic,1) if (doParallel) )
-    for (int chunk = 0; chunk < int(m_binDimensions[chunkDimension]->getNBins()); chunk += chunkNumBins) {
-      PARALLEL_START_INTERRUPT_REGION
-      // Region of interest for this chunk.
-      std::vector<size_t> chunkMin(m_outD);
-      std::vector<size_t> chunkMax(m_outD);
-      for (size_t bd = 0; bd < m_outD; bd++) {
-        // Same limits in the other dimensions
-        chunkMin[bd] = 0;
-        chunkMax[bd] = m_binDimensions[bd]->getNBins();
-      }
-      // Parcel out a chunk in that single dimension dimension
-      chunkMin[chunkDimension] = size_t(chunk);
-      if (size_t(chunk + chunkNumBins) > m_binDimensions[chunkDimension]->getNBins())
-        chunkMax[chunkDimension] = m_binDimensions[chunkDimension]->getNBins();
-      else
-        chunkMax[chunkDimension] = size_t(chunk + chunkNumBins);
-
-      // Build an implicit function (it needs to be in the space of the
-      // MDEventWorkspace)
-      auto function = this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
-
-      // Use getBoxes() to get an array with a pointer to each box
-      std::vector<API::IMDNode *> boxes;
-      // Leaf-only; no depth limit; with the implicit function passed to it.
-      ws->getBox()->getBoxes(boxes, 1000, true, function.get());
-
-      // Sort boxes by file position IF file backed. This reduces seeking time,
-      // hopefully.
-      if (bc->isFileBacked())
-        API::IMDNode::sortObjByID(boxes);
-
-      // For progress reporting, the # of boxes
-      if (prog) {
-        PARALLEL_CRITICAL(BinMD_progress) {
-          g_log.debug() << "Chunk " << chunk << ": found " << boxes.size() << " boxes within the implicit function.\n";
-          progNumSteps += boxes.size();
-          prog->setNumSteps(progNumSteps);
-        }
+  PRAGMA_OMP( parallel for schedule(dynamic,1) )
+  for (int chunk = 0; chunk < int(m_binDimensions[chunkDimension]->getNBins()); chunk += chunkNumBins) {
+    PARALLEL_START_INTERRUPT_REGION
+    // Region of interest for this chunk.
+    std::vector<size_t> chunkMin(m_outD);
+    std::vector<size_t> chunkMax(m_outD);
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      // Same limits in the other dimensions
+      chunkMin[bd] = 0;
+      chunkMax[bd] = m_binDimensions[bd]->getNBins();
+    }
+    // Parcel out a chunk in that single dimension dimension
+    chunkMin[chunkDimension] = size_t(chunk);
+    if (size_t(chunk + chunkNumBins) > m_binDimensions[chunkDimension]->getNBins())
+      chunkMax[chunkDimension] = m_binDimensions[chunkDimension]->getNBins();
+    else
+      chunkMax[chunkDimension] = size_t(chunk + chunkNumBins);
+
+    // Build an implicit function (it needs to be in the space of the
+    // MDEventWorkspace)
+    auto function = this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
+
+    // Use getBoxes() to get an array with a pointer to each box
+    std::vector<API::IMDNode *> boxes;
+    // Leaf-only; no depth limit; with the implicit function passed to it.
+    ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+
+    // For progress reporting, the # of boxes
+    if (prog) {
+      PARALLEL_CRITICAL(BinMD_progress) {
+        g_log.debug() << "Chunk " << chunk << ": found " << boxes.size() << " boxes within the implicit function.\n";
+        progNumSteps += boxes.size();
+        prog->setNumSteps(progNumSteps);
       }
+    }
 
-      // Go through every box for this chunk.
-      for (auto &boxe : boxes) {
-        auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
-        // Perform the binning in this separate method.
-        if (box && !box->getIsMasked())
-          this->binMDBox(box, chunkMin.data(), chunkMax.data());
-
-        // Progress reporting
-        if (prog)
-          prog->report();
-        // For early cancelling of the loop
-        if (this->m_cancel)
-          break;
-      } // for each box in the vector
-      PARALLEL_END_INTERRUPT_REGION
-    } // for each chunk in parallel
-    PARALLEL_CHECK_INTERRUPT_REGION
+    // Go through every box for this chunk.
+    for (auto &boxe : boxes) {
+      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
+      // Perform the binning in this separate method.
+      if (box && !box->getIsMasked())
+        this->binMDBox(box, chunkMin.data(), chunkMax.data(), histogram);
 
-    // Now the implicit function
-    if (implicitFunction) {
+      // Progress reporting
       if (prog)
-        prog->report("Applying implicit function.");
-      signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
-      outWS->applyImplicitFunction(implicitFunction.get(), nan, nan);
+        prog->report();
+      // For early cancelling of the loop
+      if (this->m_cancel)
+        break;
+    } // for each box in the vector
+    PARALLEL_END_INTERRUPT_REGION
+  } // for each chunk in parallel
+  PARALLEL_CHECK_INTERRUPT_REGION
+}
+
+//----------------------------------------------------------------------------------------------
+/** Add the partial histograms to the first one, which is the output workspace
+ *
+ * @param histograms :: the output followed by the partial histograms
+ */
+void BinMD::mergeHistograms(const std::vector<BinnedArrays> &histograms) const {
+  if (histograms.size() < 2)
+    return;
+  const auto numPoints = static_cast<int64_t>(outWS->getNPoints());
+  const auto &output = histograms.front();
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numPoints; ++i) {
+    // always in the same order so the sums are reproducible
+    for (size_t h = 1; h < histograms.size(); ++h) {
+      output.signals[i] += histograms[h].signals[i];
+      output.errors[i] += histograms[h].errors[i];
+      output.numEvents[i] += histograms[h].numEvents[i];
     }
+  }
 }
 
+/// Set the bins outside of the implicit function, if there is one, to NaN
+void BinMD::applyImplicitFunction() {
+  if (implicitFunction) {
+    if (prog)
+      prog->report("Applying implicit function.");
+    signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
+    outWS->applyImplicitFunction(implicitFunction.get(), nan, nan);
+  }
+}
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
@@ -403,10 +752,35 @@ void BinMD::exec() {
                              "Reprocess the input so that it contains full MDEvents.");
   }
 
-  CALL_MDEVENT_FUNCTION(this->binByIterating, m_inWS);
+  // Sum the bins of an earlier cut of the workspace if they make up the bins of this one
+  IMDEventWorkspace_sptr inEWS = std::dynamic_pointer_cast<IMDEventWorkspace>(m_inWS);
+  const bool useCache = getProperty("UseCache");
+  Kernel::Matrix<coord_t> affineTransform;
+  std::vector<size_t> numBins;
+  bool cacheable = useCache && !m_accumulate && inEWS;
+  if (cacheable) {
+    try {
+      affineTransform = m_transform->makeAffineMatrix();
+    } catch (std::runtime_error &) {
+      cacheable = false;
+    }
+    for (const auto &dimension : m_binDimensions)
+      numBins.emplace_back(dimension->getNBins());
+  }
+  if (cacheable && MDBinningCache::Instance().fill(*inEWS, affineTransform, numBins, outWS->mutableSignalArray(),
+                                                   outWS->mutableErrorSquaredArray(),
+                                                   outWS->mutableNumEventsArray())) {
+    g_log.information("The bins were summed from an earlier cut of the workspace.");
+  } else {
+    CALL_MDEVENT_FUNCTION(this->binByIterating, m_inWS);
+    if (cacheable)
+      MDBinningCache::Instance().store(inEWS, affineTransform, numBins, outWS->getSignalArray(),
+                                       outWS->getErrorSquaredArray(), outWS->getNumEventsArray());
+  }
+
+  applyImplicitFunction();
 
   // Copy the coordinate system & experiment infos to the output
-  IMDEventWorkspace_sptr inEWS = std::dynamic_pointer_cast<IMDEventWorkspace>(m_inWS);
   if (inEWS) {
     outWS->setCoordinateSystem(inEWS->getSpecialCoordinateSystem());
     try {
@@ -10,7 +10,10 @@
 #include "MantidMDAlgorithms/FakeMDEventData.h"
 
 #include "MantidDataObjects/FakeMD.h"
+#include "MantidDataObjects/MDEventFactory.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/ListValidator.h"
+#include "MantidMDAlgorithms/MDEventWorkspaceBuilder.h"
 
 namespace Mantid::MDAlgorithms {
 
@@ -64,16 +67,42 @@ void FakeMDEventData::init() {
   declareProperty(std::make_unique<PropertyWithValue<bool>>("RandomizeSignal", false),
                   "If true, the events' signal and error values will be "
                   "randomized around 1.0+-0.5.");
+
+  declareProperty("BoxBuilder", "Default",
+                  std::make_shared<StringListValidator>(std::vector<std::string>{"Default", "Indexed"}),
+                  "How the boxes are made after adding the events. Indexed sorts all the events by their Morton "
+                  "index and builds the boxes in one pass, which is faster for many events but rounds their "
+                  "coordinates to the resolution of the index. It needs an in-memory workspace with 2 to 4 "
+                  "dimensions, split into the same power of 2 in each, otherwise the Default is used.");
 }
 
 /**
  * Execute the algorithm.
  */
 void FakeMDEventData::exec() {
+  IMDEventWorkspace_sptr ws = getProperty("InputWorkspace");
+  bool indexed = getPropertyValue("BoxBuilder") == "Indexed";
+  if (indexed && !canBuildFromMortonIndex(*ws)) {
+    g_log.warning("The boxes of the workspace cannot be built from the Morton index of the events. Using the "
+                  "Default box builder.");
+    indexed = false;
+  }
 
   FakeMD faker(getProperty("UniformParams"), getProperty("PeakParams"), getProperty("EllipsoidParams"),
                getProperty("RandomSeed"), getProperty("RandomizeSignal"));
-  faker.fill(getProperty("InputWorkspace"));
+  faker.fill(ws, !indexed);
+  if (indexed) {
+    CALL_MDEVENT_FUNCTION(buildBoxes, ws);
+  }
+}
+
+/**
+ * Replace the boxes of the workspace with boxes built from the Morton index of all its events
+ * @param ws :: the workspace the fake events were added to
+ */
+template <typename MDE, size_t nd> void FakeMDEventData::buildBoxes(typename MDEventWorkspace<MDE, nd>::sptr ws) {
+  MDEventWorkspaceBuilder<MDE, nd> builder(*ws);
+  builder.build();
 }
 
 } // namespace Mantid::MDAlgorithms
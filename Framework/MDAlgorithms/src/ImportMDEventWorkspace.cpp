@@ -12,8 +12,10 @@
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventInserter.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
+#include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MDUnit.h"
 #include "MantidKernel/MDUnitFactory.h"
+#include "MantidMDAlgorithms/MDEventWorkspaceBuilder.h"
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -92,6 +94,12 @@ void ImportMDEventWorkspace::init() {
                   "File of type txt");
   declareProperty(std::make_unique<WorkspaceProperty<IMDEventWorkspace>>("OutputWorkspace", "", Direction::Output),
                   "An output workspace.");
+  declareProperty("BoxBuilder", "Default",
+                  std::make_shared<StringListValidator>(std::vector<std::string>{"Default", "Indexed"}),
+                  "How the boxes are made. Default keeps all the events in a single box. Indexed sorts the events "
+                  "by their Morton index and splits the boxes into 2 in each dimension until they hold at most "
+                  "1024 events, rounding the coordinates to the resolution of the index. Indexed needs 2 to 4 "
+                  "dimensions, otherwise the Default is used.");
 }
 
 /**
@@ -122,6 +130,17 @@ void ImportMDEventWorkspace::addEventsData(typename MDEventWorkspace<MDE, nd>::s
   }
 }
 
+/**
+Replaces the single box holding the imported events with boxes built from the
+Morton index of the events.
+@param ws: Workspace holding the events.
+*/
+template <typename MDE, size_t nd>
+void ImportMDEventWorkspace::buildBoxes(typename MDEventWorkspace<MDE, nd>::sptr ws) {
+  MDEventWorkspaceBuilder<MDE, nd> builder(*ws);
+  builder.build();
+}
+
 /**
 Iterate through the file data looking for the specified flag and returning TRUE
 if found.
@@ -275,6 +294,18 @@ void ImportMDEventWorkspace::exec() {
 
   CALL_MDEVENT_FUNCTION(this->addEventsData, outWs)
 
+  if (getPropertyValue("BoxBuilder") == "Indexed") {
+    // The file has no box settings: split into 2, as the Morton index needs
+    outWs->getBoxController()->setSplitInto(2);
+    if (canBuildFromMortonIndex(*outWs)) {
+      CALL_MDEVENT_FUNCTION(this->buildBoxes, outWs)
+    } else {
+      g_log.warning("The boxes cannot be built from the Morton index of the events with " +
+                    std::to_string(m_nDimensions) + " dimensions. Keeping all the events in one box.");
+      outWs->getBoxController()->setSplitInto(1);
+    }
+  }
+
   // set output
   this->setProperty("OutputWorkspace", outWs);
 }
@@ -0,0 +1,212 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidMDAlgorithms/MDBinningCache.h"
+#include "MantidAPI/IMDEventWorkspace.h"
+#include "MantidKernel/ConfigService.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Mantid::MDAlgorithms {
+
+namespace {
+/// Memory used by the cache if the BinMD.CacheMemoryMB property is not set
+constexpr int DEFAULT_MEMORY_MB{256};
+/// Tolerance, in bins, when matching the transforms of two histograms
+constexpr double TOLERANCE{1e-4};
+
+/// The cached bins summed into one bin of a cut, in one output dimension
+struct BinGrouping {
+  /// The cached bin where the cut starts
+  size_t offset;
+  /// The number of cached bins in each bin of the cut
+  size_t factor;
+};
+
+/// @return the nearest whole number to value if it is within the tolerance, or -1
+double wholeNumber(const double value, const double scale) {
+  const double rounded = std::round(value);
+  return std::abs(value - rounded) <= TOLERANCE * std::max(1.0, std::abs(scale)) ? rounded : -1.0;
+}
+
+/**
+ * Work out how the bins of a cut are made from the bins of a cached histogram
+ * @param cached :: transform from the workspace to the cached bins
+ * @param cachedBins :: number of cached bins in each output dimension
+ * @param cut :: transform from the workspace to the bins of the cut
+ * @param cutBins :: number of bins of the cut in each output dimension
+ * @return the grouping of cached bins in each output dimension, or nothing if the cut cannot be made from them
+ */
+std::vector<BinGrouping> groupBins(const Kernel::Matrix<coord_t> &cached, const std::vector<size_t> &cachedBins,
+                                   const Kernel::Matrix<coord_t> &cut, const std::vector<size_t> &cutBins) {
+  if (cached.numRows() != cut.numRows() || cached.numCols() != cut.numCols() || cachedBins.size() != cutBins.size() ||
+      cutBins.size() + 1 != cut.numRows())
+    return {};
+  const size_t inD = cut.numCols() - 1;
+  std::vector<BinGrouping> groups;
+  for (size_t out = 0; out < cutBins.size(); ++out) {
+    // each cached bin index is factor * (cut bin index) + offset
+    size_t largest = 0;
+    for (size_t in = 1; in < inD; ++in) {
+      if (std::abs(cut[out][in]) > std::abs(cut[out][largest]))
+        largest = in;
+    }
+    if (cut[out][largest] == 0)
+      return {};
+    const double factor = wholeNumber(cached[out][largest] / cut[out][largest], 1.0);
+    if (factor < 1.0)
+      return {};
+    for (size_t in = 0; in < inD; ++in) {
+      if (std::abs(cached[out][in] - factor * cut[out][in]) > TOLERANCE * std::abs(cached[out][largest]))
+        return {};
+    }
+    const double offset = wholeNumber(cached[out][inD] - factor * cut[out][inD], cached[out][inD]);
+    if (offset < 0.0)
+      return {};
+    const BinGrouping group{static_cast<size_t>(offset), static_cast<size_t>(factor)};
+    if (group.offset + group.factor * cutBins[out] > cachedBins[out])
+      return {};
+    groups.emplace_back(group);
+  }
+  return groups;
+}
+
+/// @return the number of bins of a histogram
+size_t totalBins(const std::vector<size_t> &numBins) {
+  size_t total = 1;
+  for (const auto bins : numBins)
+    total *= bins;
+  return total;
+}
+} // namespace
+
+/**
+ * Fill a histogram from a cached histogram of the workspace, if there is a suitable one
+ * @param ws :: the binned workspace
+ * @param transform :: affine transform from the coordinates of the workspace to bin indices
+ * @param numBins :: the number of bins in each output dimension
+ * @param signals :: set to the summed signal of each bin
+ * @param errorsSquared :: set to the summed squared error of each bin
+ * @param numEvents :: set to the number of events in each bin
+ * @return true if the histogram was filled
+ */
+bool MDBinningCacheImpl::fill(const API::IMDEventWorkspace &ws, const Kernel::Matrix<coord_t> &transform,
+                              const std::vector<size_t> &numBins, signal_t *signals, signal_t *errorsSquared,
+                              signal_t *numEvents) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  removeOutOfDate();
+  for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry) {
+    if (entry->workspace.lock().get() != &ws)
+      continue;
+    const auto groups = groupBins(entry->transform, entry->numBins, transform, numBins);
+    if (groups.empty())
+      continue;
+
+    const size_t outD = numBins.size();
+    std::vector<size_t> cachedStrides(outD, 1), cutStrides(outD, 1);
+    for (size_t d = 1; d < outD; ++d) {
+      cachedStrides[d] = cachedStrides[d - 1] * entry->numBins[d - 1];
+      cutStrides[d] = cutStrides[d - 1] * numBins[d - 1];
+    }
+    const size_t numCutBins = totalBins(numBins);
+    std::fill(signals, signals + numCutBins, 0.0);
+    std::fill(errorsSquared, errorsSquared + numCutBins, 0.0);
+    std::fill(numEvents, numEvents + numCutBins, 0.0);
+    // step through the cached bins inside the cut, in the order they are stored
+    std::vector<size_t> index(outD, 0);
+    size_t numCachedBins = numCutBins;
+    for (const auto &group : groups)
+      numCachedBins *= group.factor;
+    for (size_t i = 0; i < numCachedBins; ++i) {
+      size_t cachedIndex = 0, cutIndex = 0;
+      for (size_t d = 0; d < outD; ++d) {
+        cachedIndex += (groups[d].offset + index[d]) * cachedStrides[d];
+        cutIndex += (index[d] / groups[d].factor) * cutStrides[d];
+      }
+      signals[cutIndex] += entry->signals[cachedIndex];
+      errorsSquared[cutIndex] += entry->errorsSquared[cachedIndex];
+      numEvents[cutIndex] += entry->numEvents[cachedIndex];
+      for (size_t d = 0; d < outD; ++d) {
+        if (++index[d] < groups[d].factor * numBins[d])
+          break;
+        index[d] = 0;
+      }
+    }
+    m_entries.splice(m_entries.begin(), m_entries, entry);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Cache a histogram binned from a workspace. It is not kept if it is larger than the memory allowed for the cache.
+ * @param ws :: the binned workspace
+ * @param transform :: affine transform from the coordinates of the workspace to bin indices
+ * @param numBins :: the number of bins in each output dimension
+ * @param signals :: the summed signal of each bin
+ * @param errorsSquared :: the summed squared error of each bin
+ * @param numEvents :: the number of events in each bin
+ */
+void MDBinningCacheImpl::store(const std::shared_ptr<const API::IMDEventWorkspace> &ws,
+                               const Kernel::Matrix<coord_t> &transform, const std::vector<size_t> &numBins,
+                               const signal_t *signals, const signal_t *errorsSquared, const signal_t *numEvents) {
+  const auto maxMemoryMB =
+      Kernel::ConfigService::Instance().getValue<int>("BinMD.CacheMemoryMB").value_or(DEFAULT_MEMORY_MB);
+  const auto maxMemory = static_cast<size_t>(std::max(maxMemoryMB, 0)) * 1024 * 1024;
+  const size_t numCachedBins = totalBins(numBins);
+  const size_t memory = 3 * numCachedBins * sizeof(signal_t);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  removeOutOfDate();
+  // a histogram with the same bins replaces the old one
+  m_entries.remove_if([&ws, &transform, &numBins](const Entry &entry) {
+    return entry.workspace.lock() == ws && entry.numBins == numBins && entry.transform.equals(transform, 0);
+  });
+  if (memory > maxMemory)
+    return;
+  while (!m_entries.empty() && memoryUsed() + memory > maxMemory)
+    m_entries.pop_back();
+  m_entries.emplace_front(Entry{ws, ws->getModificationCount(), transform, numBins,
+                                std::vector<signal_t>(signals, signals + numCachedBins),
+                                std::vector<signal_t>(errorsSquared, errorsSquared + numCachedBins),
+                                std::vector<signal_t>(numEvents, numEvents + numCachedBins)});
+}
+
+/// Remove all the cached histograms
+void MDBinningCacheImpl::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+size_t MDBinningCacheImpl::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// @return the memory used by the cached histograms, in bytes
+size_t MDBinningCacheImpl::getMemorySize() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return memoryUsed();
+}
+
+/// Remove the histograms of workspaces which have been deleted or changed since they were binned
+void MDBinningCacheImpl::removeOutOfDate() {
+  m_entries.remove_if([](const Entry &entry) {
+    const auto ws = entry.workspace.lock();
+    return !ws || ws->getModificationCount() != entry.modificationCount;
+  });
+}
+
+/// @return the memory used by the cached histograms, in bytes. The mutex must be locked.
+size_t MDBinningCacheImpl::memoryUsed() const {
+  size_t memory = 0;
+  for (const auto &entry : m_entries)
+    memory += 3 * entry.signals.size() * sizeof(signal_t);
+  return memory;
+}
+
+} // namespace Mantid::MDAlgorithms
@@ -1383,12 +1383,13 @@ inline void MDNorm::calcDiffractionIntersectionIntegral(std::vector<std::array<d
  * @param signalArray: (output) normalization
  * @param solidBkgd: background proton charge
  * @param bkgdSignalArray: (output) background normalization
+ * @param thread: number of the calling thread
  */
 inline void MDNorm::calcSingleDetectorNorm(const std::vector<std::array<double, 4>> &intersections, const double &solid,
                                            std::vector<double> &yValues, const size_t &vmdDims,
                                            std::vector<coord_t> &pos, std::vector<coord_t> &posNew,
-                                           std::vector<std::atomic<signal_t>> &signalArray, const double &solidBkgd,
-                                           std::vector<std::atomic<signal_t>> &bkgdSignalArray) {
+                                           SignalAccumulator &signalArray, const double &solidBkgd,
+                                           SignalAccumulator &bkgdSignalArray, const size_t thread) {
 
   auto intersectionsBegin = intersections.begin();
   for (auto it = intersectionsBegin + 1; it != intersections.end(); ++it) {
@@ -1447,10 +1448,10 @@ inline void MDNorm::calcSingleDetectorNorm(const std::vector<std::array<double,
 
     // Set to output
     // set the calculated signal to
-    Mantid::Kernel::AtomicOp(signalArray[linIndex], signal, std::plus<signal_t>());
+    signalArray.add(thread, linIndex, signal);
     // [Task 89]
     if (m_backgroundWS)
-      Mantid::Kernel::AtomicOp(bkgdSignalArray[linIndex], bkgdSignal, std::plus<signal_t>());
+      bkgdSignalArray.add(thread, linIndex, bkgdSignal);
   }
   return;
 }
@@ -1497,15 +1498,19 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, con
   const detid2index_map fluxDetToIdx =
       (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap() : detid2index_map();
 
-  // Define dimension, signal array
+  // muliple threading
+  bool safe = m_diffraction ? Kernel::threadSafe(*integrFlux) : true;
+  const auto numThreads = static_cast<size_t>(safe ? PARALLEL_GET_MAX_THREADS : 1);
+
+  // Define dimension, signal array. Each thread accumulates separately to avoid contention.
   const size_t vmdDims = (m_diffraction) ? 3 : 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
+  SignalAccumulator signalArray(m_normWS->getNPoints(), numThreads);
 
   size_t numNPoints = (m_backgroundWS) ? m_bkgdNormWS->getNPoints() : 0;
   if (m_backgroundWS && numNPoints != m_normWS->getNPoints()) {
     throw std::runtime_error("N points are different");
   }
-  std::vector<std::atomic<signal_t>> bkgdSignalArray(numNPoints);
+  SignalAccumulator bkgdSignalArray(numNPoints, numThreads);
 
   std::vector<std::array<double, 4>> intersections;
   std::vector<double> xValues, yValues;
@@ -1516,10 +1521,9 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, con
   auto progIndex = static_cast<double>(soIndex + expInfoIndex * m_numSymmOps);
   auto prog =
       std::make_unique<API::Progress>(this, 0.3 + progStep * progIndex, 0.3 + progStep * (1. + progIndex), ndets);
-  // muliple threading
-  bool safe = m_diffraction ? Kernel::threadSafe(*integrFlux) : true;
 
-PRAGMA_OMP(parallel for private(intersections, xValues, yValues, pos, posNew) if (safe))
+// a static schedule gives each thread the same detectors every time so the sums are reproducible
+PRAGMA_OMP(parallel for schedule(static) private(intersections, xValues, yValues, pos, posNew) if (safe))
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERRUPT_REGION
 
@@ -1574,30 +1578,25 @@ for (int64_t i = 0; i < ndets; i++) {
   pos.resize(vmdDims + otherValues.size());
   std::copy(otherValues.begin(), otherValues.end(), pos.begin() + vmdDims);
 
-  calcSingleDetectorNorm(intersections, solid, yValues, vmdDims, pos, posNew, signalArray, bkgdSolid,
-                         bkgdSignalArray); // [Task 89] ADD solidBkgd, bkgdYValues, bkgdSignalArray
+  calcSingleDetectorNorm(intersections, solid, yValues, vmdDims, pos, posNew, signalArray, bkgdSolid, bkgdSignalArray,
+                         static_cast<size_t>(PARALLEL_THREAD_NUMBER)); // [Task 89] ADD solidBkgd, bkgdSignalArray
 
   prog->report();
 
   PARALLEL_END_INTERRUPT_REGION
 }
 PARALLEL_CHECK_INTERRUPT_REGION
-if (m_accumulate) {
-  std::transform(signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(), m_normWS->mutableSignalArray(),
-                 [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-  // [Task 89] Process background
-  if (m_backgroundWS)
-    std::transform(bkgdSignalArray.cbegin(), bkgdSignalArray.cend(), m_bkgdNormWS->getSignalArray(),
-                   m_bkgdNormWS->mutableSignalArray(),
-                   [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-
-} else {
+if (!m_accumulate) {
   // First time, init
-  std::copy(signalArray.cbegin(), signalArray.cend(), m_normWS->mutableSignalArray());
+  std::fill_n(m_normWS->mutableSignalArray(), m_normWS->getNPoints(), 0.);
   // [Task 89]
   if (m_backgroundWS)
-    std::copy(bkgdSignalArray.cbegin(), bkgdSignalArray.cend(), m_bkgdNormWS->mutableSignalArray());
+    std::fill_n(m_bkgdNormWS->mutableSignalArray(), numNPoints, 0.);
 }
+signalArray.addTo(m_normWS->mutableSignalArray());
+// [Task 89] Process background
+if (m_backgroundWS)
+  bkgdSignalArray.addTo(m_bkgdNormWS->mutableSignalArray());
 m_accumulate = true;
 }
 
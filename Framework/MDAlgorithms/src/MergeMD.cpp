@@ -10,8 +10,10 @@
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MandatoryValidator.h"
 #include "MantidKernel/Strings.h"
+#include "MantidMDAlgorithms/MDEventWorkspaceBuilder.h"
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -46,6 +48,14 @@ void MergeMD::init() {
 
   // Set the box controller properties
   this->initBoxControllerProps("2", 500, 16);
+
+  declareProperty("BoxBuilder", "Default",
+                  std::make_shared<StringListValidator>(std::vector<std::string>{"Default", "Indexed"}),
+                  "How the boxes of the output are made. Indexed sorts all the events by their Morton index and "
+                  "builds the boxes in one pass, which is faster for many events but rounds their coordinates to "
+                  "the resolution of the index. It needs 2 to 4 dimensions and SplitInto to be the same power of 2 "
+                  "for all of them, otherwise the Default is used.");
+  setPropertyGroup("BoxBuilder", getBoxSettingsGroupName());
 }
 
 /** Create the output MDWorkspace from a list of input
@@ -256,6 +266,63 @@ template <typename MDE, size_t nd> void MergeMD::doPlus(typename MDEventWorkspac
 }
 
 //----------------------------------------------------------------------------------------------
+/** Merge all the input workspaces at once, building the boxes of the output
+ * from the Morton index of the events.
+ *
+ * @param outWS :: the output workspace
+ */
+template <typename MDE, size_t nd> void MergeMD::mergeIndexed(typename MDEventWorkspace<MDE, nd>::sptr outWS) {
+  MDEventWorkspaceBuilder<MDE, nd> builder(*outWS);
+  size_t numEvents = 0;
+  for (const auto &ws : m_workspaces)
+    numEvents += ws->getNPoints();
+  builder.reserve(numEvents);
+
+  const double progStep = 0.9 / double(m_workspaces.size());
+  for (size_t i = 0; i < m_workspaces.size(); i++) {
+    auto ws = std::dynamic_pointer_cast<MDEventWorkspace<MDE, nd>>(m_workspaces[i]);
+    if (!ws)
+      throw std::runtime_error("Incompatible workspace types passed to MergeMD.");
+    g_log.information() << "Adding workspace " << ws->getName() << '\n';
+    progress(double(i) * progStep, ws->getName());
+
+    const uint16_t expInfoIndexOffset = experimentInfoNo.back();
+    experimentInfoNo.pop_back();
+
+    std::vector<API::IMDNode *> boxes;
+    ws->getBox()->getBoxes(boxes, 1000, true);
+    const auto numBoxes = int(boxes.size());
+    const bool fileBasedSource = ws->isFileBacked();
+
+    PRAGMA_OMP( parallel for if (!fileBasedSource) )
+    for (int j = 0; j < numBoxes; j++) {
+      PARALLEL_START_INTERRUPT_REGION
+      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[j]);
+      if (box && !box->getIsMasked()) {
+        const std::vector<MDE> &events = box->getConstEvents();
+        std::vector<MDE> newEvents;
+        newEvents.reserve(events.size());
+        for (const auto &event : events) {
+          MDE newEvent(event.getSignal(), event.getErrorSquared(), event.getCenter());
+          copyEvent(event, newEvent, expInfoIndexOffset);
+          newEvents.emplace_back(newEvent);
+        }
+        builder.addEvents(std::move(newEvents));
+        if (fileBasedSource)
+          box->clear();
+        else
+          box->releaseEvents();
+      }
+      PARALLEL_END_INTERRUPT_REGION
+    }
+    PARALLEL_CHECK_INTERRUPT_REGION
+  }
+
+  this->progress(0.9, "Building boxes");
+  builder.build();
+  outWS->setFileNeedsUpdating(true);
+}
+
 /** Execute the algorithm.
  */
 void MergeMD::exec() {
@@ -284,12 +351,23 @@ void MergeMD::exec() {
   // Create a blank output workspace
   this->createOutputWorkspace(inputs);
 
-  // Run PlusMD on each of the input workspaces, in order.
-  double progStep = 1.0 / double(m_workspaces.size());
-  for (size_t i = 0; i < m_workspaces.size(); i++) {
-    g_log.information() << "Adding workspace " << m_workspaces[i]->getName() << '\n';
-    progress(double(i) * progStep, m_workspaces[i]->getName());
-    CALL_MDEVENT_FUNCTION(doPlus, m_workspaces[i]);
+  bool indexed = getPropertyValue("BoxBuilder") == "Indexed";
+  if (indexed && !canBuildFromMortonIndex(*out)) {
+    g_log.warning("The boxes cannot be built from the Morton index of the events with these dimensions and "
+                  "SplitInto. Using the Default box builder.");
+    indexed = false;
+  }
+
+  if (indexed) {
+    CALL_MDEVENT_FUNCTION(mergeIndexed, out);
+  } else {
+    // Run PlusMD on each of the input workspaces, in order.
+    double progStep = 1.0 / double(m_workspaces.size());
+    for (size_t i = 0; i < m_workspaces.size(); i++) {
+      g_log.information() << "Adding workspace " << m_workspaces[i]->getName() << '\n';
+      progress(double(i) * progStep, m_workspaces[i]->getName());
+      CALL_MDEVENT_FUNCTION(doPlus, m_workspaces[i]);
+    }
   }
 
   this->progress(0.95, "Refreshing cache");
@@ -0,0 +1,83 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidMDAlgorithms/SignalAccumulator.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+
+namespace Mantid::MDAlgorithms {
+
+namespace {
+/// Only use per-thread histograms if they fit in this fraction of the available memory
+constexpr size_t DENSE_MEMORY_FRACTION{4};
+} // namespace
+
+/**
+ * Choose the strategy from the memory that per-thread histograms would need
+ * @param numBins :: number of bins in the histogram
+ * @param numThreads :: number of threads that will add contributions
+ * @param availableMemory :: available memory in bytes
+ * @returns DENSE if a histogram per thread fits in a quarter of the available memory, SPARSE otherwise
+ */
+SignalAccumulator::Strategy SignalAccumulator::chooseStrategy(const size_t numBins, const size_t numThreads,
+                                                              const size_t availableMemory) {
+  // a single thread only ever needs one histogram, the same as accumulating in place
+  if (numThreads <= 1)
+    return Strategy::DENSE;
+  const size_t denseMemory = numBins * numThreads * sizeof(signal_t);
+  return (denseMemory <= availableMemory / DENSE_MEMORY_FRACTION) ? Strategy::DENSE : Strategy::SPARSE;
+}
+
+/**
+ * Constructor choosing the strategy from the currently available memory
+ * @param numBins :: number of bins in the histogram
+ * @param numThreads :: number of threads that will add contributions
+ */
+SignalAccumulator::SignalAccumulator(const size_t numBins, const size_t numThreads)
+    : SignalAccumulator(numBins, numThreads,
+                        chooseStrategy(numBins, numThreads, Kernel::MemoryStats().availMem() * 1024)) {}
+
+/**
+ * Constructor
+ * @param numBins :: number of bins in the histogram
+ * @param numThreads :: number of threads that will add contributions
+ * @param strategy :: how each thread stores its contributions
+ */
+SignalAccumulator::SignalAccumulator(const size_t numBins, const size_t numThreads, const Strategy strategy)
+    : m_numBins(numBins), m_numThreads(std::max<size_t>(numThreads, 1)), m_strategy(strategy) {
+  if (m_strategy == Strategy::DENSE)
+    m_dense.resize(m_numThreads);
+  else
+    m_sparse.resize(m_numThreads);
+}
+
+/**
+ * Add the accumulated contributions of all threads to output. Each bin has the threads added in thread order so the
+ * result does not depend on how the work was scheduled.
+ * @param output :: array of at least numBins() values to add to
+ */
+void SignalAccumulator::addTo(signal_t *output) const {
+  if (m_strategy == Strategy::DENSE) {
+    const auto numBins = static_cast<int64_t>(m_numBins);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < numBins; ++i) {
+      for (const auto &buffer : m_dense) {
+        if (!buffer.empty())
+          output[i] += buffer[i];
+      }
+    }
+  } else {
+    // the order of iterating through a map does not matter as each bin is only added to once per thread
+    for (const auto &buffer : m_sparse) {
+      for (const auto &[index, value] : buffer)
+        output[index] += value;
+    }
+  }
+}
+
+} // namespace Mantid::MDAlgorithms
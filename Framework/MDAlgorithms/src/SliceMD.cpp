@@ -14,6 +14,7 @@
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadScheduler.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -219,7 +220,7 @@ void SliceMD::slice(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       // if (numSinceSplit > 20000000 || (i == int(boxes.size()-1)))
       {
         // This splits up all the boxes according to split thresholds and sizes.
-        Kernel::ThreadScheduler *ts = new ThreadSchedulerFIFO();
+        Kernel::ThreadScheduler *ts = new ThreadSchedulerWorkStealing();
         ThreadPool tp(ts);
         outWS->splitAllIfNeeded(ts);
         tp.joinAll();
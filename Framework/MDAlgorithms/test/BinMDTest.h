@@ -23,6 +23,7 @@
 #include "MantidMDAlgorithms/CreateMDWorkspace.h"
 #include "MantidMDAlgorithms/FakeMDEventData.h"
 #include "MantidMDAlgorithms/LoadMD.h"
+#include "MantidMDAlgorithms/MDBinningCache.h"
 #include "MantidMDAlgorithms/SaveMD2.h"
 
 #include <cmath>
@@ -892,6 +893,153 @@ public:
     TSM_ASSERT("All basis vectors should have been normalized", binned->allBasisNormalized());
   }
 
+  void test_columnar_events_give_the_same_histogram_aligned() { do_test_columnar_events(true); }
+
+  void test_columnar_events_give_the_same_histogram_non_aligned() { do_test_columnar_events(false); }
+
+  void test_columnar_events_are_saved_and_loaded() {
+    auto in_ws = MDEventsTestHelper::makeMDEW<3>(5, 0.0, 10.0, 1);
+    in_ws->getBoxController()->setColumnarEvents(true);
+    const auto filename = saveWorkspace(in_ws);
+
+    LoadMD loader;
+    loader.setChild(true);
+    loader.initialize();
+    loader.setPropertyValue("Filename", filename);
+    loader.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+    IMDEventWorkspace_sptr loaded = loader.getProperty("OutputWorkspace");
+    TS_ASSERT(loaded->getBoxController()->useColumnarEvents());
+    Poco::File(filename).remove();
+  }
+
+  void do_test_columnar_events(const bool aligned) {
+    auto in_ws = createFakeData();
+
+    const auto expected = binFakeData(in_ws, aligned);
+    in_ws->getBoxController()->setColumnarEvents(true);
+    const auto columnar = binFakeData(in_ws, aligned);
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+
+    TS_ASSERT_EQUALS(columnar->getNPoints(), expected->getNPoints());
+    double total(0.);
+    for (size_t i = 0; i < expected->getNPoints(); ++i) {
+      TS_ASSERT_EQUALS(columnar->getNumEventsAt(i), expected->getNumEventsAt(i));
+      TS_ASSERT_DELTA(columnar->getSignalAt(i), expected->getSignalAt(i), 1e-10);
+      TS_ASSERT_DELTA(columnar->getErrorAt(i), expected->getErrorAt(i), 1e-10);
+      total += expected->getNumEventsAt(i);
+    }
+    // the region does not include all the events
+    TS_ASSERT_LESS_THAN(0., total);
+    TS_ASSERT_LESS_THAN(total, 20000.);
+  }
+
+  void test_parallel_binning_gives_the_same_histogram() {
+    auto in_ws = createFakeData();
+    const auto expected = binFakeData(in_ws, false);
+    const auto parallel = binFakeData(in_ws, false, true);
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+    compareHistograms(parallel, expected);
+  }
+
+  void test_parallel_binning_of_file_backed_workspace() {
+    auto in_ws = createFakeData();
+    const auto expected = binFakeData(in_ws, true);
+    const auto filename = saveWorkspace(in_ws);
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+
+    const auto fileBackedName = loadFileBackWorkspace(filename);
+    auto fileBacked = AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>(fileBackedName);
+    TS_ASSERT(fileBacked->isFileBacked());
+    const auto parallel = binFakeData(fileBacked, true, true);
+    const auto serial = binFakeData(fileBacked, true);
+    fileBacked.reset();
+    AnalysisDataService::Instance().remove(fileBackedName);
+    Poco::File(filename).remove();
+
+    compareHistograms(parallel, expected);
+    compareHistograms(serial, expected);
+  }
+
+  void test_cut_from_cached_bins_matches_binning_the_events() {
+    MDBinningCache::Instance().clear();
+    auto in_ws = createFakeData();
+    binAligned(in_ws, {"Axis0,2.0,8.0, 12", "Axis1,1.0,9.0, 8", "Axis2,0.5,7.5, 7"}, true);
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().size(), 1);
+
+    // two, two and seven of the cached bins in each bin
+    const std::vector<std::string> coarse{"Axis0,2.0,8.0, 6", "Axis1,3.0,7.0, 2", "Axis2,0.5,7.5, 1"};
+    compareHistograms(binAligned(in_ws, coarse, true), binAligned(in_ws, coarse, false));
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().size(), 1);
+
+    // adding events invalidates the cached bins
+    FrameworkManager::Instance().exec("FakeMDEventData", 4, "InputWorkspace", "BinMDTest_ws", "UniformParams", "1000");
+    compareHistograms(binAligned(in_ws, coarse, true), binAligned(in_ws, coarse, false));
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+    MDBinningCache::Instance().clear();
+  }
+
+  MDHistoWorkspace_sptr binAligned(const IMDEventWorkspace_sptr &in_ws, const std::vector<std::string> &dimensions,
+                                   const bool useCache) {
+    BinMD alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", in_ws);
+    for (size_t i = 0; i < dimensions.size(); ++i)
+      alg.setPropertyValue("AlignedDim" + std::to_string(i), dimensions[i]);
+    alg.setProperty("UseCache", useCache);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    return alg.getProperty("OutputWorkspace");
+  }
+
+  /// Uniform fake events in boxes split down to 100 events
+  IMDEventWorkspace_sptr createFakeData() {
+    auto in_ws = MDEventsTestHelper::makeMDEW<3>(10, 0.0, 10.0, 0);
+    in_ws->getBoxController()->setSplitThreshold(100);
+    in_ws->splitAllIfNeeded(nullptr);
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", in_ws);
+    FrameworkManager::Instance().exec("FakeMDEventData", 4, "InputWorkspace", "BinMDTest_ws", "UniformParams", "20000");
+    return in_ws;
+  }
+
+  void compareHistograms(const MDHistoWorkspace_sptr &actual, const MDHistoWorkspace_sptr &expected) {
+    TS_ASSERT_EQUALS(actual->getNPoints(), expected->getNPoints());
+    double total(0.);
+    for (size_t i = 0; i < expected->getNPoints(); ++i) {
+      TS_ASSERT_EQUALS(actual->getNumEventsAt(i), expected->getNumEventsAt(i));
+      TS_ASSERT_DELTA(actual->getSignalAt(i), expected->getSignalAt(i), 1e-10);
+      TS_ASSERT_DELTA(actual->getErrorAt(i), expected->getErrorAt(i), 1e-10);
+      total += expected->getNumEventsAt(i);
+    }
+    TS_ASSERT_LESS_THAN(0., total);
+  }
+
+  MDHistoWorkspace_sptr binFakeData(const IMDEventWorkspace_sptr &in_ws, const bool aligned,
+                                    const bool parallel = false) {
+    BinMD alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", in_ws);
+    alg.setProperty("Parallel", parallel);
+    if (aligned) {
+      alg.setPropertyValue("AlignedDim0", "Axis0,2.0,8.0, 12");
+      alg.setPropertyValue("AlignedDim1", "Axis1,1.0,9.0, 8");
+      alg.setPropertyValue("AlignedDim2", "Axis2,0.5,7.5, 7");
+    } else {
+      alg.setProperty("AxisAligned", false);
+      alg.setPropertyValue("BasisVector0", "OutX,m,0.8,0.6,0");
+      alg.setPropertyValue("BasisVector1", "OutY,m,-0.6,0.8,0");
+      alg.setPropertyValue("BasisVector2", "OutZ,m,0,0,1");
+      alg.setPropertyValue("Translation", "1,1,1");
+      alg.setPropertyValue("OutputExtents", "0,6, -3,3, 0,8");
+      alg.setProperty("OutputBins", std::vector<int>{12, 6, 8});
+    }
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    return alg.getProperty("OutputWorkspace");
+  }
+
   void test_filebackend_and_unrecognised_instrument() {
     // The algorithm should still successfully execute, even if the workspace is
     // file-backed and the named instrument doesn't exist
@@ -1002,7 +1150,7 @@ public:
 
   ~BinMDTestPerformance() override { AnalysisDataService::Instance().remove("BinMDTest_ws"); }
 
-  void do_test(const std::string &binParams, bool IterateEvents) {
+  void do_test(const std::string &binParams, bool IterateEvents, const bool parallel = false) {
     BinMD alg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize())
     TS_ASSERT(alg.isInitialized())
@@ -1012,6 +1160,7 @@ public:
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AlignedDim2", "Axis2," + binParams));
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AlignedDim3", ""));
     TS_ASSERT_THROWS_NOTHING(alg.setProperty("IterateEvents", IterateEvents));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("Parallel", parallel));
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "BinMDTest_ws_histo"));
     TS_ASSERT_THROWS_NOTHING(alg.execute();)
     TS_ASSERT(alg.isExecuted());
@@ -1031,4 +1180,35 @@ public:
     for (size_t i = 0; i < 1; i++)
       do_test("2.0,8.0, 1", true);
   }
+
+  void test_3D_60cube_IterateEvents_parallel() { do_test("2.0,8.0, 60", true, true); }
+
+  void test_3D_tinyRegion_60cube_IterateEvents_parallel() { do_test("5.3,5.4, 60", true, true); }
+
+  void test_3D_60cube_IterateEvents_columnar() {
+    in_ws->getBoxController()->setColumnarEvents(true);
+    do_test("2.0,8.0, 60", true);
+    in_ws->getBoxController()->setColumnarEvents(false);
+  }
+
+  void test_3D_60cube_IterateEvents_non_aligned() { do_test_non_aligned(false); }
+
+  void test_3D_60cube_IterateEvents_non_aligned_columnar() { do_test_non_aligned(true); }
+
+  void do_test_non_aligned(const bool columnar) {
+    in_ws->getBoxController()->setColumnarEvents(columnar);
+    BinMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("InputWorkspace", "BinMDTest_ws"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("AxisAligned", false));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("BasisVector0", "OutX,m,0.8,0.6,0"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("BasisVector1", "OutY,m,-0.6,0.8,0"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("BasisVector2", "OutZ,m,0,0,1"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputExtents", "0,10, -5,5, 0,10"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("OutputBins", std::vector<int>{60, 60, 60}));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "BinMDTest_ws_histo"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute();)
+    TS_ASSERT(alg.isExecuted());
+    in_ws->getBoxController()->setColumnarEvents(false);
+  }
 };
@@ -54,6 +54,56 @@ public:
     AnalysisDataService::Instance().remove("FakeMDEventDataTest_ws");
   }
 
+  void test_exec_indexed() {
+    FakeMDEventData alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+
+    // 8 boxes with 1 event each
+    MDEventWorkspace3Lean::sptr in_ws = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0, 1);
+    AnalysisDataService::Instance().addOrReplace("FakeMDEventDataTest_ws", in_ws);
+
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("InputWorkspace", "FakeMDEventDataTest_ws"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("PeakParams", "1000, 5.0,5.0,5.0, 1.0"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("UniformParams", "10000"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("BoxBuilder", "Indexed"));
+
+    TS_ASSERT_THROWS_NOTHING(alg.execute();)
+    TS_ASSERT(alg.isExecuted());
+
+    TS_ASSERT_EQUALS(in_ws->getNPoints(), 11008);
+    TS_ASSERT_DELTA(in_ws->getBox()->getSignal(), 11008.0, 1e-3);
+    // the boxes were split until they are under the threshold
+    std::vector<IMDNode *> boxes;
+    in_ws->getBox()->getBoxes(boxes, 1000, true);
+    TS_ASSERT(boxes.size() > 8);
+    const auto bc = in_ws->getBoxController();
+    for (const auto *box : boxes) {
+      if (box->getDepth() < bc->getMaxDepth())
+        TS_ASSERT_LESS_THAN_EQUALS(box->getNPoints(), bc->getSplitThreshold());
+    }
+
+    AnalysisDataService::Instance().remove("FakeMDEventDataTest_ws");
+  }
+
+  void test_exec_indexed_falls_back_to_default_if_the_split_is_not_a_power_of_2() {
+    FakeMDEventData alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+
+    IMDEventWorkspace_sptr in_ws = MDEventsTestHelper::makeMDEW<3>(10, 0.0, 10.0, 1);
+    AnalysisDataService::Instance().addOrReplace("FakeMDEventDataTest_ws", in_ws);
+
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("InputWorkspace", "FakeMDEventDataTest_ws"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("UniformParams", "10000"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("BoxBuilder", "Indexed"));
+
+    TS_ASSERT_THROWS_NOTHING(alg.execute();)
+    TS_ASSERT(alg.isExecuted());
+    TS_ASSERT_EQUALS(in_ws->getNPoints(), 11000);
+
+    AnalysisDataService::Instance().remove("FakeMDEventDataTest_ws");
+  }
+
   void test_exec_randomizeSignal() {
     FakeMDEventData alg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize())
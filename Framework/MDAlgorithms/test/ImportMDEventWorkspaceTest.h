@@ -307,6 +307,59 @@ public:
     TS_ASSERT_EQUALS("MDEvent", outWS->getEventTypeName());
   }
 
+  void test_load_indexed_splits_boxes() {
+    FileContentsBuilder fileContents;
+    std::string mdData;
+    for (size_t i = 0; i < 3000; ++i) {
+      std::stringstream stream;
+      stream << "1 1 " << static_cast<double>(i % 100) << " " << static_cast<double>(i / 100) << "\n";
+      mdData += stream.str();
+    }
+    fileContents.setMDEventEntries(mdData);
+    MDFileObject infile(fileContents);
+
+    ImportMDEventWorkspace alg;
+    alg.initialize();
+    alg.setPropertyValue("Filename", infile.getFileName());
+    alg.setPropertyValue("OutputWorkspace", "test_out");
+    alg.setPropertyValue("BoxBuilder", "Indexed");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    IMDEventWorkspace_sptr outWS = AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("test_out");
+    TS_ASSERT_EQUALS(3000, outWS->getNPoints());
+    TS_ASSERT_EQUALS("MDLeanEvent", outWS->getEventTypeName());
+    std::vector<IMDNode *> boxes;
+    outWS->getBoxes(boxes, 1000, true);
+    TS_ASSERT(boxes.size() > 1);
+    size_t numEvents = 0;
+    for (const auto *box : boxes) {
+      TS_ASSERT_LESS_THAN_EQUALS(box->getNPoints(), 1024);
+      numEvents += box->getNPoints();
+    }
+    TS_ASSERT_EQUALS(3000, numEvents);
+  }
+
+  void test_load_indexed_keeps_one_box_in_1d() {
+    FileContentsBuilder fileContents;
+    fileContents.setDimensionEntries("a A U 10");
+    fileContents.setMDEventEntries("1 1 -1\n1 1 2\n1 1 3");
+    MDFileObject infile(fileContents);
+
+    ImportMDEventWorkspace alg;
+    alg.initialize();
+    alg.setPropertyValue("Filename", infile.getFileName());
+    alg.setPropertyValue("OutputWorkspace", "test_out");
+    alg.setPropertyValue("BoxBuilder", "Indexed");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    IMDEventWorkspace_sptr outWS = AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("test_out");
+    TS_ASSERT_EQUALS(1, outWS->getNumDims());
+    TS_ASSERT_EQUALS(3, outWS->getNPoints());
+    TS_ASSERT_EQUALS(1, outWS->getBoxController()->getSplitInto(0));
+  }
+
   void test_ignore_comment_lines() {
     // Setup the basic file.
     FileContentsBuilder fileContents;
@@ -376,4 +429,17 @@ public:
     TS_ASSERT_EQUALS(nRows, outWS->getNPoints());
     TS_ASSERT_EQUALS("MDEvent", outWS->getEventTypeName());
   }
+
+  void testReadIndexed() {
+    ImportMDEventWorkspace alg;
+    alg.initialize();
+    alg.setPropertyValue("Filename", infile->getFileName());
+    alg.setPropertyValue("OutputWorkspace", "test_out");
+    alg.setPropertyValue("BoxBuilder", "Indexed");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    IMDEventWorkspace_sptr outWS = AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("test_out");
+    TS_ASSERT_EQUALS(nRows, outWS->getNPoints());
+  }
 };
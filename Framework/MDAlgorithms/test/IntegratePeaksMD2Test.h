@@ -1291,6 +1291,15 @@ public:
     }
   }
 
+  void test_performance_NoBackground_columnar() {
+    auto mdews = AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("IntegratePeaksMD2Test_MDEWS");
+    mdews->getBoxController()->setColumnarEvents(true);
+    for (size_t i = 0; i < 10; i++) {
+      IntegratePeaksMD2Test::doRun({0.02}, {0.0});
+    }
+    mdews->getBoxController()->setColumnarEvents(false);
+  }
+
   void test_performance_WithBackground() {
     for (size_t i = 0; i < 10; i++) {
       IntegratePeaksMD2Test::doRun({0.02}, {0.03});
@@ -0,0 +1,193 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidMDAlgorithms/MDBinningCache.h"
+
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid;
+using namespace Mantid::DataObjects;
+using namespace Mantid::MDAlgorithms;
+using Mantid::Kernel::Matrix;
+
+class MDBinningCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDBinningCacheTest *createSuite() { return new MDBinningCacheTest(); }
+  static void destroySuite(MDBinningCacheTest *suite) { delete suite; }
+
+  MDBinningCacheTest() : m_fineBins{10, 20}, m_fineSignals(200), m_fineErrors(200), m_fineEvents(200) {
+    for (size_t i = 0; i < m_fineSignals.size(); ++i) {
+      m_fineSignals[i] = static_cast<double>(i);
+      m_fineErrors[i] = 0.5 * static_cast<double>(i);
+      m_fineEvents[i] = static_cast<double>(i % 7);
+    }
+  }
+
+  void setUp() override {
+    MDBinningCache::Instance().clear();
+    m_ws = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0, 1);
+  }
+
+  void tearDown() override { MDBinningCache::Instance().clear(); }
+
+  void test_cut_with_grouped_bins_is_filled() {
+    storeFineBins();
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().size(), 1);
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().getMemorySize(), 3 * 200 * sizeof(signal_t));
+
+    // two fine bins in each coarse bin, starting at the fifth fine bin in the second dimension
+    const auto coarse = makeTransform(1.f, 0.f, 2.f, 4.f);
+    const std::vector<size_t> coarseBins{5, 8};
+    std::vector<signal_t> signals(40, -1.), errors(40, -1.), events(40, -1.);
+    TS_ASSERT(MDBinningCache::Instance().fill(*m_ws, coarse, coarseBins, signals.data(), errors.data(),
+                                              events.data()));
+
+    for (size_t j = 0; j < 8; ++j) {
+      for (size_t i = 0; i < 5; ++i) {
+        double signal(0.), error(0.), numEvents(0.);
+        for (size_t fj = 4 + 2 * j; fj < 6 + 2 * j; ++fj) {
+          for (size_t fi = 2 * i; fi < 2 * i + 2; ++fi) {
+            signal += m_fineSignals[fi + 10 * fj];
+            error += m_fineErrors[fi + 10 * fj];
+            numEvents += m_fineEvents[fi + 10 * fj];
+          }
+        }
+        TS_ASSERT_EQUALS(signals[i + 5 * j], signal);
+        TS_ASSERT_EQUALS(errors[i + 5 * j], error);
+        TS_ASSERT_EQUALS(events[i + 5 * j], numEvents);
+      }
+    }
+  }
+
+  void test_cut_with_the_same_bins_is_filled() {
+    storeFineBins();
+    std::vector<signal_t> signals(200), errors(200), events(200);
+    TS_ASSERT(MDBinningCache::Instance().fill(*m_ws, fineTransform(), m_fineBins, signals.data(), errors.data(),
+                                              events.data()));
+    TS_ASSERT_EQUALS(signals, m_fineSignals);
+    TS_ASSERT_EQUALS(errors, m_fineErrors);
+    TS_ASSERT_EQUALS(events, m_fineEvents);
+  }
+
+  void test_incompatible_cuts_are_not_filled() {
+    storeFineBins();
+    // bins 1.5 times as wide
+    TS_ASSERT(!canFill(makeTransform(4.f / 3.f, 0.f, 4.f, 1.f), {5, 10}));
+    // edges half way between fine bins
+    TS_ASSERT(!canFill(makeTransform(1.f, 0.25f, 2.f, 4.f), {5, 8}));
+    // extends past the fine bins
+    TS_ASSERT(!canFill(makeTransform(1.f, 0.f, 2.f, 4.f), {5, 9}));
+    // starts before the fine bins
+    TS_ASSERT(!canFill(makeTransform(1.f, 0.f, 2.f, 0.f), {5, 8}));
+    // finer bins
+    TS_ASSERT(!canFill(makeTransform(4.f, 0.f, 4.f, 1.f), {20, 20}));
+    // a different number of dimensions
+    TS_ASSERT(!canFill(Matrix<coord_t>(2, 4, true), {10}));
+
+    // a different direction
+    auto rotated = fineTransform();
+    rotated[0][1] = 1.f;
+    TS_ASSERT(!canFill(rotated, m_fineBins));
+  }
+
+  void test_other_workspace_is_not_filled() {
+    storeFineBins();
+    auto other = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0, 1);
+    std::vector<signal_t> signals(200), errors(200), events(200);
+    TS_ASSERT(!MDBinningCache::Instance().fill(*other, fineTransform(), m_fineBins, signals.data(), errors.data(),
+                                               events.data()));
+  }
+
+  void test_modified_workspace_is_not_filled() {
+    storeFineBins();
+    m_ws->refreshCache();
+    TS_ASSERT(!canFill(fineTransform(), m_fineBins));
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().size(), 0);
+  }
+
+  void test_deleted_workspace_is_removed() {
+    storeFineBins();
+    m_ws.reset();
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().size(), 1);
+    MDBinningCache::Instance().clear();
+    m_ws = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0, 1);
+    storeFineBins();
+    auto other = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0, 1);
+    storeFineBins(other);
+    other.reset();
+    // the next access removes the histogram of the deleted workspace
+    TS_ASSERT(canFill(fineTransform(), m_fineBins));
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().size(), 1);
+  }
+
+  void test_storing_the_same_bins_replaces_them() {
+    storeFineBins();
+    storeFineBins();
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().size(), 1);
+  }
+
+  void test_memory_limit() {
+    auto &config = Kernel::ConfigService::Instance();
+    const auto original = config.getString("BinMD.CacheMemoryMB");
+    config.setString("BinMD.CacheMemoryMB", "0");
+    storeFineBins();
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().size(), 0);
+
+    // room for one 1 MB histogram: the least recently used one is dropped
+    config.setString("BinMD.CacheMemoryMB", "1");
+    const std::vector<size_t> bins{256, 128};
+    const std::vector<signal_t> values(256 * 128, 1.);
+    MDBinningCache::Instance().store(m_ws, fineTransform(), bins, values.data(), values.data(), values.data());
+    MDBinningCache::Instance().store(m_ws, makeTransform(4.f, 0.f, 4.f, 0.f), bins, values.data(), values.data(),
+                                     values.data());
+    TS_ASSERT_EQUALS(MDBinningCache::Instance().size(), 1);
+    TS_ASSERT(canFill(makeTransform(4.f, 0.f, 4.f, 0.f), bins));
+    config.setString("BinMD.CacheMemoryMB", original);
+  }
+
+private:
+  /// Transform from 3 dimensions to bins of x and y, (x * scaleX - offsetX) and (y * scaleY - offsetY)
+  static Matrix<coord_t> makeTransform(const coord_t scaleX, const coord_t offsetX, const coord_t scaleY,
+                                       const coord_t offsetY) {
+    Matrix<coord_t> transform(3, 4);
+    transform[0][0] = scaleX;
+    transform[0][3] = -offsetX;
+    transform[1][1] = scaleY;
+    transform[1][3] = -offsetY;
+    transform[2][3] = 1.f;
+    return transform;
+  }
+
+  /// 10 bins in x from 0 to 5 and 20 bins in y from 1 to 6
+  static Matrix<coord_t> fineTransform() { return makeTransform(2.f, 0.f, 4.f, 4.f); }
+
+  void storeFineBins() { storeFineBins(m_ws); }
+
+  void storeFineBins(const MDEventWorkspace3Lean::sptr &ws) {
+    MDBinningCache::Instance().store(ws, fineTransform(), m_fineBins, m_fineSignals.data(), m_fineErrors.data(),
+                                     m_fineEvents.data());
+  }
+
+  bool canFill(const Matrix<coord_t> &transform, const std::vector<size_t> &numBins) {
+    size_t total = 1;
+    for (const auto bins : numBins)
+      total *= bins;
+    std::vector<signal_t> signals(total), errors(total), events(total);
+    return MDBinningCache::Instance().fill(*m_ws, transform, numBins, signals.data(), errors.data(), events.data());
+  }
+
+  const std::vector<size_t> m_fineBins;
+  std::vector<signal_t> m_fineSignals;
+  std::vector<signal_t> m_fineErrors;
+  std::vector<signal_t> m_fineEvents;
+  MDEventWorkspace3Lean::sptr m_ws;
+};
@@ -0,0 +1,258 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
+#include "MantidKernel/Timer.h"
+#include "MantidMDAlgorithms/MDEventWorkspaceBuilder.h"
+
+#include <cxxtest/TestSuite.h>
+#include <random>
+#include <thread>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using namespace Mantid::MDAlgorithms;
+
+namespace {
+/// Events of signal 1 and error 1, spread uniformly over [min, max] in every dimension
+template <typename MDE, size_t nd>
+std::vector<MDE> makeUniformEvents(const size_t numEvents, const coord_t min, const coord_t max,
+                                   const unsigned int seed = 12345) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<coord_t> distribution(min, max);
+  std::vector<MDE> events;
+  events.reserve(numEvents);
+  for (size_t i = 0; i < numEvents; ++i) {
+    coord_t centers[nd];
+    for (size_t d = 0; d < nd; ++d)
+      centers[d] = distribution(generator);
+    events.emplace_back(1.0f, 1.0f, centers);
+  }
+  return events;
+}
+
+/// Check that the events of every box are inside it, and that boxes only pass the threshold at the maximum depth
+template <typename MDE, size_t nd> void checkBoxes(MDEventWorkspace<MDE, nd> &ws) {
+  const auto bc = ws.getBoxController();
+  std::vector<IMDNode *> boxes;
+  ws.getBox()->getBoxes(boxes, 1000, true);
+  size_t numEvents = 0;
+  for (auto *node : boxes) {
+    auto *box = dynamic_cast<MDBox<MDE, nd> *>(node);
+    TS_ASSERT(box);
+    if (!box)
+      continue;
+    numEvents += box->getNPoints();
+    if (box->getDepth() < bc->getMaxDepth())
+      TS_ASSERT_LESS_THAN_EQUALS(box->getNPoints(), bc->getSplitThreshold());
+    for (const auto &event : box->getConstEvents()) {
+      for (size_t d = 0; d < nd; ++d) {
+        // allow for the rounding of the coordinates to the Morton index
+        TS_ASSERT_LESS_THAN_EQUALS(box->getExtents(d).getMin() - 1e-4f, event.getCenter(d));
+        TS_ASSERT_LESS_THAN_EQUALS(event.getCenter(d), box->getExtents(d).getMax() + 1e-4f);
+      }
+    }
+  }
+  TS_ASSERT_EQUALS(numEvents, ws.getNPoints());
+}
+} // namespace
+
+class MDEventWorkspaceBuilderTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDEventWorkspaceBuilderTest *createSuite() { return new MDEventWorkspaceBuilderTest(); }
+  static void destroySuite(MDEventWorkspaceBuilderTest *suite) { delete suite; }
+
+  void test_canBuildFromMortonIndex() {
+    TS_ASSERT(canBuildFromMortonIndex(*MDEventsTestHelper::makeMDEW<2>(2, 0.0, 10.0)));
+    TS_ASSERT(canBuildFromMortonIndex(*MDEventsTestHelper::makeMDEW<3>(4, 0.0, 10.0)));
+    TS_ASSERT(canBuildFromMortonIndex(*MDEventsTestHelper::makeMDEW<4>(2, 0.0, 10.0)));
+    // not a power of 2
+    TS_ASSERT(!canBuildFromMortonIndex(*MDEventsTestHelper::makeMDEW<3>(3, 0.0, 10.0)));
+    // not split
+    TS_ASSERT(!canBuildFromMortonIndex(*MDEventsTestHelper::makeMDEW<3>(1, 0.0, 10.0)));
+    // no index of coord_t coordinates
+    TS_ASSERT(!canBuildFromMortonIndex(*MDEventsTestHelper::makeMDEW<1>(2, 0.0, 10.0)));
+    TS_ASSERT(!canBuildFromMortonIndex(*MDEventsTestHelper::makeMDEW<5>(2, 0.0, 10.0)));
+
+    auto differentSplits = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0);
+    differentSplits->getBoxController()->setSplitInto(1, 4);
+    TS_ASSERT(!canBuildFromMortonIndex(*differentSplits));
+
+    auto splitTop = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0);
+    splitTop->getBoxController()->setSplitTopInto(0, 4);
+    TS_ASSERT(!canBuildFromMortonIndex(*splitTop));
+  }
+
+  void test_constructor_throws_if_the_workspace_cannot_be_built() {
+    auto ws = MDEventsTestHelper::makeMDEW<3>(3, 0.0, 10.0);
+    TS_ASSERT_THROWS((MDEventWorkspaceBuilder<MDLeanEvent<3>, 3>(*ws)), const std::invalid_argument &);
+  }
+
+  void test_build_from_batches() {
+    auto ws = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0);
+    MDEventWorkspaceBuilder<MDLeanEvent<3>, 3> builder(*ws);
+    builder.reserve(5000);
+    for (unsigned int batch = 0; batch < 5; ++batch)
+      builder.addEvents(makeUniformEvents<MDLeanEvent<3>, 3>(1000, 0.f, 10.f, batch));
+    TS_ASSERT_EQUALS(builder.getNumEvents(), 5000);
+
+    const auto error = builder.build();
+    TS_ASSERT_EQUALS(builder.getNumEvents(), 0);
+    for (size_t d = 0; d < 3; ++d)
+      TS_ASSERT_LESS_THAN(error[d], 1e-5);
+
+    TS_ASSERT_EQUALS(ws->getNPoints(), 5000);
+    TS_ASSERT_DELTA(ws->getBox()->getSignal(), 5000., 1e-6);
+    TS_ASSERT_DELTA(ws->getBox()->getErrorSquared(), 5000., 1e-6);
+    TS_ASSERT(ws->getBox()->getNumChildren() > 0);
+    checkBoxes(*ws);
+  }
+
+  void test_build_keeps_the_events_of_the_workspace() {
+    // one event in the middle of each of the 8 boxes
+    auto ws = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0, 1);
+    MDEventWorkspaceBuilder<MDLeanEvent<3>, 3> builder(*ws);
+    builder.addEvents(makeUniformEvents<MDLeanEvent<3>, 3>(500, 0.f, 10.f));
+    builder.build();
+
+    TS_ASSERT_EQUALS(ws->getNPoints(), 508);
+    TS_ASSERT_DELTA(ws->getBox()->getSignal(), 508., 1e-6);
+    checkBoxes(*ws);
+  }
+
+  void test_build_drops_events_outside_the_workspace() {
+    auto ws = MDEventsTestHelper::makeMDEW<2>(2, 0.0, 10.0);
+    MDEventWorkspaceBuilder<MDLeanEvent<2>, 2> builder(*ws);
+    builder.addEvents(makeUniformEvents<MDLeanEvent<2>, 2>(200, 0.f, 10.f));
+    builder.addEvents(makeUniformEvents<MDLeanEvent<2>, 2>(100, 11.f, 20.f));
+    builder.build();
+
+    TS_ASSERT_EQUALS(ws->getNPoints(), 200);
+    checkBoxes(*ws);
+  }
+
+  void test_build_full_events_in_4_dimensions() {
+    auto ws = MDEventsTestHelper::makeAnyMDEW<MDEvent<4>, 4>(2, 0.0, 10.0);
+    MDEventWorkspaceBuilder<MDEvent<4>, 4> builder(*ws);
+    auto events = makeUniformEvents<MDEvent<4>, 4>(2000, 0.f, 10.f);
+    for (size_t i = 0; i < events.size(); ++i) {
+      events[i].setExpInfoIndex(static_cast<uint16_t>(i % 3));
+      events[i].setDetectorId(static_cast<int32_t>(i));
+    }
+    builder.addEvents(events);
+    builder.build();
+
+    TS_ASSERT_EQUALS(ws->getNPoints(), 2000);
+    checkBoxes(*ws);
+    std::vector<IMDNode *> boxes;
+    ws->getBox()->getBoxes(boxes, 1000, true);
+    int64_t detectorIdSum = 0;
+    for (auto *node : boxes)
+      for (const auto &event : dynamic_cast<MDBox<MDEvent<4>, 4> *>(node)->getConstEvents())
+        detectorIdSum += event.getDetectorID();
+    TS_ASSERT_EQUALS(detectorIdSum, 1999 * 2000 / 2);
+  }
+
+  void test_add_events_from_several_threads() {
+    auto ws = MDEventsTestHelper::makeMDEW<3>(4, 0.0, 10.0);
+    MDEventWorkspaceBuilder<MDLeanEvent<3>, 3> builder(*ws, 2);
+    std::vector<std::thread> producers;
+    for (unsigned int i = 0; i < 4; ++i)
+      producers.emplace_back([&builder, i]() {
+        for (unsigned int batch = 0; batch < 10; ++batch)
+          builder.addEvents(makeUniformEvents<MDLeanEvent<3>, 3>(100, 0.f, 10.f, 10 * i + batch));
+      });
+    for (auto &producer : producers)
+      producer.join();
+    TS_ASSERT_EQUALS(builder.getNumEvents(), 4000);
+    builder.build();
+
+    TS_ASSERT_EQUALS(ws->getNPoints(), 4000);
+    checkBoxes(*ws);
+  }
+
+  void test_build_matches_adding_and_splitting_events() {
+    auto indexed = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0);
+    auto split = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0);
+    const auto events = makeUniformEvents<MDLeanEvent<3>, 3>(3000, 0.f, 10.f);
+    split->addEvents(events);
+    split->splitAllIfNeeded(nullptr);
+    split->refreshCache();
+    MDEventWorkspaceBuilder<MDLeanEvent<3>, 3> builder(*indexed);
+    builder.addEvents(events);
+    builder.build();
+
+    // the boxes differ, but the events in any region of the workspace are the same
+    TS_ASSERT_EQUALS(indexed->getNPoints(), split->getNPoints());
+    const std::vector<coord_t> min{1.f, 2.f, 3.f}, max{4.f, 7.f, 9.f};
+    TS_ASSERT_DELTA(integrate(*indexed, min, max), integrate(*split, min, max), 1e-6);
+  }
+
+private:
+  /// @return the total signal of the events inside the box [min, max]
+  static signal_t integrate(MDEventWorkspace3Lean &ws, const std::vector<coord_t> &min,
+                            const std::vector<coord_t> &max) {
+    std::vector<IMDNode *> boxes;
+    ws.getBox()->getBoxes(boxes, 1000, true);
+    signal_t signal = 0;
+    for (auto *node : boxes) {
+      for (const auto &event : dynamic_cast<MDBox<MDLeanEvent<3>, 3> *>(node)->getConstEvents()) {
+        bool inside = true;
+        for (size_t d = 0; d < 3; ++d)
+          inside = inside && event.getCenter(d) >= min[d] && event.getCenter(d) <= max[d];
+        if (inside)
+          signal += event.getSignal();
+      }
+    }
+    return signal;
+  }
+};
+
+class MDEventWorkspaceBuilderTestPerformance : public CxxTest::TestSuite {
+public:
+  static MDEventWorkspaceBuilderTestPerformance *createSuite() { return new MDEventWorkspaceBuilderTestPerformance(); }
+  static void destroySuite(MDEventWorkspaceBuilderTestPerformance *suite) { delete suite; }
+
+  MDEventWorkspaceBuilderTestPerformance() : m_events(makeUniformEvents<MDLeanEvent<3>, 3>(2000000, 0.f, 10.f)) {}
+
+  void test_build_from_batches() {
+    auto ws = makeWorkspace();
+    Kernel::Timer timer;
+    MDEventWorkspaceBuilder<MDLeanEvent<3>, 3> builder(*ws);
+    builder.reserve(m_events.size());
+    const size_t batchSize = 100000;
+    for (size_t start = 0; start < m_events.size(); start += batchSize)
+      builder.addEvents(std::vector<MDLeanEvent<3>>(m_events.cbegin() + start, m_events.cbegin() + start + batchSize));
+    builder.build();
+    std::cout << timer.elapsed() << " s to build the boxes from " << m_events.size() << " events\n";
+    TS_ASSERT_EQUALS(ws->getNPoints(), m_events.size());
+  }
+
+  void test_add_events_and_split() {
+    auto ws = makeWorkspace();
+    Kernel::Timer timer;
+    ws->addEvents(m_events);
+    ws->splitAllIfNeeded(nullptr);
+    ws->refreshCache();
+    std::cout << timer.elapsed() << " s to add and split " << m_events.size() << " events\n";
+    TS_ASSERT_EQUALS(ws->getNPoints(), m_events.size());
+  }
+
+private:
+  static MDEventWorkspace3Lean::sptr makeWorkspace() {
+    auto ws = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0);
+    ws->getBoxController()->setSplitThreshold(1000);
+    ws->getBoxController()->setMaxDepth(20);
+    return ws;
+  }
+
+  const std::vector<MDLeanEvent<3>> m_events;
+};
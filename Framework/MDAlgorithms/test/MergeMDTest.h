@@ -63,12 +63,15 @@ public:
     TS_ASSERT(!alg.isExecuted());
   }
 
-  IMDEventWorkspace_sptr execute_merge(const std::string &wsName) {
+  IMDEventWorkspace_sptr execute_merge(const std::string &wsName, const std::string &boxBuilder = "Default",
+                                       const std::string &splitInto = "2") {
     MergeMD alg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize())
     TS_ASSERT(alg.isInitialized())
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("InputWorkspaces", "ws0,ws1,ws2"));
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", wsName));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("BoxBuilder", boxBuilder));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("SplitInto", splitInto));
     TS_ASSERT_THROWS_NOTHING(alg.execute(););
     TS_ASSERT(alg.isExecuted());
 
@@ -99,6 +102,35 @@ public:
     AnalysisDataService::Instance().remove(outWSName);
   }
 
+  void test_exec_indexed() {
+    std::string outWSName("MergeMDTest_OutputWS");
+    auto ws = execute_merge(outWSName, "Indexed");
+
+    TS_ASSERT_EQUALS(ws->getNPoints(), 2 * 2 + 6 * 6 + 10 * 10);
+    TS_ASSERT_EQUALS(3, ws->getNumExperimentInfo());
+    // no box holds more events than the threshold
+    std::vector<API::IMDNode *> boxes;
+    ws->getBoxes(boxes, 1000, true);
+    signal_t signal = 0;
+    for (const auto *box : boxes)
+      signal += box->getSignal();
+    TS_ASSERT_DELTA(signal, 140., 1e-6);
+    for (const auto *box : boxes)
+      TS_ASSERT_LESS_THAN_EQUALS(box->getNPoints(), ws->getBoxController()->getSplitThreshold());
+
+    AnalysisDataService::Instance().remove(outWSName);
+  }
+
+  void test_exec_indexed_falls_back_to_default_if_the_split_is_not_a_power_of_2() {
+    std::string outWSName("MergeMDTest_OutputWS");
+    auto ws = execute_merge(outWSName, "Indexed", "3");
+
+    TS_ASSERT_EQUALS(ws->getNPoints(), 2 * 2 + 6 * 6 + 10 * 10);
+    TS_ASSERT_EQUALS(3, ws->getNumExperimentInfo());
+
+    AnalysisDataService::Instance().remove(outWSName);
+  }
+
   void test_masked_data_omitted() {
     // Name of the output workspace.
     std::string outWSName("MergeMDTest_OutputWS");
@@ -212,4 +244,36 @@ public:
     // Remove workspace from the data service.
     AnalysisDataService::Instance().remove(outWSName);
   }
+
+  void test_expInfoIndex_indexed() {
+    std::string outWSName("MergeMDTest_OutputWS");
+
+    MergeMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("InputWorkspaces", "mde3,mde3,mde3"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", outWSName));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("BoxBuilder", "Indexed"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+
+    MDEventWorkspace3::sptr ws;
+    TS_ASSERT_THROWS_NOTHING(ws = AnalysisDataService::Instance().retrieveWS<MDEventWorkspace3>(outWSName);)
+    TS_ASSERT(ws);
+    TS_ASSERT_EQUALS(ws->getNPoints(), 3 * 8);
+    TS_ASSERT_EQUALS(3, ws->getNumExperimentInfo());
+
+    // each input adds one event to every box, with the index of its own experiment info
+    std::vector<API::IMDNode *> boxes;
+    ws->getBox()->getBoxes(boxes, 10, true);
+    std::vector<size_t> eventsPerExpInfo(3, 0);
+    for (auto *node : boxes) {
+      auto *box = dynamic_cast<MDBox<MDEvent<3>, 3> *>(node);
+      TS_ASSERT(box);
+      for (const auto &event : box->getConstEvents())
+        ++eventsPerExpInfo[event.getExpInfoIndex()];
+    }
+    TS_ASSERT_EQUALS(eventsPerExpInfo, std::vector<size_t>(3, 8));
+
+    AnalysisDataService::Instance().remove(outWSName);
+  }
 };
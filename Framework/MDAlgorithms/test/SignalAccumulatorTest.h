@@ -0,0 +1,148 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Timer.h"
+#include "MantidMDAlgorithms/SignalAccumulator.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <atomic>
+#include <iostream>
+
+using Mantid::MDAlgorithms::SignalAccumulator;
+using Mantid::signal_t;
+using Strategy = Mantid::MDAlgorithms::SignalAccumulator::Strategy;
+
+namespace {
+/// Pseudo-random contributions like those from the trajectory of one detector through the histogram
+template <typename AddFunc>
+void addContributions(const int64_t numDetectors, const size_t numBins, const size_t numPerDetector, AddFunc &&add) {
+  PRAGMA_OMP(parallel for schedule(static))
+  for (int64_t det = 0; det < numDetectors; ++det) {
+    size_t index = (static_cast<size_t>(det) * 7919) % numBins;
+    for (size_t i = 0; i < numPerDetector; ++i) {
+      const auto value = 1. / static_cast<double>(1 + det + static_cast<int64_t>(i));
+      add(static_cast<size_t>(PARALLEL_THREAD_NUMBER), index, value);
+      index = (index + 97) % numBins;
+    }
+  }
+}
+
+std::vector<signal_t> accumulate(const Strategy strategy, const int64_t numDetectors, const size_t numBins,
+                                 const size_t numPerDetector) {
+  SignalAccumulator accumulator(numBins, static_cast<size_t>(PARALLEL_GET_MAX_THREADS), strategy);
+  addContributions(numDetectors, numBins, numPerDetector,
+                   [&accumulator](const size_t thread, const size_t index, const signal_t value) {
+                     accumulator.add(thread, index, value);
+                   });
+  std::vector<signal_t> result(numBins, 0.);
+  accumulator.addTo(result.data());
+  return result;
+}
+} // namespace
+
+class SignalAccumulatorTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SignalAccumulatorTest *createSuite() { return new SignalAccumulatorTest(); }
+  static void destroySuite(SignalAccumulatorTest *suite) { delete suite; }
+
+  void test_chooseStrategy() {
+    TS_ASSERT_EQUALS(SignalAccumulator::chooseStrategy(1000, 1, 0), Strategy::DENSE);
+    TS_ASSERT_EQUALS(SignalAccumulator::chooseStrategy(1000, 8, 1000 * 8 * sizeof(signal_t) * 4), Strategy::DENSE);
+    TS_ASSERT_EQUALS(SignalAccumulator::chooseStrategy(1000, 8, 1000 * 8 * sizeof(signal_t)), Strategy::SPARSE);
+  }
+
+  void test_single_thread() {
+    for (const auto strategy : {Strategy::DENSE, Strategy::SPARSE}) {
+      SignalAccumulator accumulator(5, 1, strategy);
+      TS_ASSERT_EQUALS(accumulator.strategy(), strategy);
+      accumulator.add(0, 1, 2.);
+      accumulator.add(0, 1, 3.);
+      accumulator.add(0, 4, 1.);
+      std::vector<signal_t> output{1., 1., 1., 1., 1.};
+      accumulator.addTo(output.data());
+      TS_ASSERT_EQUALS(output, std::vector<signal_t>({1., 6., 1., 1., 2.}));
+    }
+  }
+
+  void test_threads_are_merged() {
+    for (const auto strategy : {Strategy::DENSE, Strategy::SPARSE}) {
+      SignalAccumulator accumulator(3, 4, strategy);
+      accumulator.add(0, 0, 1.);
+      accumulator.add(3, 0, 2.);
+      accumulator.add(2, 2, 4.);
+      std::vector<signal_t> output(3, 0.);
+      accumulator.addTo(output.data());
+      TS_ASSERT_EQUALS(output, std::vector<signal_t>({3., 0., 4.}));
+    }
+  }
+
+  void test_dense_and_sparse_are_identical() {
+    const auto dense = accumulate(Strategy::DENSE, 2000, 10000, 50);
+    const auto sparse = accumulate(Strategy::SPARSE, 2000, 10000, 50);
+    // not just close, the additions happen in the same order
+    TS_ASSERT_EQUALS(dense, sparse);
+  }
+
+  void test_reproducible() {
+    const auto first = accumulate(Strategy::DENSE, 2000, 1000, 50);
+    for (size_t i = 0; i < 5; ++i)
+      TS_ASSERT_EQUALS(accumulate(Strategy::DENSE, 2000, 1000, 50), first);
+  }
+};
+
+/** Compare atomic additions into a shared histogram with the strategies of SignalAccumulator for a range of thread
+ * counts. This resembles the accumulation of MDNorm with many detectors on a fine grid.
+ */
+class SignalAccumulatorTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SignalAccumulatorTestPerformance *createSuite() { return new SignalAccumulatorTestPerformance(); }
+  static void destroySuite(SignalAccumulatorTestPerformance *suite) { delete suite; }
+
+  void setUp() override { m_maxThreads = PARALLEL_GET_MAX_THREADS; }
+
+  void tearDown() override { PARALLEL_SET_NUM_THREADS(m_maxThreads); }
+
+  void test_atomic() {
+    sweepThreads("atomic", [] {
+      std::vector<std::atomic<signal_t>> signalArray(NUM_BINS);
+      addContributions(NUM_DETECTORS, NUM_BINS, NUM_PER_DETECTOR,
+                       [&signalArray](const size_t, const size_t index, const signal_t value) {
+                         Mantid::Kernel::AtomicOp(signalArray[index], value, std::plus<signal_t>());
+                       });
+    });
+  }
+
+  void test_dense() {
+    sweepThreads("dense", [] { accumulate(Strategy::DENSE, NUM_DETECTORS, NUM_BINS, NUM_PER_DETECTOR); });
+  }
+
+  void test_sparse() {
+    sweepThreads("sparse", [] { accumulate(Strategy::SPARSE, NUM_DETECTORS, NUM_BINS, NUM_PER_DETECTOR); });
+  }
+
+private:
+  template <typename Func> void sweepThreads(const std::string &name, Func &&func) {
+    for (int numThreads = 1; numThreads <= m_maxThreads; numThreads *= 2) {
+      PARALLEL_SET_NUM_THREADS(numThreads);
+      Mantid::Kernel::Timer timer;
+      func();
+      std::cout << "\n" << name << " with " << numThreads << " threads: " << timer.elapsed() << "s";
+    }
+  }
+
+  static constexpr int64_t NUM_DETECTORS{100000};
+  static constexpr size_t NUM_BINS{200 * 200 * 50};
+  static constexpr size_t NUM_PER_DETECTOR{200};
+  int m_maxThreads{1};
+};
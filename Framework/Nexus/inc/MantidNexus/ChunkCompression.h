@@ -0,0 +1,34 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidNexus/DllConfig.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace Mantid::Nexus {
+
+/// How to compress a dataset created with File::makeDeflateData
+struct MANTID_NEXUS_DLL DeflateSettings {
+  /// deflate compression level between 1 (fastest) and 9 (smallest)
+  int level{6};
+  /// shuffle the bytes of the elements before compressing, which usually helps numeric data
+  bool shuffle{true};
+};
+
+/// Rearrange the bytes so all of the first bytes of the elements come first, then the second bytes, etc.
+MANTID_NEXUS_DLL std::vector<char> shuffleBytes(void const *data, std::size_t const nbytes,
+                                                std::size_t const elementSize);
+
+/** Compress a chunk the same way as the HDF5 filter pipeline of a dataset created with File::makeDeflateData. The
+ * result can be written with File::putRawChunk. This does not use HDF5 so it can be called from many threads at once.
+ */
+MANTID_NEXUS_DLL std::vector<char> compressChunk(void const *data, std::size_t const nbytes,
+                                                 std::size_t const elementSize, DeflateSettings const &settings);
+
+} // namespace Mantid::Nexus
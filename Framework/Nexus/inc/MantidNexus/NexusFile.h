@@ -337,6 +337,31 @@ public:
   void makeCompData(std::string const &name, NXnumtype const type, DimVector const &dims, NXcompression comp,
                     DimVector const &bufsize, bool open_data = false);
 
+  /**
+   * Create a chunked field compressed with deflate, optionally preceded by the byte shuffle filter. Unlike
+   * makeCompData the compression level and shuffle can be chosen. The dimensions must not be unlimited.
+   *
+   * \param name The name of the data to create.
+   * \param type The primitive (numeric) type for the data.
+   * \param dims The dimensions of the data.
+   * \param chunk The dimensions of each chunk.
+   * \param deflateLevel The deflate compression level between 1 and 9.
+   * \param shuffle Whether to shuffle the bytes before compressing.
+   * \param open_data Whether or not to open the data after creating it.
+   */
+  void makeDeflateData(std::string const &name, NXnumtype const type, DimVector const &dims, DimVector const &chunk,
+                       int const deflateLevel, bool const shuffle, bool open_data = false);
+
+  /**
+   * Write a whole chunk of the open dataset that has already been passed through all of the filters of the dataset,
+   * e.g. by Nexus::compressChunk. This bypasses the filter pipeline of HDF5 so the compression can be done elsewhere.
+   *
+   * \param data The filtered chunk.
+   * \param nbytes The number of bytes in the filtered chunk.
+   * \param offset The logical position of the first element of the chunk in the dataset.
+   */
+  void putRawChunk(void const *data, std::size_t const nbytes, DimVector const &offset);
+
   /**
    * Insert an array as part of a data in the final file.
    *
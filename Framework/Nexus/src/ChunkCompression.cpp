@@ -0,0 +1,68 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidNexus/ChunkCompression.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <zlib.h>
+
+namespace Mantid::Nexus {
+
+/**
+ * This is the same byte order as the HDF5 shuffle filter. Any bytes left over from a partial element are copied
+ * unchanged to the end.
+ * @param data :: the chunk
+ * @param nbytes :: number of bytes in the chunk
+ * @param elementSize :: number of bytes in each element
+ * @returns The shuffled bytes
+ */
+std::vector<char> shuffleBytes(void const *data, std::size_t const nbytes, std::size_t const elementSize) {
+  const auto *input = static_cast<const char *>(data);
+  std::vector<char> output(nbytes);
+  if (elementSize <= 1) {
+    std::memcpy(output.data(), input, nbytes);
+    return output;
+  }
+  const std::size_t numElements = nbytes / elementSize;
+  for (std::size_t byte = 0; byte < elementSize; ++byte) {
+    char *out = output.data() + byte * numElements;
+    for (std::size_t i = 0; i < numElements; ++i)
+      out[i] = input[i * elementSize + byte];
+  }
+  const std::size_t leftover = nbytes - numElements * elementSize;
+  std::memcpy(output.data() + numElements * elementSize, input + numElements * elementSize, leftover);
+  return output;
+}
+
+/**
+ * @param data :: the chunk, which must have the full chunk dimensions even at the edge of the dataset
+ * @param nbytes :: number of bytes in the chunk
+ * @param elementSize :: number of bytes in each element
+ * @param settings :: the settings the dataset was created with
+ * @returns The compressed bytes
+ * @throws std::runtime_error if zlib fails
+ */
+std::vector<char> compressChunk(void const *data, std::size_t const nbytes, std::size_t const elementSize,
+                                DeflateSettings const &settings) {
+  std::vector<char> shuffled;
+  const auto *input = static_cast<const Bytef *>(data);
+  if (settings.shuffle) {
+    shuffled = shuffleBytes(data, nbytes, elementSize);
+    input = reinterpret_cast<const Bytef *>(shuffled.data());
+  }
+
+  auto compressedSize = compressBound(static_cast<uLong>(nbytes));
+  std::vector<char> output(compressedSize);
+  const int status = compress2(reinterpret_cast<Bytef *>(output.data()), &compressedSize, input,
+                               static_cast<uLong>(nbytes), settings.level);
+  if (status != Z_OK)
+    throw std::runtime_error("Failed to compress chunk: zlib error " + std::to_string(status));
+  output.resize(compressedSize);
+  return output;
+}
+
+} // namespace Mantid::Nexus
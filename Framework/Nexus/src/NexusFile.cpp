@@ -936,6 +936,81 @@ void File::makeCompData(std::string const &name, NXnumtype const type, DimVector
   }
 }
 
+void File::makeDeflateData(std::string const &name, NXnumtype const type, DimVector const &dims,
+                           DimVector const &chunk, int const deflateLevel, bool const shuffle, bool open_data) {
+  stringstream msg;
+  msg << "makeDeflateData(" << name << ", " << type << ", " << toString(dims) << ", " << toString(chunk) << ", "
+      << deflateLevel << ", " << shuffle << ") failed: ";
+
+  // error check the parameters
+  if (name.empty()) {
+    msg << "Supplied empty name";
+    throw NXEXCEPTION(msg.str());
+  }
+  if (dims.empty() || dims.size() != chunk.size()) {
+    msg << "Supplied dims rank=" << dims.size() << " must match supplied chunk rank=" << chunk.size();
+    throw NXEXCEPTION(msg.str());
+  }
+  if (type == NXnumtype::CHAR) {
+    msg << "Character data is not supported";
+    throw NXEXCEPTION(msg.str());
+  }
+  if (std::any_of(dims.cbegin(), dims.cend(), [](auto x) -> bool { return x == NX_UNLIMITED || x <= 0; })) {
+    msg << "Unlimited dimensions are not supported";
+    throw NXEXCEPTION(msg.str());
+  }
+  if (deflateLevel < 1 || deflateLevel > 9) {
+    msg << "Deflate level must be between 1 and 9";
+    throw NXEXCEPTION(msg.str());
+  }
+  if (m_current_group_id <= 0) {
+    msg << "No group open for makedata on " << name;
+    throw NXEXCEPTION(msg.str());
+  }
+
+  DataTypeID datatype = H5Tcopy(nxToHDF5Type(type));
+  DataSpaceID dataspace = H5Screate_simple(static_cast<int>(dims.size()), dims.data(), nullptr);
+
+  // the order of the filters must match Nexus::compressChunk
+  ParameterID cparms = H5Pcreate(H5P_DATASET_CREATE);
+  if (H5Pset_chunk(cparms, static_cast<int>(chunk.size()), chunk.data()) < 0) {
+    msg << "Size of chunks could not be set";
+    throw NXEXCEPTION(msg.str());
+  }
+  if (shuffle)
+    H5Pset_shuffle(cparms);
+  H5Pset_deflate(cparms, static_cast<unsigned>(deflateLevel));
+
+  NexusAddress absaddr(formAbsoluteAddress(name));
+  DataSetID dataset = H5Dcreate(*m_pfile, absaddr.c_str(), datatype, dataspace, H5P_DEFAULT, cparms, H5P_DEFAULT);
+  if (!dataset.isValid()) {
+    msg << "Creating chunked dataset failed";
+    throw NXEXCEPTION(msg.str());
+  }
+  registerEntry(absaddr, SCIENTIFIC_DATA_SET);
+  if (open_data) {
+    m_current_type_id = datatype.release();
+    m_current_space_id = dataspace.release();
+    m_current_data_id = dataset.release();
+    m_address = absaddr;
+  }
+}
+
+void File::putRawChunk(void const *data, std::size_t const nbytes, DimVector const &offset) {
+  if (data == nullptr) {
+    throw NXEXCEPTION("Data specified as null");
+  }
+  if (!isDataSetOpen()) {
+    throw NXEXCEPTION("putRawChunk failed: no dataset open");
+  }
+  // a filter mask of zero means every filter of the dataset was applied
+  if (H5Dwrite_chunk(m_current_data_id, H5P_DEFAULT, 0, offset.data(), nbytes, data) < 0) {
+    stringstream msg;
+    msg << "putRawChunk(" << toString(offset) << ", " << nbytes << ") failed";
+    throw NXEXCEPTION(msg.str());
+  }
+}
+
 template <typename NumT> void File::putSlab(NumT const *data, DimVector const &start, DimVector const &size) {
   if (data == nullptr) {
     throw NXEXCEPTION("Data specified as null");
@@ -0,0 +1,111 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidNexus/ChunkCompression.h"
+#include "MantidNexus/NexusException.h"
+#include "MantidNexus/NexusFile.h"
+#include "test_helper.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace NexusTest;
+using Mantid::Nexus::compressChunk;
+using Mantid::Nexus::DeflateSettings;
+using Mantid::Nexus::DimVector;
+using Mantid::Nexus::shuffleBytes;
+
+namespace {
+/// Write a NROWS x NCOLS dataset in chunks of CHUNK_ROWS rows compressed outside of HDF5 and read it back
+std::vector<double> writeAndReadCompressed(std::string const &filename, DeflateSettings const &settings) {
+  constexpr int64_t NROWS{10}, NCOLS{7}, CHUNK_ROWS{4};
+  Mantid::Nexus::File file(filename, NXaccess::CREATE5);
+  file.makeGroup("entry", "NXentry", true);
+  file.makeDeflateData("values", NXnumtype::FLOAT64, DimVector{NROWS, NCOLS}, DimVector{CHUNK_ROWS, NCOLS},
+                       settings.level, settings.shuffle, true);
+  for (int64_t firstRow = 0; firstRow < NROWS; firstRow += CHUNK_ROWS) {
+    // the last chunk extends past the end of the dataset so it is padded
+    std::vector<double> chunk(CHUNK_ROWS * NCOLS, -1.);
+    for (int64_t row = firstRow; row < std::min(firstRow + CHUNK_ROWS, NROWS); ++row)
+      for (int64_t col = 0; col < NCOLS; ++col)
+        chunk[(row - firstRow) * NCOLS + col] = static_cast<double>(row * 100 + col);
+    const auto compressed = compressChunk(chunk.data(), chunk.size() * sizeof(double), sizeof(double), settings);
+    file.putRawChunk(compressed.data(), compressed.size(), DimVector{firstRow, 0});
+  }
+  file.closeData();
+  file.close();
+
+  Mantid::Nexus::File input(filename, NXaccess::READ);
+  input.openAddress("/entry/values");
+  std::vector<double> result;
+  input.getData(result);
+  return result;
+}
+
+std::vector<double> expectedValues() {
+  std::vector<double> expected;
+  for (int row = 0; row < 10; ++row)
+    for (int col = 0; col < 7; ++col)
+      expected.emplace_back(static_cast<double>(row * 100 + col));
+  return expected;
+}
+} // namespace
+
+class ChunkCompressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ChunkCompressionTest *createSuite() { return new ChunkCompressionTest(); }
+  static void destroySuite(ChunkCompressionTest *suite) { delete suite; }
+
+  void test_shuffleBytes() {
+    const std::vector<uint16_t> input{0x0201, 0x0403, 0x0605};
+    const auto shuffled = shuffleBytes(input.data(), input.size() * sizeof(uint16_t), sizeof(uint16_t));
+    // little endian, so the low bytes of every element come first
+    TS_ASSERT_EQUALS(shuffled, std::vector<char>({1, 3, 5, 2, 4, 6}));
+  }
+
+  void test_shuffleBytes_keeps_partial_element() {
+    const std::vector<char> input{1, 2, 3, 4, 5};
+    TS_ASSERT_EQUALS(shuffleBytes(input.data(), input.size(), 2), std::vector<char>({1, 3, 2, 4, 5}));
+  }
+
+  void test_compressChunk_is_smaller() {
+    const std::vector<double> input(1000, 3.);
+    const auto compressed = compressChunk(input.data(), input.size() * sizeof(double), sizeof(double), {});
+    TS_ASSERT_LESS_THAN(compressed.size(), input.size() * sizeof(double));
+  }
+
+  void test_read_back_with_shuffle() {
+    FileResource resource("test_chunk_compression_shuffle.h5");
+    TS_ASSERT_EQUALS(writeAndReadCompressed(resource.fullPath(), DeflateSettings{6, true}), expectedValues());
+  }
+
+  void test_read_back_without_shuffle() {
+    FileResource resource("test_chunk_compression_no_shuffle.h5");
+    TS_ASSERT_EQUALS(writeAndReadCompressed(resource.fullPath(), DeflateSettings{1, false}), expectedValues());
+  }
+
+  void test_makeDeflateData_fails() {
+    FileResource resource("test_chunk_compression_fails.h5");
+    Mantid::Nexus::File file(resource.fullPath(), NXaccess::CREATE5);
+    file.makeGroup("entry", "NXentry", true);
+    const DimVector dims{10, 7}, chunk{4, 7};
+    TS_ASSERT_THROWS(file.makeDeflateData("data", NXnumtype::FLOAT64, dims, chunk, 0, true),
+                     Mantid::Nexus::Exception const &);
+    TS_ASSERT_THROWS(file.makeDeflateData("data", NXnumtype::FLOAT64, dims, DimVector{4}, 6, true),
+                     Mantid::Nexus::Exception const &);
+    TS_ASSERT_THROWS(file.makeDeflateData("data", NXnumtype::FLOAT64, DimVector{NX_UNLIMITED, 7}, chunk, 6, true),
+                     Mantid::Nexus::Exception const &);
+    TS_ASSERT_THROWS(file.makeDeflateData("data", NXnumtype::CHAR, dims, chunk, 6, true),
+                     Mantid::Nexus::Exception const &);
+    TS_ASSERT_THROWS_NOTHING(file.makeDeflateData("data", NXnumtype::FLOAT64, dims, chunk, 6, true));
+  }
+};
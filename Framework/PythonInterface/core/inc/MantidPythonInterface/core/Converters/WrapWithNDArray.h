@@ -23,6 +23,10 @@ namespace Impl {
 template <typename ElementType>
 PyObject *wrapWithNDArray(const ElementType *, const int ndims, Py_intptr_t *dims, const NumpyWrapMode mode,
                           const OwnershipMode oMode = OwnershipMode::Cpp);
+// Wrap values that are a fixed number of bytes apart, keeping the owner of the data alive as long as the array
+template <typename ElementType>
+PyObject *wrapWithNDArray(const ElementType *, const int ndims, Py_intptr_t *dims, Py_intptr_t *strides,
+                          PyObject *owner, const NumpyWrapMode mode);
 } // namespace Impl
 
 /**
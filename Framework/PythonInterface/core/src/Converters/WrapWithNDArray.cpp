@@ -92,12 +92,45 @@ PyObject *wrapWithNDArray(const ElementType *carray, const int ndims, Py_intptr_
   return reinterpret_cast<PyObject *>(nparray);
 }
 
+/**
+ * Wraps strided data in a numpy array structure without copying it. The array
+ * holds a reference to the owner of the data, so the data stays valid as long
+ * as the owner does not change it.
+ * @param carray :: A pointer to the first value
+ * @param ndims :: The dimensionality of the array
+ * @param dims :: The length of the arrays in each dimension
+ * @param strides :: The number of bytes between consecutive values in each
+ *dimension
+ * @param owner :: The Python object owning the data. It may be nullptr.
+ * @param mode :: A mode switch to define whether the final array is read
+ *only/read-write
+ * @return A pointer to a numpy ndarray object
+ */
+template <typename ElementType>
+PyObject *wrapWithNDArray(const ElementType *carray, const int ndims, Py_intptr_t *dims, Py_intptr_t *strides,
+                          PyObject *owner, const NumpyWrapMode mode) {
+  int datatype = NDArrayTypeIndex<ElementType>::typenum;
+  const int flags = (mode == ReadWrite) ? NPY_ARRAY_WRITEABLE : 0;
+  auto *nparray = reinterpret_cast<PyArrayObject *>(PyArray_New(
+      &PyArray_Type, ndims, dims, datatype, strides, static_cast<void *>(const_cast<ElementType *>(carray)), 0, flags,
+      nullptr));
+  if (nparray && owner) {
+    // PyArray_SetBaseObject steals the reference
+    Py_INCREF(owner);
+    PyArray_SetBaseObject(nparray, owner);
+  }
+  return reinterpret_cast<PyObject *>(nparray);
+}
+
 //-----------------------------------------------------------------------
 // Explicit instantiations
 //-----------------------------------------------------------------------
 #define INSTANTIATE_WRAPNUMPY(ElementType)                                                                             \
   template DLLExport PyObject *wrapWithNDArray<ElementType>(const ElementType *, const int ndims, Py_intptr_t *dims,   \
-                                                            const NumpyWrapMode mode, const OwnershipMode oMode);
+                                                            const NumpyWrapMode mode, const OwnershipMode oMode);      \
+  template DLLExport PyObject *wrapWithNDArray<ElementType>(const ElementType *, const int ndims, Py_intptr_t *dims,   \
+                                                            Py_intptr_t *strides, PyObject *owner,                     \
+                                                            const NumpyWrapMode mode);
 
 ///@cond Doxygen doesn't seem to like this...
 INSTANTIATE_WRAPNUMPY(int)
@@ -38,5 +38,7 @@ void export_BoxController() {
       .def("getFilename", &BoxController::getFilename, arg("self"),
            "Return  the full path to the file open as the file-based back or "
            "empty string if no file back-end is initiated")
-      .def("useWriteBuffer", &BoxController::useWriteBuffer, arg("self"), "Return true if the MRU should be used");
+      .def("useWriteBuffer", &BoxController::useWriteBuffer, arg("self"), "Return true if the MRU should be used")
+      .def("useColumnarEvents", &BoxController::useColumnarEvents, arg("self"),
+           "Return True if the boxes bin and integrate their events in column blocks");
 }
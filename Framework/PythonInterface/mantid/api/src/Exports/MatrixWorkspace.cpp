@@ -32,6 +32,7 @@
 #include <boost/python/register_ptr_to_python.hpp>
 #include <boost/python/suite/indexing/map_indexing_suite.hpp>
 #include <boost/python/tuple.hpp>
+#include <boost/python/with_custodian_and_ward.hpp>
 
 #define PY_ARRAY_UNIQUE_SYMBOL API_ARRAY_API
 #define NO_IMPORT_ARRAY
@@ -52,10 +53,12 @@ namespace {
 /// Typedef for data access, i.e. dataX,Y,E members
 using data_modifier = Mantid::MantidVec &(MatrixWorkspace::*)(const std::size_t);
 
-/// return_value_policy for read-only numpy array
-using return_readonly_numpy = return_value_policy<VectorRefToNumpy<WrapReadOnly>>;
-/// return_value_policy for read-write numpy array
-using return_readwrite_numpy = return_value_policy<VectorRefToNumpy<WrapReadWrite>>;
+/// return_value_policy for read-only numpy array. The workspace is kept alive as long as the array.
+using return_readonly_numpy =
+    return_value_policy<VectorRefToNumpy<WrapReadOnly>, with_custodian_and_ward_postcall<0, 1>>;
+/// return_value_policy for read-write numpy array. The workspace is kept alive as long as the array.
+using return_readwrite_numpy =
+    return_value_policy<VectorRefToNumpy<WrapReadWrite>, with_custodian_and_ward_postcall<0, 1>>;
 
 //------------------------------- Overload macros ---------------------------
 GNU_DIAG_OFF("unused-local-typedef")
@@ -5,13 +5,16 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventList.h"
+#include "MantidPythonInterface/core/Converters/WrapWithNDArray.h"
 #include "MantidPythonInterface/core/GetPointer.h"
 #include <boost/python/class.hpp>
+#include <boost/python/extract.hpp>
 #include <boost/python/register_ptr_to_python.hpp>
 #include <boost/python/return_arg.hpp>
 
 using namespace boost::python;
 using namespace Mantid::DataObjects;
+using namespace Mantid::PythonInterface;
 
 GET_POINTER_SPECIALIZATION(EventList)
 
@@ -24,6 +27,28 @@ void addWeightedEventToEventList(EventList &self, double tof, double weight, dou
                                  Mantid::Types::Core::DateAndTime pulsetime) {
   self.addEventQuickly(WeightedEvent(Mantid::Types::Event::TofEvent(tof, pulsetime), weight, errorsquare));
 }
+
+/**
+ * Wrap a field of the events in a read-only numpy array without copying it.
+ * The array keeps the Python EventList, and through it the workspace, alive.
+ */
+template <typename T> PyObject *wrapEventField(const object &self, const EventList::FieldView<T> &field) {
+  Py_intptr_t dims[1] = {static_cast<Py_intptr_t>(field.size)};
+  Py_intptr_t strides[1] = {static_cast<Py_intptr_t>(field.stride)};
+  return Converters::Impl::wrapWithNDArray(field.data, 1, dims, strides, self.ptr(), Converters::ReadOnly);
+}
+
+PyObject *getTofsView(const object &self) {
+  return wrapEventField(self, extract<const EventList &>(self)().getTofsView());
+}
+
+PyObject *getWeightsView(const object &self) {
+  return wrapEventField(self, extract<const EventList &>(self)().getWeightsView());
+}
+
+PyObject *getErrorSquaredView(const object &self) {
+  return wrapEventField(self, extract<const EventList &>(self)().getErrorSquaredView());
+}
 } // namespace
 
 void export_EventList() {
@@ -34,6 +59,15 @@ void export_EventList() {
            "Create TofEvent and add to EventList.")
       .def("addWeightedEventQuickly", &addWeightedEventToEventList,
            args("self", "tof", "weight", "errorsquare", "pulsetime"), "Create weighted TofEvent and add to eventlist")
+      .def("getTofsView", &getTofsView, arg("self"),
+           "Get a read-only numpy view of the TOFs of the events. No copy is made, so the view is only valid until "
+           "the events are changed.")
+      .def("getWeightsView", &getWeightsView, arg("self"),
+           "Get a read-only numpy view of the weights of weighted events. No copy is made, so the view is only valid "
+           "until the events are changed.")
+      .def("getErrorSquaredView", &getErrorSquaredView, arg("self"),
+           "Get a read-only numpy view of the squared errors of weighted events. No copy is made, so the view is only "
+           "valid until the events are changed.")
       .def("__iadd__", (EventList & (EventList::*)(const EventList &)) & EventList::operator+=, return_self<>(),
            (arg("self"), arg("other")))
       .def("__isub__", (EventList & (EventList::*)(const EventList &)) & EventList::operator-=, return_self<>(),
@@ -307,6 +307,15 @@ class MatrixWorkspaceTest(unittest.TestCase):
         y[0] = ynow
         self.assertEqual(self._test_ws.readY(0)[0], ynow)
 
+    def test_data_views_keep_workspace_alive(self):
+        ws = WorkspaceCreationHelper.create2DWorkspaceWithFullInstrument(2, 5, False)
+        expected = ws.extractY()[0]
+        y = ws.readY(0)
+        e = ws.dataE(0)
+        del ws
+        np.testing.assert_array_equal(y, expected)
+        self.assertEqual(len(e), 5)
+
     def test_operators_with_workspaces_in_ADS(self):
         run_algorithm("CreateWorkspace", OutputWorkspace="a", DataX=[1.0, 2.0, 3.0], DataY=[2.0, 3.0], DataE=[2.0, 3.0], UnitX="TOF")
         ads = AnalysisDataService
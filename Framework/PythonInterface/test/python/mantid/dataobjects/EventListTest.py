@@ -72,6 +72,30 @@ class EventListTest(unittest.TestCase):
 
         self.assertEqual(left.integrate(-1.0, 31.0, True), -10.0)
 
+    def test_event_list_getTofsView(self):
+        el = self.createRandomEventList(10)
+        tofs = el.getTofsView()
+        np.testing.assert_array_equal(tofs, el.getTofs())
+        self.assertFalse(tofs.flags.writeable)
+        # TOF events do not store weights
+        self.assertRaises(RuntimeError, el.getWeightsView)
+
+    def test_event_list_getWeightsView(self):
+        el = EventList()
+        el.switchTo(EventType.WEIGHTED)
+        el.addWeightedEventQuickly(1.0, 2.0, 0.25, DateAndTime(42))
+        el.addWeightedEventQuickly(3.0, 4.0, 0.5, DateAndTime(43))
+        np.testing.assert_array_equal(el.getTofsView(), [1.0, 3.0])
+        np.testing.assert_array_equal(el.getWeightsView(), [2.0, 4.0])
+        np.testing.assert_array_equal(el.getErrorSquaredView(), [0.25, 0.5])
+        self.assertEqual(el.getWeightsView().dtype, np.float32)
+
+    def test_event_list_views_keep_event_list_alive(self):
+        el = self.createRandomEventList(10)
+        tofs = el.getTofsView()
+        del el
+        np.testing.assert_array_equal(tofs, np.arange(10, dtype=float))
+
     def test_mask_condition(self):
         evl = self.createRandomEventList(20)
 
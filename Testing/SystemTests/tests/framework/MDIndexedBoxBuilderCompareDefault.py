@@ -0,0 +1,148 @@
+# Mantid Repository : https://github.com/mantidproject/mantid
+#
+# Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+#   NScD Oak Ridge National Laboratory, European Spallation Source,
+#   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+# SPDX - License - Identifier: GPL - 3.0 +
+# pylint: disable=no-init
+import os
+import sys
+import tempfile
+import time
+
+import numpy as np
+import systemtesting
+from mantid.api import mtd
+from mantid.kernel import MemoryStats, logger
+from mantid.simpleapi import (
+    BinMD,
+    CompareMDWorkspaces,
+    ConvertToDiffractionMDWorkspace,
+    CreateMDWorkspace,
+    CreateSampleWorkspace,
+    FakeMDEventData,
+    ImportMDEventWorkspace,
+    MergeMD,
+)
+
+
+class MDIndexedBoxBuilderCompareDefault(systemtesting.MantidSystemTest):
+    """
+    Runs the algorithms which can build their boxes from the Morton index of the events with both box builders,
+    logs the time and memory used by each and checks that the binned results agree.
+    """
+
+    builders = ["Default", "Indexed"]
+
+    def skipTests(self):
+        return sys.platform.startswith("win")
+
+    def runTest(self):
+        self._filename = os.path.join(tempfile.gettempdir(), "MDIndexedBoxBuilderCompareDefault.txt")
+        self._write_import_file(self._filename, 200000)
+        try:
+            for builder in self.builders:
+                self._timed("FakeMDEventData", builder, self._fake_md_event_data)
+                self._timed("MergeMD", builder, self._merge_md)
+                self._timed("ImportMDEventWorkspace", builder, self._import_md_event_workspace)
+                self._timed("ConvertToDiffractionMDWorkspace", builder, self._convert_to_diffraction_md)
+        finally:
+            os.remove(self._filename)
+
+    def validate(self):
+        names = ["FakeMDEventData", "MergeMD", "ImportMDEventWorkspace", "ConvertToDiffractionMDWorkspace"]
+        out = True
+        for name in names:
+            default = mtd[self._name(name, "Default")]
+            indexed = mtd[self._name(name, "Indexed")]
+            self.assertEqual(default.getNEvents(), indexed.getNEvents(), name)
+            dims = [default.getDimension(i) for i in range(default.getNumDims())]
+            binned = []
+            for ws in (default, indexed):
+                bins = {
+                    "AlignedDim{}".format(i): "{},{},{},20".format(dim.getName(), dim.getMinimum(), dim.getMaximum())
+                    for i, dim in enumerate(dims)
+                }
+                binned.append(BinMD(InputWorkspace=ws, AxisAligned=True, StoreInADS=False, **bins))
+            result = CompareMDWorkspaces(binned[0], binned[1], Tolerance="0.0001", IgnoreBoxID=True, CheckEvents=False)
+            if not result.Equals:
+                logger.error("{}: the Default and Indexed boxes give different histograms: {}".format(name, result.Result))
+            out = out and result.Equals
+        return out
+
+    @staticmethod
+    def _name(algorithm, builder):
+        return "{}_{}".format(algorithm, builder)
+
+    def _timed(self, algorithm, builder, function):
+        memory = MemoryStats()
+        memory.update()
+        rss_before = memory.getCurrentRSS()
+        start = time.perf_counter()
+        function(builder, self._name(algorithm, builder))
+        elapsed = time.perf_counter() - start
+        memory.update()
+        logger.notice(
+            "{} with the {} box builder: {:.3f} s, resident memory {} -> {} kB, peak {} kB".format(
+                algorithm, builder, elapsed, rss_before, memory.getCurrentRSS(), memory.getPeakRSS()
+            )
+        )
+
+    @staticmethod
+    def _create_md(name):
+        CreateMDWorkspace(
+            Dimensions="3",
+            Extents="-10,10,-10,10,-10,10",
+            Names="A,B,C",
+            Units="U,U,U",
+            SplitInto="2",
+            SplitThreshold="500",
+            MaxRecursionDepth="20",
+            OutputWorkspace=name,
+        )
+
+    def _fake_md_event_data(self, builder, name):
+        self._create_md(name)
+        FakeMDEventData(
+            InputWorkspace=name, UniformParams="2000000", PeakParams="500000,1,2,3,0.5", RandomSeed="3873875", BoxBuilder=builder
+        )
+
+    def _merge_md(self, builder, name):
+        inputs = []
+        for i in range(4):
+            input_name = "{}_input{}".format(name, i)
+            self._create_md(input_name)
+            FakeMDEventData(InputWorkspace=input_name, UniformParams="500000", RandomSeed=str(1000 + i))
+            inputs.append(input_name)
+        MergeMD(InputWorkspaces=",".join(inputs), SplitInto="2", SplitThreshold="500", BoxBuilder=builder, OutputWorkspace=name)
+        for input_name in inputs:
+            mtd.remove(input_name)
+
+    def _import_md_event_workspace(self, builder, name):
+        ImportMDEventWorkspace(Filename=self._filename, BoxBuilder=builder, OutputWorkspace=name)
+
+    @staticmethod
+    def _convert_to_diffraction_md(builder, name):
+        data_name = "{}_data".format(name)
+        CreateSampleWorkspace(
+            WorkspaceType="Event",
+            OutputWorkspace=data_name,
+            Function="Multiple Peaks",
+            XMin="10000",
+            XMax="100000",
+            NumEvents="1000",
+            BankPixelWidth="20",
+            Random=False,
+        )
+        ConvertToDiffractionMDWorkspace(
+            InputWorkspace=data_name, OutputDimensions="Q (lab frame)", SplitInto="2", ConverterType=builder, OutputWorkspace=name
+        )
+        mtd.remove(data_name)
+
+    @staticmethod
+    def _write_import_file(filename, num_events):
+        rng = np.random.default_rng(42)
+        coordinates = rng.uniform(-10.0, 10.0, size=(num_events, 3))
+        with open(filename, "w") as f:
+            f.write("DIMENSIONS\nA A U 20\nB B U 20\nC C U 20\nMDEVENTS\n")
+            np.savetxt(f, np.hstack([np.ones((num_events, 2)), coordinates]), fmt="%.6f")
@@ -124,6 +124,8 @@ if(BUILD_MANTIDFRAMEWORK)
     REQUIRED
   )
   set(HDF5_LIBRARIES hdf5::hdf5_cpp hdf5::hdf5)
+  # used to compress chunks for HDF5 outside of the HDF5 filter pipeline
+  find_package(ZLIB REQUIRED)
 endif()
 
 if(ENABLE_WORKBENCH)